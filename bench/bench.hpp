@@ -0,0 +1,70 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+/**
+ * @brief Minimal harness of r-type-bench.
+ * @details A benchmark is a function declared with BENCH(name); it measures what it wants with
+ * measure() and prints its own table rows with row(). `r-type-bench [filter]` runs every benchmark
+ * whose name contains `filter`. Build in Release (`./build.sh --bench`): numbers of a Debug build
+ * mean nothing.
+ */
+namespace bench {
+
+using BenchFn = void (*)();
+
+/**
+ * @brief Registers a benchmark, called by BENCH() before main.
+ */
+bool add(const char *name, BenchFn fn) noexcept;
+
+/**
+ * @brief Keeps the compiler from optimizing away a result that is never read.
+ */
+template<typename T>
+inline void keep(const T &value) noexcept
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Fastest time of one call to `body`, in nanoseconds.
+ * @details Calls `body` in rounds of `iterations`, enough rounds to fill about 200 ms, and keeps the
+ * best round: the minimum is the figure least disturbed by the rest of the machine.
+ */
+template<typename F>
+double measure(std::size_t iterations, F &&body)
+{
+    using Clock = std::chrono::steady_clock;
+    constexpr auto BUDGET = std::chrono::milliseconds(200);
+    constexpr int MIN_ROUNDS = 5;
+
+    body(); /* Warm caches and lazily sized buffers */
+    double best = 0.0;
+    const Clock::time_point deadline = Clock::now() + BUDGET;
+    for (int round = 0; round < MIN_ROUNDS || Clock::now() < deadline; ++round) {
+        const Clock::time_point start = Clock::now();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            body();
+        }
+        const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        const double per_call = elapsed / static_cast<double>(iterations);
+        if (round == 0 || per_call < best) {
+            best = per_call;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Prints one result line: `label`, then `value` with its `unit`.
+ */
+void row(const char *label, double value, const char *unit);
+
+}// namespace bench
+
+#define BENCH(name)                                                         \
+    static void bench_##name();                                             \
+    [[maybe_unused]] static const bool bench_##name##_registered = bench::add(#name, bench_##name); \
+    static void bench_##name()
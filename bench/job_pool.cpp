@@ -0,0 +1,122 @@
+#include "bench.hpp"
+
+#include <core/job_pool.hpp>
+#include <core/simd_integrate.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Packed xyz state of `count` entities, as movement_system gathers it.
+ */
+struct Entities {
+        std::vector<float> positions;
+        std::vector<float> velocities;
+
+        explicit Entities(std::size_t count) : positions(count * 3), velocities(count * 3)
+        {
+            for (std::size_t i = 0; i < positions.size(); ++i) {
+                positions[i] = static_cast<float>(i % 97) - 48.0f;
+                velocities[i] = static_cast<float>(i % 13) * 0.25f - 1.5f;
+            }
+        }
+
+        std::size_t size() const noexcept
+        {
+            return positions.size() / 3;
+        }
+};
+
+/**
+ * @brief The homing turn of enemy_movement_homing_system: aim at `target`, keep the speed.
+ */
+void steer(float *velocity, const float *position, const float *target, float t) noexcept
+{
+    float to[3] = {target[0] - position[0], target[1] - position[1], target[2] - position[2]};
+    const float to_length = std::sqrt(to[0] * to[0] + to[1] * to[1] + to[2] * to[2]);
+    const float speed = std::sqrt(velocity[0] * velocity[0] + velocity[1] * velocity[1] + velocity[2] * velocity[2]);
+    float turned[3] = {0.0f, 0.0f, 0.0f};
+    for (int axis = 0; axis < 3; ++axis) {
+        const float wanted = to_length > 0.0f ? to[axis] / to_length : 0.0f;
+        const float current = speed > 0.0f ? velocity[axis] / speed : 0.0f;
+        turned[axis] = current + (wanted - current) * t;
+    }
+    const float turned_length = std::sqrt(turned[0] * turned[0] + turned[1] * turned[1] + turned[2] * turned[2]);
+    for (int axis = 0; axis < 3; ++axis) {
+        velocity[axis] = turned_length > 0.0f ? turned[axis] / turned_length * speed : 0.0f;
+    }
+}
+
+/**
+ * @brief One frame of `run(begin, end)` over every entity: inline below two threads, like the systems below the threshold.
+ */
+template<typename F>
+double frame_time(const JobPool *pool, std::size_t count, F &&run)
+{
+    return bench::measure(4, [&] {
+        if (pool) {
+            pool->parallel_for(count, run);
+        } else {
+            run(0, count);
+        }
+    });
+}
+
+template<typename MakeBody>
+void scaling(const char *workload, MakeBody &&make_body)
+{
+    static const std::size_t THREADS[] = {1, 4, 8};
+    for (const std::size_t count : {std::size_t{10'000}, std::size_t{100'000}}) {
+        Entities entities{count};
+        const auto body = make_body(entities);
+        double single = 0.0;
+        for (const std::size_t threads : THREADS) {
+            double ns = 0.0;
+            if (threads == 1) {
+                /* No pool at all: JobPool{0} would start hardware concurrency - 1 workers */
+                ns = frame_time(nullptr, count, body);
+            } else {
+                const JobPool pool{threads - 1};
+                ns = frame_time(&pool, count, body);
+            }
+            if (threads == 1) {
+                single = ns;
+            }
+            const std::string label = std::string{workload} + " " + std::to_string(count) + " x" + std::to_string(threads);
+            bench::row(label.c_str(), ns / 1000.0, "us/frame");
+            if (threads > 1) {
+                bench::row("  speedup", single / ns, "x");
+            }
+        }
+    }
+}
+
+}// namespace
+
+/**
+ * @brief parallel_for scaling on 1, 4 and 8 threads, with 10k and 100k entities.
+ * @details `integrate` is the movement_system body (memory bound), `homing` the steering of
+ * enemy_movement_homing_system (compute bound). Threads beyond the host's cores only add noise.
+ */
+BENCH(job_pool)
+{
+    scaling("integrate", [](Entities &entities) {
+        return [&entities](std::size_t begin, std::size_t end) {
+            integrate_positions(entities.positions.data() + begin * 3, entities.velocities.data() + begin * 3, (end - begin) * 3,
+                1.0f / 60.0f);
+        };
+    });
+    scaling("homing", [](Entities &entities) {
+        return [&entities](std::size_t begin, std::size_t end) {
+            static const float TARGET[3] = {-20.0f, 4.0f, 0.0f};
+            for (std::size_t i = begin; i < end; ++i) {
+                steer(entities.velocities.data() + i * 3, entities.positions.data() + i * 3, TARGET, 0.05f);
+            }
+        };
+    });
+}
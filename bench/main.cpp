@@ -0,0 +1,54 @@
+#include "bench.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Registered {
+        const char *name;
+        bench::BenchFn fn;
+};
+
+std::vector<Registered> &registry()
+{
+    static std::vector<Registered> benches;
+    return benches;
+}
+
+}// namespace
+
+bool bench::add(const char *name, BenchFn fn) noexcept
+{
+    registry().push_back({name, fn});
+    return true;
+}
+
+void bench::row(const char *label, double value, const char *unit)
+{
+    std::printf("  %-40s %12.2f %s\n", label, value, unit);
+}
+
+int main(int argc, char **argv)
+{
+    const std::string_view filter = argc > 1 ? argv[1] : "";
+    std::printf("r-type-bench: %u hardware threads\n", std::thread::hardware_concurrency());
+
+    bool ran = false;
+    for (const Registered &bench : registry()) {
+        if (std::string_view{bench.name}.find(filter) == std::string_view::npos) {
+            continue;
+        }
+        std::printf("\n%s\n", bench.name);
+        bench.fn();
+        ran = true;
+    }
+    if (!ran) {
+        std::fprintf(stderr, "No benchmark matches \"%.*s\"\n", static_cast<int>(filter.size()), filter.data());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
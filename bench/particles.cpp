@@ -0,0 +1,46 @@
+#include "bench.hpp"
+
+#include <core/particle_pool.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace {
+
+constexpr std::size_t CROWDED_FIGHT = 100'000;
+constexpr std::uint8_t KINDS = 3;
+
+/**
+ * @brief The render thread gets the other half of a 60 Hz frame.
+ */
+constexpr double FRAME_BUDGET_US = 8000.0;
+
+}// namespace
+
+/**
+ * @brief One frame of simulation and instance export with 100k particles alive, on the calling thread only.
+ * @details A worker pool only makes it faster. Particles are emitted with a life long enough to outlast the
+ * whole measurement, so every frame walks the full pool.
+ */
+BENCH(particles)
+{
+    ParticlePool pool{CROWDED_FIGHT, KINDS};
+    for (std::size_t i = 0; i < CROWDED_FIGHT; ++i) {
+        const float spread = static_cast<float>(i % 1000);
+        pool.emit({spread, -spread, 0.0f}, {1.0f, 0.5f, 0.0f}, 1.0e9f, 0.1f, 0xFF8040FFu, static_cast<std::uint8_t>(i % KINDS));
+    }
+    ParticlePool::InstanceLists lists;
+    pool.build_instances(lists); /* Sizes the lists, as the first frames of a battle do */
+
+    const double frame = bench::measure(1, [&] {
+        pool.update(1.0f / 60.0f, 0.15f);
+        pool.build_instances(lists);
+        bench::keep(lists.front().front());
+    });
+
+    const double frame_us = frame / 1000.0;
+    bench::row("100k update + instances", frame_us, "us/frame");
+    bench::row("   frame budget", FRAME_BUDGET_US, "us/frame");
+    std::printf("  %s\n", pool.size() == CROWDED_FIGHT && frame_us < FRAME_BUDGET_US ? "within budget" : "OVER BUDGET");
+}
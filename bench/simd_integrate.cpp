@@ -0,0 +1,62 @@
+#include "bench.hpp"
+
+#include <core/simd_integrate.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief What movement_system walked before the bulk kernel: one transform and one velocity per entity.
+ */
+struct Body {
+        float position[3];
+        float rotation[3];
+        float scale[3];
+        float velocity[3];
+};
+
+}// namespace
+
+/**
+ * @brief integrate_positions() against the per-entity loop it replaced, at 1k, 10k and 100k entities.
+ * @details Gathering and scattering are left out on both sides: this is the kernel alone.
+ */
+BENCH(simd_integrate)
+{
+    std::printf("  kernel: %s\n", integrate_positions_isa());
+    constexpr float DT = 1.0f / 60.0f;
+
+    for (const std::size_t count : {std::size_t{1'000}, std::size_t{10'000}, std::size_t{100'000}}) {
+        std::vector<Body> bodies(count);
+        std::vector<float> positions(count * 3);
+        std::vector<float> velocities(count * 3);
+        for (std::size_t i = 0; i < count * 3; ++i) {
+            positions[i] = static_cast<float>(i % 101);
+            velocities[i] = static_cast<float>(i % 7) - 3.0f;
+            bodies[i / 3].position[i % 3] = positions[i];
+            bodies[i / 3].velocity[i % 3] = velocities[i];
+        }
+
+        const double per_entity = bench::measure(16, [&] {
+            for (Body &body : bodies) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    body.position[axis] = body.position[axis] + body.velocity[axis] * DT;
+                }
+            }
+            bench::keep(bodies.front());
+        });
+        const double packed = bench::measure(16, [&] {
+            integrate_positions(positions.data(), velocities.data(), positions.size(), DT);
+            bench::keep(positions.front());
+        });
+
+        const std::string label = std::to_string(count);
+        bench::row((label + " per entity").c_str(), per_entity / static_cast<double>(count), "ns/entity");
+        bench::row((label + " integrate_positions").c_str(), packed / static_cast<double>(count), "ns/entity");
+        bench::row((label + "   speedup").c_str(), per_entity / packed, "x");
+    }
+}
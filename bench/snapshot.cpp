@@ -0,0 +1,342 @@
+#include "bench.hpp"
+
+#include <core/snapshot.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief A battle-like world: a few players and bosses, then enemies and bullets.
+ */
+WorldSnapshot make_world(std::size_t count)
+{
+    WorldSnapshot world{.sequence = 1, .entities = {}};
+    for (std::size_t i = 0; i < count; ++i) {
+        EntityState entity{};
+        entity.id = NetId::make(static_cast<std::uint16_t>(i + 1), 0);
+        entity.kind = i < 4 ? NetKind::Player : (i < 6 ? NetKind::Boss : (i % 3 == 0 ? NetKind::Enemy : NetKind::PlayerBullet));
+        entity.transform.position = {static_cast<float>(i % 180) - 90.0f, static_cast<float>(i % 17) - 8.0f, 0.0f};
+        if (entity.kind == NetKind::PlayerBullet) {
+            entity.velocity.value = {10.0f, 0.0f, 0.0f};
+        } else {
+            entity.health = {100, 100};
+        }
+        world.entities.push_back(entity);
+    }
+    return world;
+}
+
+/**
+ * @brief `world` one tick later, with every `every`th entity moved by one tick of a 10 units/s bullet.
+ * @details The time does not change, so nothing is extrapolated: every move is a record.
+ */
+WorldSnapshot step(const WorldSnapshot &world, std::size_t every)
+{
+    WorldSnapshot next = world;
+    next.sequence = world.sequence + 1;
+    for (std::size_t i = 0; i < next.entities.size(); i += every) {
+        next.entities[i].transform.position.x += 10.0f / 60.0f;
+    }
+    return next;
+}
+
+double bytes_per_entity(const WorldSnapshot *baseline, const WorldSnapshot &current)
+{
+    std::vector<std::uint8_t> payload;
+    encode_snapshot(baseline, current, payload);
+    return static_cast<double>(payload.size()) / static_cast<double>(current.entities.size());
+}
+
+/* ================================================================================= */
+/* Boss fight */
+/* ================================================================================= */
+
+/**
+ * @brief A boss fight simulated the way the server does, for the snapshots it produces.
+ * @details Four players steering and firing, their Forces and the boss's shields following them
+ * without a velocity of their own, a boss patrolling and taking hits, sine-wave enemies, rings of
+ * enemy bullets. Ticks last 1/60 s give or take a millisecond, and NetIds are recycled after the
+ * history like ReplicationRegistry does. Everything is deterministic.
+ */
+class BossFight
+{
+    public:
+        BossFight()
+        {
+            for (std::size_t player = 0; player < PLAYERS; ++player) {
+                const float y = static_cast<float>(player) * 4.0f - 6.0f;
+                spawn(NetKind::Player, {-30.0f, y, 0.0f}, {}, {3, 3});
+                spawn(NetKind::Force, {-28.0f, y, 0.0f}, {}, {});
+            }
+            _boss = spawn(NetKind::Boss, {20.0f, 0.0f, 0.0f}, {}, {1000, 1000});
+            for (std::size_t shield = 0; shield < SHIELDS; ++shield) {
+                spawn(NetKind::Shield, {17.0f, static_cast<float>(shield) * 3.0f - 3.0f, 0.0f}, {}, {50, 50});
+            }
+            for (std::size_t enemy = 0; enemy < ENEMIES; ++enemy) {
+                spawn(NetKind::Enemy, {static_cast<float>(enemy) * 4.0f - 10.0f, 0.0f, 0.0f}, {}, {3, 3});
+            }
+        }
+
+        /**
+         * @brief Simulates one tick and returns its snapshot.
+         */
+        WorldSnapshot tick()
+        {
+            const float dt = (1'000.0f / 60.0f + static_cast<float>(random() % 2'001) / 1'000.0f - 1.0f) / 1'000.0f;
+            ++_ticks;
+            steer(dt);
+            for (Body &body : _bodies) {
+                body.state.transform.position.x += body.state.velocity.value.x * dt;
+                body.state.transform.position.y += body.state.velocity.value.y * dt;
+            }
+            follow();
+            fire();
+            collide();
+
+            _time += static_cast<std::uint32_t>(std::lround(static_cast<double>(dt) * 1e6));
+            WorldSnapshot snapshot{.sequence = _ticks, .time = _time, .entities = {}};
+            for (const Body &body : _bodies) {
+                snapshot.entities.push_back(body.state);
+            }
+            std::ranges::sort(snapshot.entities, {}, &EntityState::id);
+            return snapshot;
+        }
+
+    private:
+        static constexpr std::size_t PLAYERS = 4;
+        static constexpr std::size_t SHIELDS = 3;
+        static constexpr std::size_t ENEMIES = 12;
+
+        struct Body {
+                EntityState state;
+                float phase = 0.0f;
+        };
+
+        std::uint32_t random() noexcept
+        {
+            _seed = _seed * 1'664'525u + 1'013'904'223u;
+            return _seed >> 8;
+        }
+
+        std::size_t spawn(NetKind kind, r::Vec3f position, r::Vec3f velocity, Health health)
+        {
+            NetId id;
+            if (!_free.empty() && _free.front().since + SNAPSHOT_HISTORY <= _ticks) {
+                id = _free.front().id;
+                _free.pop_front();
+            } else {
+                id = NetId::make(++_next_index, 0);
+            }
+            Body body{};
+            body.state.id = id;
+            body.state.kind = kind;
+            body.state.transform.position = position;
+            body.state.velocity.value = velocity;
+            body.state.health = health;
+            body.phase = static_cast<float>(_bodies.size());
+            _bodies.push_back(body);
+            return _bodies.size() - 1;
+        }
+
+        void despawn(std::size_t index)
+        {
+            const NetId id = _bodies[index].state.id;
+            _free.push_back({NetId::make(id.index(), static_cast<std::uint16_t>(id.generation() + 1)), _ticks});
+            _bodies[index] = _bodies.back();
+            _bodies.pop_back();
+            if (_boss == _bodies.size()) {
+                _boss = index;
+            }
+        }
+
+        /**
+         * @brief Players change direction now and then, the boss goes from one spot to the next, enemies weave.
+         */
+        void steer(float dt)
+        {
+            for (Body &body : _bodies) {
+                r::Vec3f &velocity = body.state.velocity.value;
+                if (body.state.kind == NetKind::Player && random() % 20 == 0) {
+                    velocity = {static_cast<float>(random() % 3) * 6.0f - 6.0f, static_cast<float>(random() % 3) * 6.0f - 6.0f, 0.0f};
+                } else if (body.state.kind == NetKind::Enemy) {
+                    body.phase += 2.0f * dt;
+                    velocity = {-1.5f, std::sin(body.phase) * 4.0f, 0.0f};
+                }
+            }
+            Body &boss = _bodies[_boss];
+            if (_ticks % 120 == 0) {
+                const float y = static_cast<float>(random() % 13) - 6.0f;
+                boss.state.velocity.value = {0.0f, (y - boss.state.transform.position.y) / 1.5f, 0.0f};
+            } else if (_ticks % 120 == 90) {
+                boss.state.velocity.value = {};
+            }
+        }
+
+        /**
+         * @brief Forces stay in front of their player, shields around the boss, and enemies wrap around the screen.
+         */
+        void follow()
+        {
+            const r::Vec3f boss = _bodies[_boss].state.transform.position;
+            r::Vec3f player{};
+            std::size_t shield = 0;
+            for (Body &body : _bodies) {
+                r::Vec3f &position = body.state.transform.position;
+                if (body.state.kind == NetKind::Player) {
+                    player = position;
+                } else if (body.state.kind == NetKind::Force) {
+                    position = {player.x + 2.0f, player.y, 0.0f};
+                } else if (body.state.kind == NetKind::Shield) {
+                    position = {boss.x - 3.0f, boss.y + static_cast<float>(shield++) * 3.0f - 3.0f, 0.0f};
+                } else if (body.state.kind == NetKind::Enemy && position.x < -40.0f) {
+                    position.x += 60.0f;
+                }
+            }
+        }
+
+        /**
+         * @brief Players shoot every 8 ticks, enemies every 90, the boss a ring of 16 every 40.
+         */
+        void fire()
+        {
+            const std::size_t count = _bodies.size();
+            for (std::size_t i = 0; i < count; ++i) {
+                const EntityState shooter = _bodies[i].state;
+                const r::Vec3f from = shooter.transform.position;
+                if (shooter.kind == NetKind::Player && (_ticks + i) % 8 == 0) {
+                    spawn(NetKind::PlayerBullet, {from.x + 1.0f, from.y, 0.0f}, {24.0f, 0.0f, 0.0f}, {});
+                } else if (shooter.kind == NetKind::Enemy && (_ticks + i * 7) % 90 == 0) {
+                    spawn(NetKind::EnemyBullet, from, {-8.0f, 0.0f, 0.0f}, {});
+                } else if (shooter.kind == NetKind::Boss && _ticks % 40 == 0) {
+                    for (int ray = 0; ray < 16; ++ray) {
+                        const float angle = static_cast<float>(ray) * 0.3927f + static_cast<float>(_ticks % 7) * 0.1f;
+                        spawn(NetKind::EnemyBullet, from, {std::cos(angle) * 7.0f, std::sin(angle) * 7.0f, 0.0f}, {});
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Player bullets reaching the boss hurt it, every bullet leaving the screen goes.
+         */
+        void collide()
+        {
+            for (std::size_t i = _bodies.size(); i-- > 0;) {
+                const EntityState &bullet = _bodies[i].state;
+                const r::Vec3f &position = bullet.transform.position;
+                const bool is_bullet = bullet.kind == NetKind::PlayerBullet || bullet.kind == NetKind::EnemyBullet;
+                if (!is_bullet) {
+                    continue;
+                }
+                const r::Vec3f &boss = _bodies[_boss].state.transform.position;
+                const bool hit = bullet.kind == NetKind::PlayerBullet && position.x > boss.x && std::fabs(position.y - boss.y) < 2.0f;
+                if (hit) {
+                    Health &health = _bodies[_boss].state.health;
+                    health.current = health.current > 1 ? health.current - 1 : health.max;
+                }
+                if (hit || std::fabs(position.x) > 40.0f || std::fabs(position.y) > 10.0f) {
+                    despawn(i);
+                }
+            }
+        }
+
+        struct Freed {
+                NetId id;
+                std::uint32_t since;
+        };
+
+        std::vector<Body> _bodies;
+        std::deque<Freed> _free;
+        std::size_t _boss = 0;
+        std::uint16_t _next_index = 0;
+        std::uint32_t _ticks = 0;
+        std::uint32_t _time = 0;
+        std::uint32_t _seed = 12'345;
+};
+
+}// namespace
+
+/**
+ * @brief CMD_SNAPSHOT bytes per tick of a boss fight: full snapshots against deltas from the previous tick and from 6 ticks back.
+ * @details 6 ticks is a 100 ms round trip: a client's acknowledged baseline is that old. The last row
+ * is the same delta with the baseline moved in time but not extrapolated, for what extrapolation saves.
+ */
+BENCH(snapshot_boss_fight)
+{
+    constexpr std::size_t WARM_UP = 300;
+    constexpr std::size_t TICKS = 1'200;
+    constexpr std::size_t LAG = 6;
+
+    BossFight fight;
+    std::deque<WorldSnapshot> recent;
+    double entities = 0.0;
+    double full = 0.0;
+    double next = 0.0;
+    double lagged = 0.0;
+    double not_extrapolated = 0.0;
+    std::vector<std::uint8_t> payload;
+    const auto size = [&](const WorldSnapshot *baseline, const WorldSnapshot &current) {
+        payload.clear();
+        encode_snapshot(baseline, current, payload);
+        return static_cast<double>(payload.size());
+    };
+    for (std::size_t tick = 0; tick < WARM_UP + TICKS; ++tick) {
+        recent.push_back(fight.tick());
+        if (recent.size() > LAG + 1) {
+            recent.pop_front();
+        }
+        if (tick < WARM_UP) {
+            continue;
+        }
+        const WorldSnapshot &current = recent.back();
+        entities += static_cast<double>(current.entities.size());
+        full += size(nullptr, current);
+        next += size(&recent[recent.size() - 2], current);
+        lagged += size(&recent.front(), current);
+        WorldSnapshot still = recent.front();
+        still.time = current.time;
+        not_extrapolated += size(&still, current);
+    }
+
+    const auto ticks = static_cast<double>(TICKS);
+    bench::row("boss fight entities", entities / ticks, "entities");
+    bench::row("boss fight full", full / ticks, "B/tick");
+    bench::row("boss fight delta, 1 tick", next / ticks, "B/tick");
+    bench::row("boss fight delta, 6 ticks", lagged / ticks, "B/tick");
+    bench::row("boss fight full / delta, 1 tick", full / next, "x");
+    bench::row("boss fight full / delta, 6 ticks", full / lagged, "x");
+    bench::row("boss fight delta, 6 ticks, not extrapolated", not_extrapolated / ticks, "B/tick");
+}
+
+/**
+ * @brief CMD_SNAPSHOT payload size per entity: a full snapshot, a delta where everything moved and one where 10% moved.
+ * @details Header included, so small worlds pay a little more per entity. Also times encode_snapshot on the full world.
+ */
+BENCH(snapshot)
+{
+    for (const std::size_t count : {std::size_t{50}, std::size_t{200}, std::size_t{1000}}) {
+        const WorldSnapshot world = make_world(count);
+        const WorldSnapshot all_moved = step(world, 1);
+        const WorldSnapshot some_moved = step(world, 10);
+
+        const std::string label = std::to_string(count) + " entities";
+        bench::row((label + " full").c_str(), bytes_per_entity(nullptr, world), "B/entity");
+        bench::row((label + " delta, all moved").c_str(), bytes_per_entity(&world, all_moved), "B/entity");
+        bench::row((label + " delta, 10% moved").c_str(), bytes_per_entity(&world, some_moved), "B/entity");
+
+        std::vector<std::uint8_t> payload;
+        const double encode = bench::measure(64, [&] {
+            payload.clear();
+            encode_snapshot(&world, all_moved, payload);
+            bench::keep(payload.data());
+        });
+        bench::row((label + " encode delta").c_str(), encode / static_cast<double>(count), "ns/entity");
+    }
+}
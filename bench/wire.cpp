@@ -0,0 +1,58 @@
+#include "bench.hpp"
+
+#include <core/wire.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Datagram codec throughput, for an empty, an input-sized and a snapshot-sized payload.
+ * @details `decode view` is what the server does on receive: the header alone is parsed, whatever
+ * the payload size. `decode packet` adds the payload copy made when a packet outlives the receive buffer.
+ */
+BENCH(wire)
+{
+    rtype::protocol::RTypeHeader header{};
+    header.magic = wire::RTYPE_MAGIC;
+    header.version = 1;
+    header.seq = 123456;
+    header.ackBase = 123400;
+    header.ackBits = 0xA5;
+    header.id = 7;
+    header.command = static_cast<std::uint8_t>(rtype::protocol::RTypeCommand::CMD_INPUT);
+
+    std::array<std::uint8_t, 2048> datagram{};
+    for (const std::size_t payload_size : {std::size_t{0}, std::size_t{16}, std::size_t{512}}) {
+        const std::vector<std::uint8_t> payload(payload_size, 0x5A);
+        std::size_t length = 0;
+
+        const double encode = bench::measure(4096, [&] {
+            bench::keep(&header);
+            length = wire::encode_datagram(header, payload, datagram);
+            bench::keep(datagram.data());
+        });
+        const std::span<const std::uint8_t> bytes{datagram.data(), length};
+        wire::RTypePacketView view{};
+        const double decode_view = bench::measure(4096, [&] {
+            bench::keep(bytes.data()); /* The datagram may have changed: parse it again */
+            bench::keep(wire::decode_datagram(bytes, view));
+            bench::keep(&view);
+        });
+        rtype::protocol::RTypePacket packet;
+        const double decode_packet = bench::measure(4096, [&] {
+            bench::keep(bytes.data());
+            bench::keep(wire::decode_datagram(bytes, packet));
+            bench::keep(&packet);
+        });
+
+        const std::string label = std::to_string(payload_size) + " B payload";
+        const double mb = static_cast<double>(length) / 1e6;
+        bench::row((label + " encode").c_str(), encode, "ns/datagram");
+        bench::row((label + " decode view").c_str(), decode_view, "ns/datagram");
+        bench::row((label + " decode packet").c_str(), decode_packet, "ns/datagram");
+        bench::row((label + " decode packet throughput").c_str(), mb / (decode_packet * 1e-9), "MB/s");
+    }
+}
@@ -7,6 +7,9 @@ ORG="\033[1;33m"
 RST="\033[0m"
 
 PROGRAM_NAME="r-type"
+SERVER_NAME="r-type-server"
+GATEWAY_NAME="r-type-gateway"
+BENCH_NAME="r-type-bench"
 UNIT_TESTS_NAME="unit_tests"
 
 function _error()
@@ -47,21 +50,42 @@ function _all()
     exit 0
 }
 
+function _server()
+{
+    _base_run "-DCMAKE_BUILD_TYPE=Release -DENABLE_DEBUG=OFF" "$SERVER_NAME"
+    exit 0
+}
+
+function _gateway()
+{
+    _base_run "-DCMAKE_BUILD_TYPE=Release -DENABLE_DEBUG=OFF" "$GATEWAY_NAME"
+    exit 0
+}
+
 function _debug()
 {
     _base_run "-DCMAKE_BUILD_TYPE=Debug -DENABLE_DEBUG=ON" "$PROGRAM_NAME"
     exit 0
 }
 
-# function _tests_run()
-# {
-#     _base_run "-DCMAKE_BUILD_TYPE=Debug -DENABLE_DEBUG=ON -DENABLE_TESTS=ON" "$UNIT_TESTS_NAME"
-#     if ! ./$UNIT_TESTS_NAME; then
-#         _error "unit tests error" "unit tests failed!"
-#     fi
-#     _success "unit tests succeed!"
-#     exit 0
-# }
+function _bench_run()
+{
+    _base_run "-DCMAKE_BUILD_TYPE=Release -DENABLE_DEBUG=OFF -DENABLE_BENCHMARKS=ON" "$BENCH_NAME"
+    if ! ../$BENCH_NAME; then
+        _error "benchmark error" "$BENCH_NAME failed!"
+    fi
+    exit 0
+}
+
+function _tests_run()
+{
+    _base_run "-DCMAKE_BUILD_TYPE=Debug -DENABLE_DEBUG=ON -DENABLE_TESTS=ON" "$UNIT_TESTS_NAME"
+    if ! ctest --output-on-failure; then
+        _error "unit tests error" "unit tests failed!"
+    fi
+    _success "unit tests succeed!"
+    exit 0
+}
 
 function _clean()
 {
@@ -71,7 +95,7 @@ function _clean()
 function _fclean()
 {
     _clean
-    rm -rf $PROGRAM_NAME r-engine r-engine__* $UNIT_TESTS_NAME plugins code_coverage.txt $UNIT_TESTS_NAME-*.profraw $UNIT_TESTS_NAME.profdata vgcore* cmake-build-debug *.a libr*
+    rm -rf $PROGRAM_NAME $SERVER_NAME $GATEWAY_NAME $BENCH_NAME r-engine r-engine__* $UNIT_TESTS_NAME plugins code_coverage.txt $UNIT_TESTS_NAME-*.profraw $UNIT_TESTS_NAME.profdata vgcore* cmake-build-debug *.a libr*
 }
 
 for args in "$@"
@@ -85,10 +109,13 @@ USAGE:
 ARGUMENTS:
       $0 [-h|--help]    displays this message
       $0 [-d|--debug]   debug flags compilation
+      $0 [-s|--server]  builds the headless $SERVER_NAME (Linux)
+      $0 [-g|--gateway] builds the $GATEWAY_NAME (Linux)
+      $0 [-b|--bench]   builds and runs the $BENCH_NAME micro benchmarks
       $0 [-c|--clean]   clean the project
       $0 [-f|--fclean]  fclean the project
+      $0 [-t|--tests]   builds and runs the unit tests
 EOF
-      # $0 [-t|--tests]   run unit tests
         exit 0
         ;;
     -c|--clean)
@@ -102,9 +129,18 @@ EOF
     -d|--debug)
         _debug
         ;;
-    # -t|--tests)
-    #     _tests_run
-    #     ;;
+    -s|--server)
+        _server
+        ;;
+    -g|--gateway)
+        _gateway
+        ;;
+    -b|--bench)
+        _bench_run
+        ;;
+    -t|--tests)
+        _tests_run
+        ;;
     -r|--re)
         _fclean
         _all
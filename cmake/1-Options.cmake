@@ -33,5 +33,6 @@ endif()
 #######################################
 
 option(ENABLE_TESTS "Enable building tests" OFF)
+option(ENABLE_BENCHMARKS "Enable building r-type-bench" OFF)
 
 #######################################
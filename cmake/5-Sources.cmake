@@ -1,12 +1,55 @@
 #######################################
 
-file(GLOB_RECURSE SRC_R_TYPE "src/*.cpp")
-if(NOT SRC_R_TYPE)
+file(GLOB_RECURSE SRC_R_TYPE_ALL "src/*.cpp")
+if(NOT SRC_R_TYPE_ALL)
     message(FATAL_ERROR "No source files found under src/ — check path or globs.")
 endif()
 
 #######################################
 
+# engine-independent building blocks (pools, codecs, kernels), shared by the benchmarks and unit tests
+file(GLOB_RECURSE SRC_R_TYPE_CORE "src/core/*.cpp")
+
+# sources of the dedicated server only (POSIX socket, server main)
+file(GLOB_RECURSE SRC_R_TYPE_SERVER_ONLY "src/server/*.cpp")
+
+# sources of the gateway only (epoll loop, gateway main)
+file(GLOB_RECURSE SRC_R_TYPE_GATEWAY_ONLY "src/gateway/*.cpp")
+
+# sources of the client only: window, UI, audio-only and rendering-only plugins
+set(SRC_R_TYPE_CLIENT_ONLY
+    "${CMAKE_CURRENT_SOURCE_DIR}/src/Main.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/src/plugins/debug.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/src/plugins/map.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/src/plugins/menu.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/src/plugins/particles.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/src/plugins/pause.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/src/plugins/settings.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/src/plugins/ui_sfx.cpp"
+)
+
+set(SRC_R_TYPE ${SRC_R_TYPE_ALL})
+list(REMOVE_ITEM SRC_R_TYPE ${SRC_R_TYPE_SERVER_ONLY} ${SRC_R_TYPE_GATEWAY_ONLY})
+
+set(SRC_R_TYPE_SERVER ${SRC_R_TYPE_ALL})
+list(REMOVE_ITEM SRC_R_TYPE_SERVER ${SRC_R_TYPE_CLIENT_ONLY} ${SRC_R_TYPE_GATEWAY_ONLY})
+
+# the gateway shares the TCP framing with the server, and nothing of the game
+set(SRC_R_TYPE_GATEWAY
+    ${SRC_R_TYPE_GATEWAY_ONLY}
+    "${CMAKE_CURRENT_SOURCE_DIR}/src/server/tcp_frame.cpp"
+)
+
+# both sides of the gateway protocol, without a main: the unit tests run them over loopback
+set(SRC_R_TYPE_GATEWAY_PROTOCOL
+    "${CMAKE_CURRENT_SOURCE_DIR}/src/gateway/gateway.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/src/server/gateway_link.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/src/server/gateway_registration.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/src/server/tcp_frame.cpp"
+)
+
+#######################################
+
 set(INCLUDE_R_TYPE
     "${CMAKE_CURRENT_SOURCE_DIR}/include"
     "${CMAKE_CURRENT_SOURCE_DIR}/external/R-Engine/include"
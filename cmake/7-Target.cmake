@@ -8,28 +8,51 @@ endif()
 
 ########################################
 
-add_executable(${R_TYPE_TARGET_NAME} ${SRC_R_TYPE})
-target_include_directories(${R_TYPE_TARGET_NAME} PRIVATE ${INCLUDE_R_TYPE})
+function(configure_r_type_target target)
+    target_include_directories(${target} PRIVATE ${INCLUDE_R_TYPE})
 
-########################################
+    find_package(Threads REQUIRED)
+    target_link_libraries(${target} PRIVATE Threads::Threads)
 
-if(TARGET r-engine)
-    target_link_libraries(${R_TYPE_TARGET_NAME} PRIVATE r-engine)
-else()
-    find_library(R_ENGINE_LIB NAMES r-engine r_engine 
-        PATHS "${CMAKE_CURRENT_SOURCE_DIR}/lib" "${CMAKE_CURRENT_BINARY_DIR}/lib" 
-        NO_DEFAULT_PATH)
-    if(R_ENGINE_LIB)
-        target_link_libraries(${R_TYPE_TARGET_NAME} PRIVATE ${R_ENGINE_LIB})
-        message(STATUS "Linked ${R_TYPE_TARGET_NAME} against found library: ${R_ENGINE_LIB}")
+    if(TARGET r-engine)
+        target_link_libraries(${target} PRIVATE r-engine)
     else()
-        message(WARNING "r-engine target/library not found. If you expected external/R-Engine to be built, ensure it's present as a submodule or installed. Build may fail if r-engine symbols are required.")
+        find_library(R_ENGINE_LIB NAMES r-engine r_engine 
+            PATHS "${CMAKE_CURRENT_SOURCE_DIR}/lib" "${CMAKE_CURRENT_BINARY_DIR}/lib" 
+            NO_DEFAULT_PATH)
+        if(R_ENGINE_LIB)
+            target_link_libraries(${target} PRIVATE ${R_ENGINE_LIB})
+            message(STATUS "Linked ${target} against found library: ${R_ENGINE_LIB}")
+        else()
+            message(WARNING "r-engine target/library not found. If you expected external/R-Engine to be built, ensure it's present as a submodule or installed. Build may fail if r-engine symbols are required.")
+        endif()
     endif()
-endif()
+
+    apply_compiler_warnings(${target})
+    apply_linker_optimizations(${target})
+endfunction()
+
+########################################
+
+add_executable(${R_TYPE_TARGET_NAME} ${SRC_R_TYPE})
+configure_r_type_target(${R_TYPE_TARGET_NAME})
 
 #######################################
 
-apply_compiler_warnings(${R_TYPE_TARGET_NAME})
-apply_linker_optimizations(${R_TYPE_TARGET_NAME})
+# headless dedicated server: simulation plugins only, no window, GPU, audio or UI
+if(CMAKE_SYSTEM_NAME STREQUAL "Linux")
+    add_executable(r-type-server ${SRC_R_TYPE_SERVER})
+    configure_r_type_target(r-type-server)
+
+    # routes clients to the least loaded r-type-server; plain sockets and the protocol headers, no engine
+    add_executable(r-type-gateway ${SRC_R_TYPE_GATEWAY})
+    target_include_directories(r-type-gateway PRIVATE "${CMAKE_CURRENT_SOURCE_DIR}/include")
+    find_package(Threads REQUIRED)
+    target_link_libraries(r-type-gateway PRIVATE Threads::Threads)
+    apply_compiler_warnings(r-type-gateway)
+    apply_linker_optimizations(r-type-gateway)
+else()
+    message(STATUS "INFO: r-type-server and r-type-gateway are only built on Linux")
+endif()
 
 #######################################
@@ -0,0 +1,15 @@
+#######################################
+
+# micro benchmarks of the core building blocks, run with ./build.sh --bench
+if(ENABLE_BENCHMARKS)
+    file(GLOB_RECURSE SRC_R_TYPE_BENCH "bench/*.cpp")
+
+    add_executable(r-type-bench ${SRC_R_TYPE_BENCH} ${SRC_R_TYPE_CORE})
+    configure_r_type_target(r-type-bench)
+
+    if(NOT CMAKE_BUILD_TYPE STREQUAL "Release")
+        message(WARNING "r-type-bench is configured without -DCMAKE_BUILD_TYPE=Release: its numbers will be meaningless")
+    endif()
+endif()
+
+#######################################
@@ -0,0 +1,20 @@
+#######################################
+
+# headless unit tests of the core building blocks, run with ./build.sh --tests or ctest
+if(ENABLE_TESTS)
+    enable_testing()
+
+    file(GLOB_RECURSE SRC_UNIT_TESTS "tests/*.cpp")
+
+    add_executable(unit_tests ${SRC_UNIT_TESTS} ${SRC_R_TYPE_CORE})
+    configure_r_type_target(unit_tests)
+
+    # the gateway loop is epoll-based, so its loopback test only runs where the gateway is built
+    if(CMAKE_SYSTEM_NAME STREQUAL "Linux")
+        target_sources(unit_tests PRIVATE ${SRC_R_TYPE_GATEWAY_PROTOCOL})
+    endif()
+
+    add_test(NAME unit_tests COMMAND unit_tests)
+endif()
+
+#######################################
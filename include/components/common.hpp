@@ -2,6 +2,8 @@
 
 #include <R-Engine/Maths/Vec.hpp>
 
+#include <vector>
+
 /**
  * @brief Represents the velocity of an entity.
  * @details The movement_system in GameplayPlugin uses this to update positions.
@@ -10,6 +12,21 @@ struct Velocity {
         r::Vec3f value;
 };
 
+/**
+ * @brief Smooths the Transform3d of an entity moved by a reduced-rate (tiered) system.
+ * @details The system writes the pose it computed in `target_*` and restarts the blend from the
+ * pose on screen. tier_interpolation_system in GameplayPlugin blends towards the target over
+ * `duration`, the time until the system comes back, so the entity keeps moving every frame.
+ */
+struct TierInterpolated {
+        r::Vec3f from_position;
+        r::Vec3f from_rotation;
+        r::Vec3f target_position;
+        r::Vec3f target_rotation;
+        float elapsed = 0.0f;
+        float duration = 0.0f; ///< 0 shows the target as is
+};
+
 /**
  * @brief Defines a spherical collider for collision detection.
  */
@@ -18,6 +35,52 @@ struct Collider {
         r::Vec3f offset = {0.0f, 0.0f, 0.0f};
 };
 
+/**
+ * @brief Elongates the Collider of a projectile into a capsule along `half_axis`.
+ * @details The capsule's segment runs from center - half_axis to center + half_axis, with
+ * Collider::radius as its thickness. Used by projectiles whose mesh is much longer than it is wide.
+ */
+struct CapsuleCollider {
+        r::Vec3f half_axis;
+};
+
+/**
+ * @brief What happens to a projectile that hits a part of a compound collider.
+ */
+enum class HitRole {
+    Hull,      ///< Regular damage
+    WeakPoint, ///< Multiplied damage
+    Armor,     ///< Absorbs the projectile, no damage
+    Shield,    ///< Absorbs the projectile, no damage (shield plating drawn on the model)
+};
+
+/**
+ * @brief One shape of a CompoundCollider, positioned relative to the entity like Collider::offset.
+ */
+struct ColliderPart {
+        enum class Shape {
+            Sphere,  ///< `offset` is the center
+            Capsule, ///< Segment from `offset` to `extent`
+            Box,     ///< Axis-aligned, `offset` is the center and `extent` the half size
+        };
+
+        Shape shape = Shape::Sphere;
+        HitRole role = HitRole::Hull;
+        r::Vec3f offset = {0.0f, 0.0f, 0.0f};
+        r::Vec3f extent = {0.0f, 0.0f, 0.0f};
+        float radius = 0.0f;
+};
+
+/**
+ * @brief Multi-part hit zones for large entities (bosses).
+ * @details The entity's Collider is the bounding sphere and must enclose every part: it is
+ * tested first, and the parts are only tested on a bound hit. Parts are tested in order and
+ * the first one hit wins, so list weak points before the armor that surrounds them.
+ */
+struct CompoundCollider {
+        std::vector<ColliderPart> parts;
+};
+
 /**
  * @brief Manages the health of an entity.
  */
@@ -1,7 +1,10 @@
 #pragma once
 
+#include "R-Engine/ECS/Entity.hpp"
 #include "R-Engine/Maths/Vec.hpp"
 
+#include <cstddef>
+
 /* -- Enemy Marker Components -- */
 
 struct Enemy {
@@ -21,12 +24,34 @@ struct SineWaveEnemy {
 
 struct HomingEnemy {
         float turn_speed = 1.5f; /* Controls how quickly the enemy can turn towards the player */
+        r::ecs::Entity target = r::ecs::NULL_ENTITY; ///< Player being chased, re-evaluated every few ticks
+};
+
+/**
+ * @brief Moves the entity along a baked level path instead of integrating a Velocity.
+ * @details Formation members share a path and spawn `formation_spacing` apart (FormationQueue),
+ * so `distance` is never negative.
+ */
+struct PathFollower {
+        std::size_t path = 0; ///< Index in LevelPaths
+        float distance = 0.0f;
+        float speed = 1.0f;
+};
+
+/**
+ * @brief Health-derived boss phase, refreshed on HealthChangedEvent instead of polling Health every tick.
+ */
+struct BossPhase {
+        bool enraged = false; ///< Health at or below half
 };
 
 /* -- Boss Behavior "Tag" Components -- */
 
 struct VerticalPatrolBoss {
 };
+/**
+ * @brief Driven by its boss script (see EnemyPlugin), which owns the timing of every phase.
+ */
 struct HomingAttackBoss {
         enum class State {
             Entering,
@@ -34,9 +59,8 @@ struct HomingAttackBoss {
             Attacking,
         };
 
-        State current_state = State::Entering;
-        float state_timer = 0.0f;///< Timer to control how long each state lasts
-        r::Vec3f target_position;///< The position the boss is trying to move to
+        State current_state = State::Entering; ///< Current phase, written by the script
+        bool exposed = false;                  ///< Shields are down: moves faster and attacks longer
 };
 struct TurretBoss {
 };
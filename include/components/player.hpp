@@ -8,8 +8,18 @@ struct Player {
         float wave_cannon_charge_timer = 0.0f;
 };
 
+/**
+ * @brief The Force pod. It is a top-level entity that always carries a Velocity: attaching,
+ * launching and recalling only flip `state`, so the entity never changes archetype.
+ */
 struct Force {
-        bool is_attached = true;
+        enum class State {
+            Attached,  ///< Glued in front of its owner, follows it every frame
+            Launched,  ///< Flying on its own, shoots autonomously
+            Recalling, ///< Homing back to its owner, reattaches when close enough
+        };
+
+        State state = State::Attached;
         bool is_front_attachment = true; /* true = front, false = rear */
         r::ecs::Entity owner = r::ecs::NULL_ENTITY;
 };
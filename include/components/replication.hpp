@@ -0,0 +1,91 @@
+#pragma once
+
+#include <R-Engine/Components/Transform3d.hpp>
+
+#include <components/common.hpp>
+#include <components/enemy.hpp>
+#include <components/player.hpp>
+#include <core/bit_stream.hpp>
+#include <core/net_traits.hpp>
+
+#include <cstdint>
+
+/**
+ * @brief How the replicated components go on the wire, see net::Traits.
+ * @details Snapshot records (EntityState) are made of these components and send them through these
+ * traits. Gameplay happens on the XY plane, so Z is left out. Entity references (Force::owner) are
+ * left out as well: they only mean something on the server until they are sent as NetIds.
+ */
+
+/**
+ * @brief Wire precision of the replicated values.
+ * @details Projectiles are despawned past |x| = 100 and the playfield is about 17 units high, so the
+ * ranges keep some margin; positions outside them are clamped. Health is clamped to 0..1023, above
+ * every boss's maximum. Velocities stay under the Force recall speed.
+ */
+namespace snapshot_quantization {
+inline constexpr unsigned KIND_BITS = 3;
+inline constexpr QuantizedRange X{-128.0f, 128.0f, 16};
+inline constexpr QuantizedRange Y{-64.0f, 64.0f, 15};
+inline constexpr QuantizedRange VELOCITY{-32.0f, 32.0f, 12};
+inline constexpr std::int32_t HEALTH_MAX = 1023;
+
+/**
+ * @brief Changed positions and velocities within this many bits of steps from their baseline go as a distance, see net::Quantized.
+ * @details Snapshot baselines are extrapolated along their velocity (encode_snapshot()), so what is
+ * left of a position is a correction: half a unit either way on 8 bits. A velocity that turns
+ * smoothly moves a few steps a tick.
+ */
+inline constexpr unsigned POSITION_DELTA_BITS = 8;
+inline constexpr unsigned VELOCITY_DELTA_BITS = 6;
+
+static_assert(X.step() < 0.004f && Y.step() < 0.004f, "Position steps must stay well under a pixel");
+
+/**
+ * @brief Codecs of the replicated positions and velocities.
+ */
+using PositionX = net::Quantized<X, POSITION_DELTA_BITS>;
+using PositionY = net::Quantized<Y, POSITION_DELTA_BITS>;
+using Speed = net::Quantized<VELOCITY, VELOCITY_DELTA_BITS>;
+}// namespace snapshot_quantization
+
+template<>
+struct net::Traits<r::Transform3d> {
+        using fields = Fields<
+            Field<snapshot_quantization::PositionX, &r::Transform3d::position, &r::Vec3f::x>,
+            Field<snapshot_quantization::PositionY, &r::Transform3d::position, &r::Vec3f::y>>;
+};
+
+template<>
+struct net::Traits<Velocity> {
+        using fields = Fields<
+            Field<snapshot_quantization::Speed, &Velocity::value, &r::Vec3f::x>,
+            Field<snapshot_quantization::Speed, &Velocity::value, &r::Vec3f::y>>;
+};
+
+template<>
+struct net::Traits<Health> {
+        using fields = Fields<
+            Field<Clamped<0, snapshot_quantization::HEALTH_MAX>, &Health::current>,
+            Field<Clamped<0, snapshot_quantization::HEALTH_MAX>, &Health::max>>;
+};
+
+template<>
+struct net::Traits<Force> {
+        using fields = Fields<
+            Field<Unsigned<2>, &Force::state>,
+            Field<Unsigned<1>, &Force::is_front_attachment>>;
+};
+
+template<>
+struct net::Traits<HomingAttackBoss> {
+        using fields = Fields<
+            Field<Unsigned<2>, &HomingAttackBoss::current_state>,
+            Field<Unsigned<1>, &HomingAttackBoss::exposed>>;
+};
+
+static_assert(net::max_bits<r::Transform3d> == 31);
+static_assert(net::max_bits<Velocity> == 24);
+static_assert(net::max_bits<Health> == 20);
+static_assert(net::max_bits<Force> == 3);
+static_assert(net::max_bits<HomingAttackBoss> == 3);
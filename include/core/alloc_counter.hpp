@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Number of global `operator new` calls since startup.
+ * @details Only counted in R_TYPE_DEBUG builds, which replace the global allocation functions;
+ * always 0 otherwise. Implementation lives in the source file `src/core/alloc_counter.cpp`.
+ */
+std::uint64_t global_allocations() noexcept;
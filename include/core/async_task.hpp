@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+
+/**
+ * @brief Runs one job at a time on a dedicated thread, so it overlaps with what the caller does next.
+ * @details Meant for per-frame work that can run behind the engine's rendering: launch() it at the
+ * end of UPDATE, wait() for it before touching its data again on the next frame. The job is a plain
+ * function pointer and context, the same shape as JobPool chunks, so launching never allocates.
+ *
+ * The Particles resource holds one and the engine stores resources by copy, so copies share the one
+ * thread. Only the last copy to go waits for the running job and joins the thread.
+ * Implementation lives in the source file `src/core/async_task.cpp`.
+ */
+class AsyncTask
+{
+    public:
+        using TaskFn = void (*)(void *context);
+
+        AsyncTask();
+
+        /**
+         * @brief Waits for the previous job, then starts `fn(context)` on the task thread.
+         */
+        void launch(TaskFn fn, void *context);
+
+        /**
+         * @brief Blocks until the launched job (if any) returned. Exceptions thrown by the job are rethrown here.
+         */
+        void wait() const;
+
+        bool busy() const noexcept;
+
+    private:
+        struct State;
+
+        std::shared_ptr<State> _state;
+};
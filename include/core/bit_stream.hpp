@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * @brief A float range sent as a fixed number of bits: `bits`-bit steps from `min` to `max`.
+ * @details Values outside the range are clamped, so only values inside it round-trip, within half a step.
+ * The arithmetic is done in double so the error bound holds up to the float rounding of the result.
+ */
+struct QuantizedRange {
+        float min;
+        float max;
+        unsigned bits;///< 1 to 31
+
+        constexpr std::uint32_t steps() const noexcept
+        {
+            return (1u << bits) - 1;
+        }
+
+        constexpr float step() const noexcept
+        {
+            return (max - min) / static_cast<float>(steps());
+        }
+
+        constexpr std::uint32_t quantize(float value) const noexcept
+        {
+            if (!(value > min)) {
+                return 0; /* Also NaN */
+            }
+            if (value >= max) {
+                return steps();
+            }
+            return static_cast<std::uint32_t>((static_cast<double>(value) - static_cast<double>(min)) / precise_step() + 0.5);
+        }
+
+        constexpr float dequantize(std::uint32_t quantized) const noexcept
+        {
+            return quantized >= steps() ? max : static_cast<float>(static_cast<double>(min) + quantized * precise_step());
+        }
+
+    private:
+        constexpr double precise_step() const noexcept
+        {
+            return (static_cast<double>(max) - static_cast<double>(min)) / steps();
+        }
+};
+
+/**
+ * @brief Appends values of any width up to 32 bits to a byte buffer, most significant bit first.
+ * @details `Bytes` is anything with `push_back(std::uint8_t)`: a byte vector, a PacketPayload...
+ * Bytes are appended as soon as they are complete; flush() pads and appends the last, partial one.
+ * The bytes already in the buffer are left alone, so a writer can follow a byte-aligned header
+ * written by other means.
+ */
+template<typename Bytes>
+class BasicBitWriter
+{
+    public:
+        explicit BasicBitWriter(Bytes &out) noexcept : _out(out)
+        {
+        }
+
+        /**
+         * @brief Writes the `bits` low bits of `value`, 0 to 32.
+         */
+        void write(std::uint32_t value, unsigned bits)
+        {
+            if (bits == 0) {
+                return;
+            }
+            _pending = (_pending << bits) | (value & ((std::uint64_t{1} << bits) - 1));
+            _pending_bits += bits;
+            _bit_count += bits;
+            /* At most 7 + 32 bits pending: the 64-bit accumulator never overflows */
+            while (_pending_bits >= 8) {
+                _pending_bits -= 8;
+                _out.push_back(static_cast<std::uint8_t>(_pending >> _pending_bits));
+            }
+            _pending &= (std::uint64_t{1} << _pending_bits) - 1;
+        }
+
+        void write(bool value)
+        {
+            write(value ? 1u : 0u, 1);
+        }
+
+        void write(float value, const QuantizedRange &range)
+        {
+            write(range.quantize(value), range.bits);
+        }
+
+        /**
+         * @brief Pads the pending bits with zeros to a whole byte and appends it.
+         */
+        void flush()
+        {
+            if (_pending_bits != 0) {
+                _out.push_back(static_cast<std::uint8_t>(_pending << (8 - _pending_bits)));
+                _bit_count += 8 - _pending_bits;
+                _pending = 0;
+                _pending_bits = 0;
+            }
+        }
+
+        /**
+         * @brief Bits written so far, flushed or not.
+         */
+        std::size_t bit_count() const noexcept
+        {
+            return _bit_count;
+        }
+
+    private:
+        Bytes &_out;
+        std::uint64_t _pending = 0;
+        unsigned _pending_bits = 0;
+        std::size_t _bit_count = 0;
+};
+
+using BitWriter = BasicBitWriter<std::vector<std::uint8_t>>;
+
+/**
+ * @brief Reads back what a BitWriter wrote.
+ * @details Reading past the end reads zeros and sets failed(), so a decoder can read a whole record
+ * and check once.
+ *
+ * Implementation lives in the source file `src/core/bit_stream.cpp`.
+ */
+class BitReader
+{
+    public:
+        explicit BitReader(std::span<const std::uint8_t> in) noexcept;
+
+        /**
+         * @brief Reads `bits` bits, 0 to 32, into the low bits of the result.
+         */
+        std::uint32_t read(unsigned bits) noexcept;
+        bool read_bool() noexcept;
+        float read(const QuantizedRange &range) noexcept;
+
+        bool failed() const noexcept;
+
+        /**
+         * @brief Bits left, including the padding of the last byte.
+         */
+        std::size_t remaining_bits() const noexcept;
+
+    private:
+        std::span<const std::uint8_t> _in;
+        std::size_t _position = 0;///< In bits
+        bool _failed = false;
+};
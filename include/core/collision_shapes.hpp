@@ -0,0 +1,59 @@
+#pragma once
+
+#include <R-Engine/Maths/Vec.hpp>
+
+/**
+ * @brief Overlap tests between a sphere (bullets, beams) and the primitive shapes used by colliders.
+ * @details Every test works on squared distances, no square root is taken.
+ *
+ * Implementation lives in the source file `src/core/collision_shapes.cpp`.
+ */
+namespace shapes {
+
+bool sphere_vs_sphere(const r::Vec3f &center, float radius, const r::Vec3f &other_center, float other_radius) noexcept;
+
+/**
+ * @brief Sphere against the capsule swept by a sphere of `capsule_radius` along [seg_a, seg_b].
+ */
+bool sphere_vs_capsule(const r::Vec3f &center, float radius, const r::Vec3f &seg_a, const r::Vec3f &seg_b, float capsule_radius) noexcept;
+
+/**
+ * @brief Sphere against an axis-aligned box given by its center and half extents.
+ */
+bool sphere_vs_aabb(const r::Vec3f &center, float radius, const r::Vec3f &box_center, const r::Vec3f &half_extents) noexcept;
+
+/**
+ * @brief Squared distance from `point` to the segment [seg_a, seg_b].
+ */
+float point_segment_distance_sq(const r::Vec3f &point, const r::Vec3f &seg_a, const r::Vec3f &seg_b) noexcept;
+
+/**
+ * @brief Squared distance between the segments [a0, a1] and [b0, b1].
+ */
+float segment_segment_distance_sq(const r::Vec3f &a0, const r::Vec3f &a1, const r::Vec3f &b0, const r::Vec3f &b1) noexcept;
+
+/* ================================================================================= */
+/* Swept tests */
+/* ================================================================================= */
+
+/**
+ * @brief Volume covered by a moving projectile during one tick: a sphere of `radius` swept from
+ * `start` to `end`, i.e. a capsule. A projectile that did not move has start == end.
+ * @details Targets are treated as static over the tick; only the projectile's motion is swept.
+ */
+struct Sweep {
+        r::Vec3f start;
+        r::Vec3f end;
+        float radius;
+};
+
+bool sweep_vs_sphere(const Sweep &sweep, const r::Vec3f &center, float radius) noexcept;
+bool sweep_vs_capsule(const Sweep &sweep, const r::Vec3f &seg_a, const r::Vec3f &seg_b, float capsule_radius) noexcept;
+
+/**
+ * @brief Swept sphere against an axis-aligned box, tested as the segment against the box grown by
+ * the radius (slightly conservative at the box corners).
+ */
+bool sweep_vs_aabb(const Sweep &sweep, const r::Vec3f &box_center, const r::Vec3f &half_extents) noexcept;
+
+}// namespace shapes
@@ -0,0 +1,32 @@
+#pragma once
+
+/**
+ * @brief Shared setup for the runtime-dispatched SIMD kernels in src/core.
+ * @details Kernels are compiled for their ISA with R_TYPE_TARGET and only called once
+ * cpu_features() reports the ISA as usable by both the CPU and the OS.
+ */
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define R_TYPE_SIMD_X86 1
+    #include <immintrin.h>
+#endif
+
+/* GCC and Clang need the ISA enabled per function; MSVC exposes every intrinsic unconditionally */
+#if defined(__GNUC__) || defined(__clang__)
+    #define R_TYPE_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define R_TYPE_TARGET(isa)
+#endif
+
+struct CpuFeatures {
+        bool sse2 = false;
+        bool avx2 = false;
+        bool fma = false;
+        bool avx512f = false;
+};
+
+/**
+ * @brief Instruction sets of the host CPU, detected once. All false on non-x86 targets.
+ * @details Implementation lives in the source file `src/core/cpu_features.cpp`.
+ */
+const CpuFeatures &cpu_features() noexcept;
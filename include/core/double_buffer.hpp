@@ -0,0 +1,40 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+/**
+ * @brief Two copies of a render snapshot: the producer fills back() while the renderer reads front().
+ * @details publish() makes the back buffer the front one. It is not synchronized: call it at a point
+ * where neither side touches the buffers (e.g. after joining the producing AsyncTask, outside of
+ * rendering). The previous front becomes the next back and is overwritten in place, so steady-state
+ * snapshots reuse their storage.
+ */
+template<typename T>
+class DoubleBuffer
+{
+    public:
+        explicit DoubleBuffer(const T &initial = T{}) : _buffers{initial, initial}
+        {
+        }
+
+        T &back() noexcept
+        {
+            return _buffers[_front ^ 1u];
+        }
+
+        const T &front() const noexcept
+        {
+            return _buffers[_front];
+        }
+
+        void publish() noexcept
+        {
+            _front ^= 1u;
+        }
+
+    private:
+        std::array<T, 2> _buffers;
+        std::size_t _front = 0;
+};
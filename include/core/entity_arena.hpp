@@ -0,0 +1,51 @@
+#pragma once
+
+#include <R-Engine/ECS/Entity.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Sparse-set registry of entities that share a common lifetime (a level, a scene...).
+ * @details Entities are stored densely so releasing the whole set is a single linear pass
+ * followed by an O(1) clear. The sparse index is never cleared: a slot is only valid when the
+ * dense array points back to it, which is what makes clear() constant time.
+ *
+ * Implementation lives in the source file `src/core/entity_arena.cpp`.
+ */
+class EntityArena
+{
+    public:
+        /**
+         * @brief Reserves room for `capacity` entities so tracking never reallocates mid-level.
+         */
+        void reserve(std::size_t capacity);
+
+        /**
+         * @brief Starts tracking an entity. Tracking the same entity twice is a no-op.
+         */
+        void track(r::ecs::Entity entity);
+
+        /**
+         * @brief Stops tracking an entity (swap-remove). Untracked entities are ignored.
+         */
+        void release(r::ecs::Entity entity) noexcept;
+
+        bool contains(r::ecs::Entity entity) const noexcept;
+
+        /**
+         * @brief Forgets every tracked entity in O(1), keeping the reserved capacity.
+         */
+        void clear() noexcept;
+
+        std::size_t size() const noexcept;
+        std::size_t capacity() const noexcept;
+
+        const r::ecs::Entity *begin() const noexcept;
+        const r::ecs::Entity *end() const noexcept;
+
+    private:
+        std::vector<r::ecs::Entity> _dense;
+        std::vector<std::uint32_t> _sparse;
+};
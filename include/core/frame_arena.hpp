@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+/**
+ * @brief Bump allocator for memory that only lives until the end of the frame.
+ * @details Allocations are carved from one preallocated block through a
+ * std::pmr::monotonic_buffer_resource: deallocating is a no-op and reset() makes the whole block
+ * available again. A frame that needs more than the block spills to the heap, which is counted
+ * by overflow_bytes() so the capacity can be tuned.
+ *
+ * Never keep arena memory across frames: that includes ECS events, which the engine copies into
+ * its own queues. A copy is a second handle on the same block, not a second arena: reset() through
+ * any of them reclaims what all of them handed out, so only GameplayPlugin's once-per-frame reset calls it.
+ * Implementation lives in the source file `src/core/frame_arena.cpp`.
+ */
+class FrameArena
+{
+    public:
+        static constexpr std::size_t DEFAULT_CAPACITY = 256 * 1024;
+
+        FrameArena();
+        explicit FrameArena(std::size_t capacity);
+
+        /**
+         * @brief Resource to build `std::pmr` containers and strings on.
+         */
+        std::pmr::memory_resource *resource() const noexcept;
+
+        /**
+         * @brief Releases everything allocated since the last reset.
+         */
+        void reset() noexcept;
+
+        /**
+         * @brief Bytes that did not fit in the block since the last reset.
+         */
+        std::size_t overflow_bytes() const noexcept;
+
+    private:
+        struct State;
+
+        std::shared_ptr<State> _state;
+};
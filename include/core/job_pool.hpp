@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Entity count above which per-entity systems hand their work to the JobPool.
+ * @details Below this, waking the workers costs more than the loop itself.
+ */
+inline constexpr std::size_t PARALLEL_FOR_THRESHOLD = 2048;
+
+/**
+ * @brief Number of entities processed by one job.
+ */
+inline constexpr std::size_t PARALLEL_FOR_GRAIN = 512;
+
+/**
+ * @brief Work-stealing thread pool used by per-entity systems.
+ * @details parallel_for() splits [0, count) into fixed `grain`-sized chunks: chunk boundaries
+ * only depend on `count` and `grain`, never on the number of workers, so a body that writes
+ * only to its own indices produces the same result on any machine.
+ * Each worker starts on its own contiguous run of chunks and steals from the back of the
+ * others once it runs dry. The calling thread takes part in the work.
+ *
+ * Copies share the same workers, as the engine copies resources into its storage; the last copy
+ * to go joins them.
+ * Implementation lives in the source file `src/core/job_pool.cpp`.
+ */
+class JobPool
+{
+    public:
+        using ChunkFn = void (*)(void *context, std::size_t begin, std::size_t end);
+
+        /**
+         * @brief Spawns `worker_count` background threads (0 = hardware concurrency - 1).
+         */
+        explicit JobPool(std::size_t worker_count = 0);
+
+        /**
+         * @brief Number of threads that execute chunks, the calling thread included.
+         */
+        std::size_t concurrency() const noexcept;
+
+        /**
+         * @brief Runs `fn(begin, end)` over [0, count) in `grain`-sized chunks and waits for all of them.
+         * @details Runs inline when there is a single chunk, no worker, or when called from a job.
+         */
+        template<typename F>
+        void parallel_for(std::size_t count, std::size_t grain, F &&fn) const
+        {
+            using Fn = std::remove_reference_t<F>;
+            dispatch(count, grain,
+                [](void *context, std::size_t begin, std::size_t end) { (*static_cast<Fn *>(context))(begin, end); },
+                const_cast<void *>(static_cast<const void *>(std::addressof(fn))));
+        }
+
+        template<typename F>
+        void parallel_for(std::size_t count, F &&fn) const
+        {
+            parallel_for(count, PARALLEL_FOR_GRAIN, std::forward<F>(fn));
+        }
+
+    private:
+        struct State;
+
+        void dispatch(std::size_t count, std::size_t grain, ChunkFn fn, void *context) const;
+
+        std::shared_ptr<State> _state;
+};
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <core/net_traits.hpp>
+#include <core/packet_payload.hpp>
+#include <core/wire.hpp>
+
+#include <cstdint>
+#include <span>
+
+/**
+ * @brief Payloads of the R-Type commands that carry one, described through net::Traits.
+ * @details A payload is a bit stream of its fields, padded to a whole byte. Every message fits the
+ * inline storage of PacketPayload, so building and queuing one never allocates.
+ */
+namespace message {
+
+/**
+ * @brief CMD_INPUT: the PlayerInput bits held this frame.
+ */
+struct Input {
+        std::uint8_t buttons = 0;
+};
+
+/**
+ * @brief CMD_JOIN: the room to join.
+ */
+struct Room {
+        std::uint32_t id = 0;
+};
+
+/**
+ * @brief Reply to CMD_CREATE and CMD_JOIN: the room joined and the seat taken in it.
+ */
+struct Joined {
+        std::uint32_t room = 0;
+        std::uint8_t seat = 0;
+};
+
+/**
+ * @brief CMD_READY, CMD_NOT_READY, CMD_PAUSE, CMD_RESUME and CMD_LEAVE from a room: the seat of the player.
+ */
+struct Seat {
+        std::uint8_t seat = 0;
+};
+
+/**
+ * @brief A packet of `command` carrying `payload`.
+ */
+template<net::Described T>
+rtype::protocol::RTypePacket make(rtype::protocol::RTypeCommand command, const T &payload)
+{
+    static_assert(net::max_bytes<T> <= PacketPayload::INLINE_CAPACITY, "Messages must not need a pooled block");
+    rtype::protocol::RTypePacket packet = wire::make_packet(command);
+    BasicBitWriter<PacketPayload> writer{packet.payload};
+    net::encode(payload, writer);
+    writer.flush();
+    return packet;
+}
+
+/**
+ * @return false if `bytes` is too short for a T. Extra bytes are ignored.
+ */
+template<net::Described T>
+bool read(std::span<const std::uint8_t> bytes, T &payload) noexcept
+{
+    BitReader reader{bytes};
+    net::decode(payload, reader);
+    return !reader.failed();
+}
+
+}// namespace message
+
+template<>
+struct net::Traits<message::Input> {
+        using fields = Fields<Field<Unsigned<8>, &message::Input::buttons>>;
+};
+
+template<>
+struct net::Traits<message::Room> {
+        using fields = Fields<Field<Unsigned<32>, &message::Room::id>>;
+};
+
+template<>
+struct net::Traits<message::Joined> {
+        using fields = Fields<Field<Unsigned<32>, &message::Joined::room>, Field<Unsigned<8>, &message::Joined::seat>>;
+};
+
+template<>
+struct net::Traits<message::Seat> {
+        using fields = Fields<Field<Unsigned<8>, &message::Seat::seat>>;
+};
+
+/* The wire format predates the traits: these sizes are what clients expect */
+static_assert(net::max_bytes<message::Input> == 1);
+static_assert(net::max_bytes<message::Room> == 4);
+static_assert(net::max_bytes<message::Joined> == 5);
+static_assert(net::max_bytes<message::Seat> == 1);
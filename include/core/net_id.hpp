@@ -0,0 +1,142 @@
+#pragma once
+
+#include <R-Engine/ECS/Entity.hpp>
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+inline constexpr unsigned NET_INDEX_BITS = 12;
+inline constexpr unsigned NET_GENERATION_BITS = 4;
+inline constexpr unsigned NET_ID_BITS = NET_INDEX_BITS + NET_GENERATION_BITS;
+
+/**
+ * @brief Network identity of a replicated entity: a slot index and the generation of that slot.
+ * @details Server r::ecs::Entity values mean nothing to a client and are too wide for the wire. A
+ * NetId fits NET_ID_BITS, and the generation changes whenever a slot is reused, so a stale NetId
+ * held by a client does not silently designate the next entity of its slot. Index 0 is never
+ * assigned: the default NetId is "none".
+ */
+struct NetId {
+        std::uint16_t value = 0;
+
+        static constexpr std::uint16_t INDEX_MASK = (1u << NET_INDEX_BITS) - 1;
+        static constexpr std::uint16_t GENERATION_MASK = (1u << NET_GENERATION_BITS) - 1;
+
+        static constexpr NetId make(std::uint16_t index, std::uint16_t generation) noexcept
+        {
+            return {static_cast<std::uint16_t>(((generation & GENERATION_MASK) << NET_INDEX_BITS) | (index & INDEX_MASK))};
+        }
+
+        constexpr std::uint16_t index() const noexcept
+        {
+            return value & INDEX_MASK;
+        }
+
+        constexpr std::uint16_t generation() const noexcept
+        {
+            return static_cast<std::uint16_t>(value >> NET_INDEX_BITS);
+        }
+
+        constexpr explicit operator bool() const noexcept
+        {
+            return index() != 0;
+        }
+
+        constexpr auto operator<=>(const NetId &) const = default;
+};
+
+/**
+ * @brief Replicated entities alive at once, index 0 excluded.
+ */
+inline constexpr std::size_t NET_ID_CAPACITY = NetId::INDEX_MASK;
+
+/**
+ * @brief Server side: the NetId of every replicated entity, assigned once per snapshot.
+ * @details Each snapshot goes begin_snapshot(), replicate() for every entity in it, end_snapshot().
+ * Entities that were not replicated by end_snapshot() are gone: their slot gets a new generation and
+ * waits `quarantine` snapshots before being reused, so no baseline a client may still diff against
+ * holds the old entity under the same NetId. Lookups by entity go through a sparse array, as in
+ * EntityArena.
+ *
+ * Implementation lives in the source file `src/core/net_id.cpp`.
+ */
+class ReplicationRegistry
+{
+    public:
+        explicit ReplicationRegistry(std::size_t quarantine);
+
+        void begin_snapshot() noexcept;
+
+        /**
+         * @brief NetId of `entity`, assigned on its first snapshot. Marks it as alive in this snapshot.
+         * @return A null NetId if all NET_ID_CAPACITY ids are in use or in quarantine: the entity is left out of this snapshot.
+         */
+        NetId replicate(r::ecs::Entity entity);
+
+        void end_snapshot();
+
+        /**
+         * @return The NetId of `entity`, null if it is not replicated.
+         */
+        NetId find(r::ecs::Entity entity) const noexcept;
+
+        std::size_t size() const noexcept;
+
+    private:
+        struct Slot {
+                r::ecs::Entity entity = r::ecs::NULL_ENTITY;
+                std::uint16_t generation = 0;
+                std::uint32_t seen = 0; ///< Snapshot the entity was last replicated in
+        };
+        struct Quarantined {
+                std::uint16_t index;
+                std::uint32_t until; ///< Snapshot from which the index can be reused
+        };
+
+        std::size_t _quarantine;
+        std::uint32_t _snapshot = 0;
+        std::vector<Slot> _slots = std::vector<Slot>(1); ///< By NetId index, [0] unused
+        std::vector<std::uint16_t> _live;                ///< Indices of the replicated entities
+        std::vector<std::uint16_t> _free;
+        std::deque<Quarantined> _quarantined;
+        std::vector<NetId> _sparse;                      ///< By entity
+};
+
+/**
+ * @brief Client side: the local entity standing for each NetId, found in O(1).
+ * @details A lookup with a NetId of another generation than the bound one misses, so stale ids never
+ * reach the entity that replaced theirs.
+ *
+ * Implementation lives in the source file `src/core/net_id.cpp`.
+ */
+class NetEntityMap
+{
+    public:
+        NetEntityMap();
+
+        /**
+         * @brief Binds `id` to `entity`, replacing whatever its slot was bound to.
+         */
+        void bind(NetId id, r::ecs::Entity entity) noexcept;
+
+        /**
+         * @return The entity `id` was bound to, NULL_ENTITY if it was not.
+         */
+        r::ecs::Entity unbind(NetId id) noexcept;
+
+        /**
+         * @return The entity bound to `id`, NULL_ENTITY if none.
+         */
+        r::ecs::Entity find(NetId id) const noexcept;
+
+    private:
+        struct Binding {
+                NetId id;
+                r::ecs::Entity entity = r::ecs::NULL_ENTITY;
+        };
+
+        std::vector<Binding> _bindings; ///< By NetId index
+};
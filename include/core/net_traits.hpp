@@ -0,0 +1,438 @@
+#pragma once
+
+#include <core/bit_stream.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Compile-time description of what a type sends over the network, and the code generated from it.
+ * @details A type is described by specializing net::Traits with the list of its replicated fields:
+ *
+ *     template<> struct net::Traits<Health> {
+ *         using fields = net::Fields<
+ *             net::Field<net::Clamped<0, 1023>, &Health::current>,
+ *             net::Field<net::Clamped<0, 1023>, &Health::max>>;
+ *     };
+ *
+ * Each field names its codec and the member path leading to it (`&Transform3d::position, &Vec3f::x`).
+ * Codecs have a fixed width, so the size of a type is known at compile time (max_bits, max_bytes),
+ * and they turn a value into its wire form, which is what diff() compares: a change smaller than the
+ * codec's precision is not a change. A member whose own type is described (a component inside a
+ * snapshot record) is listed as Nested and replicated through its own Traits. Every function below
+ * unrolls over the field list at compile time; there is no virtual call or runtime lookup.
+ *
+ * Field masks give bit `i` to field `i`, in declaration order; a Nested member takes one bit.
+ */
+namespace net {
+
+/* ================================================================================= */
+/* Codecs */
+/* ================================================================================= */
+
+/**
+ * @brief Unsigned integers, enums and bools on `Bits` bits. Higher bits are dropped.
+ */
+template<unsigned Bits>
+struct Unsigned {
+        static_assert(Bits >= 1 && Bits <= 32);
+        static constexpr unsigned BITS = Bits;
+
+        template<typename T>
+        static constexpr std::uint32_t to_wire(T value) noexcept
+        {
+            std::uint32_t raw = 0;
+            if constexpr (std::is_enum_v<T>) {
+                raw = static_cast<std::uint32_t>(std::to_underlying(value));
+            } else {
+                raw = static_cast<std::uint32_t>(value);
+            }
+            return static_cast<std::uint32_t>(raw & ((std::uint64_t{1} << Bits) - 1));
+        }
+
+        template<typename T>
+        static constexpr T from_wire(std::uint32_t wire) noexcept
+        {
+            if constexpr (std::is_same_v<T, bool>) {
+                return wire != 0;
+            } else {
+                return static_cast<T>(wire);
+            }
+        }
+};
+
+/**
+ * @brief Integers clamped to [Min, Max], on as few bits as the range needs.
+ */
+template<std::int64_t Min, std::int64_t Max>
+struct Clamped {
+        static_assert(Min < Max && Max - Min <= UINT32_MAX);
+        static constexpr unsigned BITS = static_cast<unsigned>(std::bit_width(static_cast<std::uint64_t>(Max - Min)));
+
+        template<typename T>
+        static constexpr std::uint32_t to_wire(T value) noexcept
+        {
+            const auto wide = static_cast<std::int64_t>(value);
+            return static_cast<std::uint32_t>((wide < Min ? Min : (wide > Max ? Max : wide)) - Min);
+        }
+
+        template<typename T>
+        static constexpr T from_wire(std::uint32_t wire) noexcept
+        {
+            return static_cast<T>(Min + static_cast<std::int64_t>(wire));
+        }
+};
+
+/**
+ * @brief Floats quantized over `Range`, see QuantizedRange.
+ * @details With `DeltaBits`, encode_delta() sends a changed value as its signed distance in steps from
+ * the previous one when that fits `DeltaBits` bits, which is what slowly changing values do from one
+ * snapshot to the next. A flag bit tells it apart from a full value.
+ */
+template<QuantizedRange Range, unsigned DeltaBits = 0>
+struct Quantized {
+        static_assert(DeltaBits < Range.bits);
+        static constexpr unsigned BITS = Range.bits;
+        static constexpr unsigned DELTA_BITS = DeltaBits;
+
+        template<typename T>
+        static constexpr std::uint32_t to_wire(T value) noexcept
+        {
+            return Range.quantize(value);
+        }
+
+        template<typename T>
+        static constexpr T from_wire(std::uint32_t wire) noexcept
+        {
+            return static_cast<T>(Range.dequantize(wire));
+        }
+};
+
+/* ================================================================================= */
+/* Descriptions */
+/* ================================================================================= */
+
+namespace detail {
+
+template<auto First, auto... Rest, typename T>
+constexpr auto &walk(T &object) noexcept
+{
+    if constexpr (sizeof...(Rest) == 0) {
+        return object.*First;
+    } else {
+        return walk<Rest...>(object.*First);
+    }
+}
+
+}// namespace detail
+
+/**
+ * @brief One replicated field: its codec and the member pointers leading to it from the described type.
+ */
+template<typename Codec, auto... Path>
+struct Field {
+        static_assert(sizeof...(Path) > 0);
+        using codec = Codec;
+
+        template<typename T>
+        static constexpr auto &of(T &object) noexcept
+        {
+            return detail::walk<Path...>(object);
+        }
+};
+
+/**
+ * @brief A member whose type is described itself, replicated through its own Traits.
+ * @details encode() and decode() send all of its fields. In a delta (encode_delta()) its bit only
+ * says that something in it changed; its own field mask and changed fields follow.
+ */
+template<auto... Path>
+struct Nested {
+        static_assert(sizeof...(Path) > 0);
+
+        template<typename T>
+        static constexpr auto &of(T &object) noexcept
+        {
+            return detail::walk<Path...>(object);
+        }
+};
+
+template<typename... F>
+struct Fields {
+};
+
+/**
+ * @brief Specialize with `using fields = Fields<...>;` to describe a type.
+ */
+template<typename T>
+struct Traits;
+
+template<typename T>
+concept Described = requires { typename Traits<T>::fields; };
+
+using Mask = std::uint32_t;
+
+namespace detail {
+
+template<typename F>
+inline constexpr bool is_nested = false;
+
+template<auto... Path>
+inline constexpr bool is_nested<Nested<Path...>> = true;
+
+/**
+ * @brief Type of the member `F` designates in a T.
+ */
+template<typename T, typename F>
+using member_t = std::remove_cvref_t<decltype(F::of(std::declval<T &>()))>;
+
+template<typename T, typename Fn, typename... F>
+constexpr void for_each_field(Fields<F...>, Fn &&fn)
+{
+    std::size_t index = 0;
+    (fn(F{}, index++), ...);
+}
+
+template<typename... F>
+constexpr std::size_t count(Fields<F...>) noexcept
+{
+    return sizeof...(F);
+}
+
+/**
+ * @brief Bits of a relative value in a delta (Quantized::DELTA_BITS), 0 if the codec always sends full values.
+ */
+template<typename Codec>
+constexpr unsigned relative_bits() noexcept
+{
+    if constexpr (requires { Codec::DELTA_BITS; }) {
+        return Codec::DELTA_BITS;
+    } else {
+        return 0;
+    }
+}
+
+/**
+ * @brief Writes the changed wire value `to` of a field in a delta: relative to `from` if its codec allows it and the distance fits.
+ */
+template<typename Codec, typename Bytes>
+void write_changed(std::uint32_t from, std::uint32_t to, BasicBitWriter<Bytes> &writer)
+{
+    constexpr unsigned relative = relative_bits<Codec>();
+    if constexpr (relative != 0) {
+        constexpr std::int64_t reach = std::int64_t{1} << (relative - 1);
+        const std::int64_t distance = static_cast<std::int64_t>(to) - static_cast<std::int64_t>(from);
+        const bool near = distance >= -reach && distance < reach;
+        writer.write(near ? 1 : 0, 1);
+        if (near) {
+            writer.write(static_cast<std::uint32_t>(distance + reach), relative);
+            return;
+        }
+    }
+    writer.write(to, Codec::BITS);
+}
+
+/**
+ * @brief Reads what write_changed() wrote, `from` being the wire value the field held before.
+ */
+template<typename Codec>
+std::uint32_t read_changed(std::uint32_t from, BitReader &reader) noexcept
+{
+    constexpr unsigned relative = relative_bits<Codec>();
+    if constexpr (relative != 0) {
+        if (reader.read(1) != 0) {
+            const std::int64_t distance = static_cast<std::int64_t>(reader.read(relative)) - (std::int64_t{1} << (relative - 1));
+            const std::int64_t wire = static_cast<std::int64_t>(from) + distance;
+            return wire < 0 ? 0 : static_cast<std::uint32_t>(wire); /* Past the top is clamped by the codec */
+        }
+    }
+    return reader.read(Codec::BITS);
+}
+
+template<typename T>
+constexpr std::size_t full_bits() noexcept;
+
+template<typename T>
+constexpr std::size_t delta_bits() noexcept;
+
+template<typename T, typename F>
+constexpr std::size_t field_full_bits() noexcept
+{
+    if constexpr (is_nested<F>) {
+        return full_bits<member_t<T, F>>();
+    } else {
+        return F::codec::BITS;
+    }
+}
+
+template<typename T, typename F>
+constexpr std::size_t field_delta_bits() noexcept
+{
+    if constexpr (is_nested<F>) {
+        return delta_bits<member_t<T, F>>();
+    } else {
+        return (relative_bits<typename F::codec>() != 0 ? 1 : 0) + F::codec::BITS;
+    }
+}
+
+template<typename T, typename... F>
+constexpr std::size_t sum_full_bits(Fields<F...>) noexcept
+{
+    return (std::size_t{0} + ... + field_full_bits<T, F>());
+}
+
+template<typename T, typename... F>
+constexpr std::size_t sum_delta_bits(Fields<F...>) noexcept
+{
+    return sizeof...(F) + (std::size_t{0} + ... + field_delta_bits<T, F>());
+}
+
+template<typename T>
+constexpr std::size_t full_bits() noexcept
+{
+    return sum_full_bits<T>(typename Traits<T>::fields{});
+}
+
+template<typename T>
+constexpr std::size_t delta_bits() noexcept
+{
+    return sum_delta_bits<T>(typename Traits<T>::fields{});
+}
+
+}// namespace detail
+
+/**
+ * @brief Calls `fn(field, index)` for each field of T, `field` being a value of its Field type.
+ */
+template<Described T, typename Fn>
+constexpr void for_each_field(Fn &&fn)
+{
+    detail::for_each_field<T>(typename Traits<T>::fields{}, std::forward<Fn>(fn));
+}
+
+template<Described T>
+inline constexpr std::size_t field_count = detail::count(typename Traits<T>::fields{});
+
+template<Described T>
+inline constexpr Mask all_fields = static_cast<Mask>((std::uint64_t{1} << field_count<T>) - 1);
+
+/**
+ * @brief Bits of a full encode(); encoding a subset of the fields is never bigger.
+ */
+template<Described T>
+inline constexpr std::size_t max_bits = detail::full_bits<T>();
+
+template<Described T>
+inline constexpr std::size_t max_bytes = (max_bits<T> + 7) / 8;
+
+/**
+ * @brief Bits of the biggest encode_delta(): every mask, nested ones included, and every field in full.
+ */
+template<Described T>
+inline constexpr std::size_t max_delta_bits = detail::delta_bits<T>();
+
+/* ================================================================================= */
+/* Generated code */
+/* ================================================================================= */
+
+/**
+ * @brief Fields whose wire form differs between `from` and `to`. A Nested member differs when any of its fields does.
+ */
+template<Described T>
+constexpr Mask diff(const T &from, const T &to) noexcept
+{
+    static_assert(field_count<T> <= 32, "A Mask has 32 bits");
+    Mask mask = 0;
+    for_each_field<T>([&]<typename F>(F, std::size_t index) {
+        bool changed = false;
+        if constexpr (detail::is_nested<F>) {
+            changed = diff(F::of(from), F::of(to)) != 0;
+        } else {
+            changed = F::codec::to_wire(F::of(from)) != F::codec::to_wire(F::of(to));
+        }
+        if (changed) {
+            mask |= Mask{1} << index;
+        }
+    });
+    return mask;
+}
+
+/**
+ * @brief Writes the fields of `mask`, in declaration order, Nested members in full. The mask itself is not written.
+ */
+template<Described T, typename Bytes>
+void encode(const T &value, BasicBitWriter<Bytes> &writer, Mask mask = all_fields<T>)
+{
+    for_each_field<T>([&]<typename F>(F, std::size_t index) {
+        if (mask & (Mask{1} << index)) {
+            if constexpr (detail::is_nested<F>) {
+                encode(F::of(value), writer);
+            } else {
+                writer.write(F::codec::to_wire(F::of(value)), F::codec::BITS);
+            }
+        }
+    });
+}
+
+/**
+ * @brief Reads the fields of `mask` into `value`, leaving the others alone.
+ */
+template<Described T>
+void decode(T &value, BitReader &reader, Mask mask = all_fields<T>) noexcept
+{
+    for_each_field<T>([&]<typename F>(F, std::size_t index) {
+        if (mask & (Mask{1} << index)) {
+            auto &field = F::of(value);
+            if constexpr (detail::is_nested<F>) {
+                decode(field, reader);
+            } else {
+                field = F::codec::template from_wire<std::remove_cvref_t<decltype(field)>>(reader.read(F::codec::BITS));
+            }
+        }
+    });
+}
+
+/**
+ * @brief Writes what turns `from` into `to`: the change mask `mask` (normally diff(from, to)), then each
+ * changed field, relative to its `from` value when its codec allows it (Quantized::DELTA_BITS). A
+ * changed Nested member is written as a delta of its own, down to the fields that changed.
+ */
+template<Described T, typename Bytes>
+void encode_delta(const T &from, const T &to, BasicBitWriter<Bytes> &writer, Mask mask)
+{
+    writer.write(mask, static_cast<unsigned>(field_count<T>));
+    for_each_field<T>([&]<typename F>(F, std::size_t index) {
+        if (mask & (Mask{1} << index)) {
+            if constexpr (detail::is_nested<F>) {
+                encode_delta(F::of(from), F::of(to), writer, diff(F::of(from), F::of(to)));
+            } else {
+                detail::write_changed<typename F::codec>(F::codec::to_wire(F::of(from)), F::codec::to_wire(F::of(to)), writer);
+            }
+        }
+    });
+}
+
+/**
+ * @brief Applies what encode_delta() wrote to `value`, which must hold what it was encoded from.
+ */
+template<Described T>
+void decode_delta(T &value, BitReader &reader) noexcept
+{
+    const Mask mask = reader.read(static_cast<unsigned>(field_count<T>));
+    for_each_field<T>([&]<typename F>(F, std::size_t index) {
+        if (mask & (Mask{1} << index)) {
+            auto &field = F::of(value);
+            if constexpr (detail::is_nested<F>) {
+                decode_delta(field, reader);
+            } else {
+                const std::uint32_t wire = detail::read_changed<typename F::codec>(F::codec::to_wire(field), reader);
+                field = F::codec::template from_wire<std::remove_cvref_t<decltype(field)>>(wire);
+            }
+        }
+    });
+}
+
+}// namespace net
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+/**
+ * @brief Payload of an R-Type packet: bytes inline up to INLINE_CAPACITY, a pooled block beyond.
+ * @details Most packets (inputs, lobby commands, pings) carry a few bytes and never leave the object.
+ * Bigger payloads live in blocks recycled through a process-wide pool of power-of-two size classes,
+ * so a steady stream of packets allocates nothing once the pool is warm.
+ *
+ * The engine copies events into its queues, so the payload cannot be move-only. Copying a pooled
+ * payload shares its block through a reference count instead of copying the bytes, and the block
+ * is copied on the first write to a shared payload. Moving is always free. Blocks can be released
+ * from any thread.
+ *
+ * Implementation lives in the source file `src/core/packet_payload.cpp`.
+ */
+class PacketPayload
+{
+    public:
+        static constexpr std::size_t INLINE_CAPACITY = 24;
+
+        /**
+         * @brief Blocks handed out by the pool, for tuning.
+         */
+        struct PoolStats {
+                std::size_t allocated;///< Blocks taken from the heap since startup
+                std::size_t recycled; ///< Acquisitions served from the free lists
+                std::size_t free;     ///< Blocks currently waiting in the free lists
+        };
+
+        PacketPayload() noexcept = default;
+        PacketPayload(std::span<const std::uint8_t> bytes);
+        PacketPayload(const PacketPayload &other) noexcept;
+        PacketPayload(PacketPayload &&other) noexcept;
+        PacketPayload &operator=(const PacketPayload &other) noexcept;
+        PacketPayload &operator=(PacketPayload &&other) noexcept;
+        ~PacketPayload();
+
+        void assign(std::span<const std::uint8_t> bytes);
+        void push_back(std::uint8_t byte);
+
+        /**
+         * @brief Resizes to `size`, keeping the first bytes. New bytes are left unspecified.
+         */
+        void resize(std::size_t size);
+        void reserve(std::size_t capacity);
+        void clear() noexcept;
+
+        const std::uint8_t *data() const noexcept;
+
+        /**
+         * @brief Writable bytes. Detaches from the other copies first.
+         */
+        std::uint8_t *data();
+
+        std::size_t size() const noexcept;
+        std::size_t capacity() const noexcept;
+        bool empty() const noexcept;
+        bool is_inline() const noexcept;
+
+        std::uint8_t front() const noexcept;
+        std::uint8_t operator[](std::size_t index) const noexcept;
+        const std::uint8_t *begin() const noexcept;
+        const std::uint8_t *end() const noexcept;
+
+        operator std::span<const std::uint8_t>() const noexcept;
+
+        bool operator==(const PacketPayload &other) const noexcept;
+
+        static PoolStats pool_stats() noexcept;
+
+    private:
+        struct Block;
+        struct Pool;
+
+        /**
+         * @brief Makes the bytes writable and able to hold `capacity` bytes, keeping the current ones.
+         */
+        void make_unique(std::size_t capacity);
+        void release() noexcept;
+        bool owns_block(std::size_t capacity) const noexcept;
+        std::uint8_t *storage() noexcept;
+
+        Block *_block = nullptr;///< null while inline
+        std::uint32_t _size = 0;
+        std::array<std::uint8_t, INLINE_CAPACITY> _inline{};
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <R-Engine/Maths/Vec.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class JobPool;
+
+/**
+ * @brief Fixed-capacity CPU particle buffers, one array per attribute (structure of arrays).
+ * @details Particles are not entities: emitting writes to the end of the arrays and dead
+ * particles are swap-removed during update(), so live particles are always packed in
+ * [0, size()). Nothing is allocated after construction; emitting into a full pool is dropped.
+ * The integration pass runs through a runtime-dispatched SIMD kernel (AVX2, SSE2 or scalar)
+ * and is split across a JobPool when one is given.
+ *
+ * Engine-agnostic, so it can be driven headless. Implementation lives in the source file
+ * `src/core/particle_pool.cpp`.
+ */
+class ParticlePool
+{
+    public:
+        /**
+         * @brief What the renderer draws for one particle: its model matrix, row-major like raylib's `Matrix`.
+         * @details A uniform scale by the particle size and a translation to its position. The bottom row,
+         * (0, 0, 0, 1) in any model matrix, carries the colour instead (0-1, alpha faded with the remaining
+         * life); the instancing shader reads it and restores the row. A list goes to the GPU as it is.
+         */
+        struct Instance {
+                float rows[4][4];
+        };
+
+        /**
+         * @brief One instance list per particle kind (mesh), indexed by kind.
+         */
+        using InstanceLists = std::vector<std::vector<Instance>>;
+
+        /**
+         * @brief Spherical burst of `count` particles with random directions and speeds.
+         */
+        struct Burst {
+                r::Vec3f position;
+                std::size_t count;
+                float min_speed;
+                float max_speed;
+                float life;
+                float size;
+                std::uint32_t rgba;
+                std::uint8_t kind;
+        };
+
+        /**
+         * @param kind_count Number of particle kinds, each exported as its own instance list.
+         */
+        ParticlePool(std::size_t capacity, std::uint8_t kind_count);
+
+        bool emit(const r::Vec3f &position, const r::Vec3f &velocity, float life, float size, std::uint32_t rgba, std::uint8_t kind) noexcept;
+
+        /**
+         * @brief Emits as many particles of `burst` as there is room for.
+         * @return The number of particles emitted.
+         */
+        std::size_t emit(const Burst &burst) noexcept;
+
+        /**
+         * @brief Integrates every particle, applies `damping` (fraction of velocity kept per second) and culls the dead ones.
+         */
+        void update(float dt, float damping, const JobPool *jobs = nullptr);
+
+        /**
+         * @brief Rebuilds `lists` (resized to one list per kind) from the live particles.
+         * @details Only reads the pool, so the lists can be a render snapshot owned by someone else.
+         */
+        void build_instances(InstanceLists &lists) const;
+
+        void clear() noexcept;
+        std::size_t size() const noexcept;
+        std::size_t capacity() const noexcept;
+
+    private:
+        float random_unit() noexcept;
+
+        std::vector<float> _px, _py, _pz;
+        std::vector<float> _vx, _vy, _vz;
+        std::vector<float> _life;
+        std::vector<float> _inv_max_life;
+        std::vector<float> _size;
+        std::vector<std::uint32_t> _rgba;
+        std::vector<std::uint8_t> _kind;
+        std::size_t _count = 0;
+        std::uint32_t _rng = 0x9E3779B9u;
+        std::uint8_t _kind_count;
+};
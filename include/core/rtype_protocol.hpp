@@ -0,0 +1,133 @@
+#pragma once
+
+#include <core/packet_payload.hpp>
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Wire types of the R-Type protocols: UDP packets between clients and servers, TCP messages to the gateway.
+ * @details Nothing here depends on the engine, so the gateway and the codecs build without it.
+ * The systems moving these packets through the NetworkPlugin live in plugins/rtype_protocol_plugin.hpp.
+ */
+namespace rtype::protocol {
+
+/**
+ * @brief R-Type protocol commands
+ */
+enum class RTypeCommand : uint8_t {
+    CMD_INPUT = 1,
+    CMD_SNAPSHOT = 2,
+    CMD_CHAT = 3,
+    CMD_PING = 4,
+    CMD_PONG = 5,
+    CMD_ACK = 6,
+    CMD_JOIN = 7,
+    CMD_KICK = 8,
+    CMD_CHALLENGE = 9,
+    CMD_AUTH = 10,
+    CMD_AUTH_OK = 11,
+    CMD_RESYNC = 12,
+    CMD_FRAGMENT = 13,
+    CMD_PLAYER_STATS = 14,
+    CMD_PLAYER_DEATH = 15,
+    CMD_PLAYER_SCORE = 16,
+    CMD_GAME_END = 17,
+    CMD_LEAVE = 18,
+    CMD_READY = 19,
+    CMD_NOT_READY = 20,
+    CMD_CREATE = 21,
+    CMD_CREATE_KO = 22,
+    CMD_JOIN_KO = 23,
+    CMD_PAUSE = 24,
+    CMD_RESUME = 25,
+    CMD_LEADERBOARD = 26,
+    CMD_SPECTATE = 27
+};
+
+/**
+ * @brief R-Type protocol flags
+ */
+enum class RTypeFlags : uint8_t {
+    F_CONN = 1 << 0,
+    F_RELIABLE = 1 << 1,
+    F_FRAGMENT = 1 << 2,
+    F_PING = 1 << 3,
+    F_CLOSE = 1 << 4,
+    F_ENCRYPTED = 1 << 5,
+    F_COMPRESSED = 1 << 6,
+    F_SNAPSHOTS = 1 << 7 ///< The sender decodes CMD_SNAPSHOT: only peers setting it are sent snapshots
+};
+
+/**
+ * @brief R-Type protocol channels
+ */
+enum class RTypeChannel : uint8_t { C_UU = 0b00, C_UO = 0b01, C_RU = 0b10, C_RO = 0b11 };
+
+/**
+ * @brief Standardized inputs for R-Type protocol
+ */
+enum class RTypeInput : uint8_t {
+    I_FWD = 1
+    // Ajouter d'autres inputs si besoin
+};
+
+/**
+ * @brief R-Type UDP header structure
+ */
+struct RTypeHeader {
+        uint16_t magic; ///< Magic number: 0x4254
+        uint8_t version;///< Protocol version: 0b1
+        uint8_t flags;
+        uint32_t seq;
+        uint32_t ackBase;
+        uint8_t ackBits;
+        uint8_t channel;
+        uint16_t size;
+        uint32_t id;
+        uint8_t command;
+};
+
+/**
+ * @brief R-Type UDP packet structure
+ * @details The payload is inline for small packets and pooled beyond, see PacketPayload: queuing,
+ * copying and dropping packets does not allocate once the pool is warm.
+ */
+struct RTypePacket {
+        RTypeHeader header;
+        PacketPayload payload;
+};
+
+/**
+ * @brief TCP commands for R-Type Gateway
+ */
+enum class RTypeTCPMessage : uint8_t {
+    GCMD_JOIN = 1,
+    GCMD_JOIN_KO = 2,
+    GCMD_CREATE = 3,
+    GCMD_CREATE_KO = 4,
+    GCMD_GAME_END = 5,
+    GCMD_GS = 20,
+    GCMD_GS_OK = 21,
+    GCMD_GS_KO = 22,
+    GCMD_OCCUPANCY = 23,
+    GCMD_GID = 24
+};
+
+/**
+ * @brief R-Type game types
+ */
+enum class RTypeGameType : uint8_t { G_RTYPE = 1 };
+
+/**
+ * @brief TCP packet structure for R-Type Gateway
+ */
+struct RTypeTCPPacket {
+        uint16_t magic; ///< Magic number: 0x4257
+        uint8_t version;///< Protocol version: 0b1
+        uint8_t flags;
+        RTypeTCPMessage type;
+        std::vector<uint8_t> payload;
+};
+
+}// namespace rtype::protocol
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief Wrap script (coroutine) definitions in these: GCC before 14 reports the switch it
+ * generates over the suspension points under -Wswitch-default.
+ */
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 14
+    #define SCRIPTS_BEGIN _Pragma("GCC diagnostic push") _Pragma("GCC diagnostic ignored \"-Wswitch-default\"")
+    #define SCRIPTS_END _Pragma("GCC diagnostic pop")
+#else
+    #define SCRIPTS_BEGIN
+    #define SCRIPTS_END
+#endif
+
+/**
+ * @brief Identifier of a condition scripts can wait on, raised by game code (shields down...).
+ */
+using ScriptSignal = std::uint32_t;
+
+/**
+ * @brief Handle to a running script. Stale once the script finished or was cancelled.
+ */
+struct ScriptId {
+        std::uint32_t slot = 0;
+        std::uint32_t generation = 0;
+};
+
+class Script;
+
+/**
+ * @brief Fixed size-class allocator for coroutine frames.
+ * @details Frames are carved from slabs and recycled through per-class free lists, so starting and
+ * finishing scripts never goes back to the global heap once the pool is warm. Frames above the
+ * largest class fall back to ::operator new.
+ *
+ * Implementation lives in the source file `src/core/script.cpp`.
+ */
+class ScriptFramePool
+{
+    public:
+        static void *allocate(std::size_t size);
+        static void deallocate(void *ptr, std::size_t size) noexcept;
+
+        /**
+         * @brief Number of frames currently handed out.
+         */
+        static std::size_t live_frames() noexcept;
+};
+
+/**
+ * @brief Owns the suspended scripts and resumes them when what they wait for happens.
+ * @details Timed waits sit in a min-heap keyed on their wake time and signal waits in a per-signal
+ * list: advance() only touches the scripts that are due, so an idle script costs its frame and
+ * nothing per tick. Scripts run on the thread calling advance(), never concurrently.
+ *
+ * Running scripts point back at the scheduler's heap state, which copies share: the engine copies
+ * resources into its storage, and each coroutine frame still has a single owner. The last copy to go
+ * destroys every script. Implementation lives in the source file `src/core/script.cpp`.
+ */
+class ScriptScheduler
+{
+    public:
+        static constexpr std::uint64_t NO_OWNER = ~std::uint64_t{0};
+
+        struct State;
+
+        ScriptScheduler();
+
+        /**
+         * @brief Takes ownership of `script`. Its body starts on the next advance().
+         * @param owner Tag used by cancel_owner(), typically the entity the script drives.
+         */
+        ScriptId start(Script script, std::uint64_t owner = NO_OWNER);
+
+        /**
+         * @brief Moves the clock forward by `dt` seconds and resumes every script that became due.
+         */
+        void advance(float dt);
+
+        /**
+         * @brief Wakes every script waiting on `signal`. They resume on the next advance().
+         */
+        void raise(ScriptSignal signal);
+
+        void cancel(ScriptId id);
+        void cancel_owner(std::uint64_t owner);
+
+        /**
+         * @brief Destroys every script and resets the clock.
+         */
+        void clear();
+
+        bool is_running(ScriptId id) const noexcept;
+        std::size_t size() const noexcept;
+
+        /**
+         * @brief Scheduler time, in seconds. While a script runs, the time it was due at.
+         */
+        double now() const noexcept;
+
+    private:
+        std::shared_ptr<State> _state;
+};
+
+/**
+ * @brief Coroutine return type of gameplay scripts.
+ * @details A script is lazy: it does not run until a ScriptScheduler owns it. Frames come from
+ * ScriptFramePool.
+ */
+class Script
+{
+    public:
+        struct promise_type {
+                ScriptScheduler::State *scheduler = nullptr;
+                ScriptId id;
+
+                Script get_return_object() noexcept;
+                std::suspend_always initial_suspend() const noexcept;
+                std::suspend_always final_suspend() const noexcept;
+                void return_void() const noexcept;
+                void unhandled_exception() const;
+
+                static void *operator new(std::size_t size);
+                static void operator delete(void *ptr, std::size_t size) noexcept;
+        };
+
+        Script(Script &&other) noexcept;
+        Script &operator=(Script &&other) noexcept;
+        Script(const Script &) = delete;
+        Script &operator=(const Script &) = delete;
+        ~Script();
+
+    private:
+        friend class ScriptScheduler;
+
+        explicit Script(std::coroutine_handle<promise_type> handle) noexcept;
+
+        std::coroutine_handle<promise_type> _handle;
+};
+
+/* ================================================================================= */
+/* Awaitables */
+/* ================================================================================= */
+
+/**
+ * @brief `co_await WaitSeconds{2.0f};` suspends the script for two seconds of scheduler time.
+ * @details Measured from the time the script was due at, so chained waits do not drift with the tick rate.
+ */
+struct WaitSeconds {
+        float seconds;
+
+        bool await_ready() const noexcept;
+        void await_suspend(std::coroutine_handle<Script::promise_type> handle) const;
+        void await_resume() const noexcept;
+};
+
+/**
+ * @brief `co_await WaitSignal{signal};` suspends the script until ScriptScheduler::raise(signal).
+ */
+struct WaitSignal {
+        ScriptSignal signal;
+
+        bool await_ready() const noexcept;
+        void await_suspend(std::coroutine_handle<Script::promise_type> handle) const;
+        void await_resume() const noexcept;
+};
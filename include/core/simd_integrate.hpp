@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @brief Bulk explicit-Euler step over packed float arrays: `positions[i] += velocities[i] * dt`.
+ * @details Both arrays hold `count` floats (3 per entity for xyz-packed vectors) and must not
+ * overlap. The kernel is picked once at startup from the host CPU: AVX-512F, AVX2+FMA, SSE2,
+ * or a scalar loop on other architectures.
+ *
+ * The FMA kernels round once per component where SSE2/scalar round twice, so hosts running
+ * different kernels can disagree in the last bit.
+ *
+ * Implementation lives in the source file `src/core/simd_integrate.cpp`.
+ */
+void integrate_positions(float *positions, const float *velocities, std::size_t count, float dt) noexcept;
+
+/**
+ * @brief Name of the kernel selected by integrate_positions() ("avx512f", "avx2", "sse2" or "scalar").
+ */
+const char *integrate_positions_isa() noexcept;
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <R-Engine/Components/Transform3d.hpp>
+#include <components/common.hpp>
+#include <components/enemy.hpp>
+#include <components/player.hpp>
+#include <components/replication.hpp>
+#include <core/net_id.hpp>
+#include <core/net_traits.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Snapshots kept for delta encoding: a client whose last acknowledged snapshot is older gets a full one.
+ * @details About half a second at 60 Hz, well past a normal round trip.
+ */
+inline constexpr std::size_t SNAPSHOT_HISTORY = 32;
+
+/**
+ * @brief What a replicated entity is, so the client knows what to spawn for it.
+ */
+enum class NetKind : std::uint8_t { Player, Force, Enemy, Boss, PlayerBullet, EnemyBullet, Beam, Shield };
+
+static_assert(static_cast<unsigned>(NetKind::Shield) < (1u << snapshot_quantization::KIND_BITS));
+
+/**
+ * @brief Replicated state of one entity: its replicated components, default-constructed when it has none.
+ * @details `transform` holds the world-space position (GlobalTransform3d). What of each component is
+ * sent is up to its net::Traits (components/replication.hpp).
+ */
+struct EntityState {
+        NetId id;
+        NetKind kind{};
+        r::Transform3d transform{};
+        Velocity velocity{};
+        Health health{};
+        Force force{};
+        HomingAttackBoss boss{};
+};
+
+/**
+ * @brief Replicated state of the world at one server tick. Entities are sorted by NetId.
+ */
+struct WorldSnapshot {
+        std::uint32_t sequence = 0;
+        std::uint32_t time = 0; ///< Simulated time of the tick in microseconds, wrapping
+        std::vector<EntityState> entities;
+};
+
+/**
+ * @brief Longest gap between a baseline and a snapshot over which the baseline is extrapolated, in microseconds.
+ */
+inline constexpr std::uint32_t SNAPSHOT_EXTRAPOLATION_LIMIT = 1'000'000;
+
+/**
+ * @brief Fields of an entity record, in the order of the change mask bits. The id is sent apart.
+ */
+template<>
+struct net::Traits<EntityState> {
+        using fields = Fields<
+            Field<Unsigned<snapshot_quantization::KIND_BITS>, &EntityState::kind>,
+            Nested<&EntityState::transform>,
+            Nested<&EntityState::velocity>,
+            Nested<&EntityState::health>,
+            Nested<&EntityState::force>,
+            Nested<&EntityState::boss>>;
+};
+
+static_assert(net::max_delta_bits<EntityState> == 104);
+
+/**
+ * @brief The last SNAPSHOT_HISTORY snapshots, shared by every client's encoder.
+ * @details Snapshots are immutable once pushed and held by shared pointers, so any number of clients
+ * can use the same one as their baseline without copying the world. Sequence 0 is never stored: it
+ * means "nothing acknowledged".
+ *
+ * Implementation lives in the source file `src/core/snapshot.cpp`.
+ */
+class SnapshotHistory
+{
+    public:
+        explicit SnapshotHistory(std::size_t capacity = SNAPSHOT_HISTORY);
+
+        void push(std::shared_ptr<const WorldSnapshot> snapshot);
+
+        /**
+         * @return The snapshot of `sequence`, or null if it was never pushed or already fell out.
+         */
+        std::shared_ptr<const WorldSnapshot> find(std::uint32_t sequence) const noexcept;
+
+    private:
+        std::vector<std::shared_ptr<const WorldSnapshot>> _ring;
+};
+
+/**
+ * @brief Whether `a` is after `b`, across the wrap of the 32-bit sequence.
+ */
+constexpr bool sequence_newer(std::uint32_t a, std::uint32_t b) noexcept
+{
+    return static_cast<std::int32_t>(a - b) > 0;
+}
+
+/**
+ * @brief Appends the CMD_SNAPSHOT payload turning `baseline` (null: nothing) into `current` to `out`.
+ * @details A byte-aligned, big-endian header: sequence u32, baseline sequence u32 (0 for a full
+ * snapshot), time u32, changed count u16, removed count u16. Then a bit stream (BitWriter): for each
+ * entity that is new or changed, by ascending NetId, its NetId and net::encode_delta() from its
+ * baseline state, or from a default EntityState if it is new: a change mask per record and per
+ * component, and only the fields that changed. Then the NetIds of the removed entities, and zero
+ * padding to a whole byte. A NetId is sent as its distance from the previous one in the list, on a
+ * flag and 4 bits, when it is at most 16 above it, and on NET_ID_BITS otherwise.
+ *
+ * The baseline state of an entity is first moved along its velocity for the time between the two
+ * snapshots (up to SNAPSHOT_EXTRAPOLATION_LIMIT), on the wire values, so both ends compute the same
+ * position. An entity moving in a straight line (bullets) is then usually unchanged, only off by a
+ * step now and then since both positions are rounded, and the others send their distance to the
+ * extrapolated position. Unchanged entities cost nothing, and an entity only counts as changed when
+ * its quantized fields do.
+ */
+void encode_snapshot(const WorldSnapshot *baseline, const WorldSnapshot &current, std::vector<std::uint8_t> &out);
+
+/**
+ * @brief Baseline sequence a CMD_SNAPSHOT payload was encoded against, 0 for a full snapshot or a short payload.
+ */
+std::uint32_t snapshot_baseline(std::span<const std::uint8_t> payload) noexcept;
+
+/**
+ * @brief Rebuilds the snapshot encoded in `payload` on top of `baseline`, which must be the one snapshot_baseline() names.
+ * @details Entities the payload does not mention are the baseline ones, extrapolated like the encoder did.
+ * @return false on a malformed payload or a baseline mismatch; `out` is then unspecified.
+ */
+bool decode_snapshot(const WorldSnapshot *baseline, std::span<const std::uint8_t> payload, WorldSnapshot &out);
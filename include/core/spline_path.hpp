@@ -0,0 +1,46 @@
+#pragma once
+
+#include <R-Engine/Maths/Vec.hpp>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Flight path baked into an arc-length lookup table.
+ * @details A Catmull-Rom spline through the control points is resampled at evenly spaced
+ * distances along the curve. Sampling is then a table lookup and a lerp: constant speed along
+ * the path, no trig and no integration, whatever the curvature. The table is stored as separate
+ * x/y/z arrays so the batch sampler can gather 8 members at once on AVX2 hosts.
+ *
+ * Implementation lives in the source file `src/core/spline_path.cpp`.
+ */
+class SplinePath
+{
+    public:
+        static constexpr std::size_t DEFAULT_SAMPLES = 256;
+
+        /**
+         * @brief Bakes the curve through `control_points`. Fewer than two points give a path of length 0.
+         */
+        static SplinePath bake(std::span<const r::Vec3f> control_points, std::size_t samples = DEFAULT_SAMPLES);
+
+        float length() const noexcept;
+
+        /**
+         * @brief Position at `distance` along the path, clamped to both ends.
+         */
+        r::Vec3f sample(float distance) const noexcept;
+
+        /**
+         * @brief Samples `count` distances at once into separate x/y/z outputs.
+         */
+        void sample(const float *distances, std::size_t count, float *out_x, float *out_y, float *out_z) const noexcept;
+
+    private:
+        std::vector<float> _x;
+        std::vector<float> _y;
+        std::vector<float> _z;
+        float _length = 0.0f;
+        float _inv_spacing = 0.0f;
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <R-Engine/ECS/Entity.hpp>
+#include <R-Engine/Maths/Vec.hpp>
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Positions of the entities AI can target (the living players), rebuilt once per tick.
+ * @details Rooms hold at most a handful of players, so the index is a flat array scanned
+ * linearly: a single cache line per query and no structure to maintain, which beats a grid or
+ * a tree at that size. Queries are read-only and safe to run from JobPool workers.
+ *
+ * Implementation lives in the source file `src/core/target_index.cpp`.
+ */
+class TargetIndex
+{
+    public:
+        struct Target {
+                r::ecs::Entity entity;
+                r::Vec3f position;
+        };
+
+        void clear() noexcept;
+        void insert(r::ecs::Entity entity, const r::Vec3f &position);
+
+        /**
+         * @brief Closest target to `from`, or nullptr when the index is empty.
+         */
+        const Target *nearest(const r::Vec3f &from) const noexcept;
+
+        /**
+         * @brief Current entry of `entity`, or nullptr when it is not a target anymore (dead, despawned).
+         */
+        const Target *find(r::ecs::Entity entity) const noexcept;
+
+        bool empty() const noexcept;
+        std::size_t size() const noexcept;
+
+    private:
+        std::vector<Target> _targets;
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Longest period, in frames, a system can be throttled to.
+ */
+inline constexpr std::uint32_t MAX_TIER_PERIOD = 8;
+
+/**
+ * @brief Frame clock of the reduced-rate (tiered) systems.
+ * @details A system at period N runs on the frames where due(N, phase) holds and integrates
+ * elapsed(N), the time of the last N frames, so it moves as far as if it had run every frame.
+ * A time-sliced system runs every frame but only processes the entities of slice(N), each of
+ * them also advancing by elapsed(N). Give systems of the same period different phases to
+ * spread them over the frames instead of stacking them on one.
+ *
+ * Implementation lives in the source file `src/core/update_tier.cpp`.
+ */
+class TierClock
+{
+    public:
+        /**
+         * @brief Starts a new frame that lasted `dt` seconds.
+         */
+        void advance(float dt) noexcept;
+
+        bool due(std::uint32_t period, std::uint32_t phase = 0) const noexcept;
+
+        /**
+         * @brief Seconds covered by the last `period` frames, this one included.
+         */
+        float elapsed(std::uint32_t period) const noexcept;
+
+        /**
+         * @brief Index of the slice processed this frame, in [0, slices).
+         */
+        std::uint32_t slice(std::uint32_t slices) const noexcept;
+
+        std::uint64_t frame() const noexcept;
+
+    private:
+        std::uint64_t _frame = 0;
+        std::array<float, MAX_TIER_PERIOD> _history{};
+};
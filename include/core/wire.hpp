@@ -0,0 +1,70 @@
+#pragma once
+
+#include <core/rtype_protocol.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace wire {
+
+/**
+ * @brief Byte offset of each RTypeHeader field on the wire.
+ * @details Fields in declaration order, big-endian, without padding, whatever the struct layout of the host.
+ */
+namespace offset {
+inline constexpr std::size_t MAGIC = 0;
+inline constexpr std::size_t VERSION = 2;
+inline constexpr std::size_t FLAGS = 3;
+inline constexpr std::size_t SEQ = 4;
+inline constexpr std::size_t ACK_BASE = 8;
+inline constexpr std::size_t ACK_BITS = 12;
+inline constexpr std::size_t CHANNEL = 13;
+inline constexpr std::size_t SIZE = 14;
+inline constexpr std::size_t ID = 16;
+inline constexpr std::size_t COMMAND = 20;
+}// namespace offset
+
+inline constexpr std::size_t RTYPE_HEADER_SIZE = 21;
+inline constexpr std::uint16_t RTYPE_MAGIC = 0x4254;
+
+/**
+ * @brief A datagram parsed in place: the decoded header and its payload, pointing into the datagram.
+ * @details Only valid as long as the datagram buffer is. Copy it into an RTypePacket (to_packet()) to
+ * keep it past the next receive.
+ */
+struct RTypePacketView {
+        rtype::protocol::RTypeHeader header;
+        std::span<const std::uint8_t> payload;
+};
+
+/**
+ * @brief Parses one datagram without copying its payload. Every header field is kept as received.
+ * @details Fails on a short datagram, a wrong magic or a size field past the end. Bytes past `size` are ignored.
+ *
+ * Implementation lives in the source file `src/core/wire.cpp`.
+ */
+bool decode_datagram(std::span<const std::uint8_t> datagram, RTypePacketView &view) noexcept;
+
+/**
+ * @brief Same as the view overload, copying the payload into `packet`.
+ */
+bool decode_datagram(std::span<const std::uint8_t> datagram, rtype::protocol::RTypePacket &packet);
+
+/**
+ * @brief Writes `header` followed by `payload` into `out`. The size field is taken from the payload, every other field from `header`.
+ * @return The datagram length, 0 if it does not fit or the payload is over 65535 bytes.
+ */
+std::size_t encode_datagram(const rtype::protocol::RTypeHeader &header, std::span<const std::uint8_t> payload,
+    std::span<std::uint8_t> out) noexcept;
+
+std::size_t encode_datagram(const rtype::protocol::RTypePacket &packet, std::span<std::uint8_t> out) noexcept;
+
+rtype::protocol::RTypePacket to_packet(const RTypePacketView &view);
+
+/**
+ * @brief Packet of `command` from the server, header fields other than magic and version left to zero.
+ */
+rtype::protocol::RTypePacket make_packet(rtype::protocol::RTypeCommand command, std::span<const std::uint8_t> payload = {});
+
+}// namespace wire
@@ -15,6 +15,12 @@ struct PlayerDiedEvent {
 struct BossTimeReachedEvent {
 };
 
+/**
+ * @brief Asks EnemyPlugin to spawn one enemy of the current level. Sent by the level timeline script.
+ */
+struct EnemySpawnRequestEvent {
+};
+
 /**
  * @brief Fired when the boss's health reaches zero.
  */
@@ -28,3 +34,17 @@ struct BossDefeatedEvent {
 struct EntityDiedEvent {
         r::ecs::Entity entity;
 };
+
+/**
+ * @brief Fired whenever an entity's Health is modified.
+ * @details Health-dependent logic (boss tint, boss phases) runs only on frames that carry this event.
+ */
+struct HealthChangedEvent {
+        r::ecs::Entity entity;
+};
+
+/**
+ * @brief Fired whenever PlayerScore or PlayerLives is modified. Drives the HUD refresh.
+ */
+struct PlayerStatsChangedEvent {
+};
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+/**
+ * @brief Default TCP port of r-type-gateway.
+ */
+inline constexpr std::uint16_t GATEWAY_PORT = 4100;
+
+/**
+ * @brief Front door of a multi-server deployment: game servers register with it and clients ask it
+ * where to play.
+ * @details Servers and clients connect to the same port and speak RTypeTCPPacket frames (see
+ * `server/tcp_frame.hpp`). The first frame of a connection decides its role. Integers are big-endian
+ * and addresses are IPv4.
+ *
+ * Server to gateway:
+ * - GCMD_GS `game type u8, udp port u16, room capacity u32`: registers. Answered by GCMD_GS_OK
+ *   `server id u32`, or GCMD_GS_KO for an unknown game type. The UDP address is the one the server
+ *   connected from, so the topology also works on one box over loopback.
+ * - GCMD_OCCUPANCY `open rooms u32, ticking rooms u32`: current load, sent periodically.
+ * - GCMD_GID `ticket u32, room id u32` / GCMD_CREATE_KO `ticket u32`: answer to a GCMD_CREATE.
+ * - GCMD_GAME_END `room id u32`: the room closed.
+ *
+ * Client to gateway:
+ * - GCMD_CREATE `game type u8`: forwarded as GCMD_CREATE `ticket u32` to the least loaded server
+ *   (open rooms over capacity) that has room left.
+ * - GCMD_JOIN `game id u32`: routed to the server hosting that game.
+ *
+ * Both are answered with GCMD_GID `game id u32, address u32, udp port u16, room id u32`, after which
+ * the client sends CMD_JOIN with the room id to that server over UDP; or with GCMD_CREATE_KO /
+ * GCMD_JOIN_KO. Game ids are unique across servers.
+ *
+ * One thread, one epoll loop, non-blocking sockets. Linux only. Implementation lives in the source
+ * file `src/gateway/gateway.cpp`.
+ */
+class Gateway
+{
+    public:
+        Gateway();
+        ~Gateway();
+
+        Gateway(const Gateway &) = delete;
+        Gateway &operator=(const Gateway &) = delete;
+
+        /**
+         * @brief Opens the listening socket on `address:port`. On failure, last_error() holds the errno.
+         */
+        bool listen(const std::string &address, std::uint16_t port);
+
+        /**
+         * @brief Port the listening socket is bound to, the one picked by the system when listening on port 0.
+         */
+        std::uint16_t local_port() const noexcept;
+
+        /**
+         * @brief Serves connections until `stop` is set. Checked at least twice a second.
+         */
+        void run(const std::atomic<bool> &stop);
+
+        std::size_t server_count() const noexcept;
+        std::size_t game_count() const noexcept;
+        int last_error() const noexcept;
+
+    private:
+        struct State;
+
+        std::unique_ptr<State> _state;
+};
@@ -0,0 +1,22 @@
+#pragma once
+#include <R-Engine/Plugins/Plugin.hpp>
+
+#include <resources/game_mode.hpp>
+
+#include <string>
+
+/**
+ * @brief Registers the game events and the level table, shared by the client and the dedicated server.
+ */
+class GameSetupPlugin final : public r::Plugin
+{
+    public:
+        void build(r::Application &app) override;
+};
+
+/**
+ * @brief Reads the server address and port from `filename`.
+ * @details If the file doesn't exist, it is created with the default values, so players and
+ * server operators can edit it afterwards.
+ */
+NetworkConfig load_network_config(const std::string &filename);
@@ -0,0 +1,8 @@
+#pragma once
+#include <R-Engine/Plugins/Plugin.hpp>
+
+class ParticlesPlugin final : public r::Plugin
+{
+    public:
+        void build(r::Application &app) override;
+};
@@ -2,6 +2,8 @@
 
 #include <R-Engine/Plugins/MeshPlugin.hpp>
 
+#include <string>
+
 struct PlayerBulletAssets {
         r::MeshHandle laser_beam_handle = r::MeshInvalidHandle;
         r::MeshHandle force_missile = r::MeshInvalidHandle;
@@ -11,3 +13,13 @@ struct BossBulletAssets {
         r::MeshHandle big_missile = r::MeshInvalidHandle;
         r::MeshHandle small_missile = r::MeshInvalidHandle;
 };
+
+/**
+ * @brief Queues the model at `path` for loading and stores its handle in `handle`.
+ * @details The dedicated server runs without MeshPlugin, so `meshes` is null there: `handle` is left
+ * to r::MeshInvalidHandle and the entity is still spawned for the simulation.
+ * @return Whether the caller should spawn the entity, false only when the model could not be queued.
+ *
+ * Implementation lives in the source file `src/resources/assets.cpp`.
+ */
+bool queue_mesh(r::Meshes *meshes, const std::string &path, r::MeshHandle &handle);
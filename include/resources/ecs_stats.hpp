@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Frames run since the last scheduler report and the condition evaluation count it started from.
+ * @details Divided by each other, they give the number of run conditions evaluated per frame.
+ * Only meaningful in R_TYPE_DEBUG builds, where condition_evaluations() counts.
+ */
+struct SchedulerStats {
+        std::uint64_t frames = 0;
+        std::uint64_t evaluations_baseline = 0;
+};
+
+/**
+ * @brief Frames run since the last allocation report and the global allocation count it started from.
+ * @details Only meaningful in R_TYPE_DEBUG builds, where global_allocations() counts.
+ */
+struct AllocationStats {
+        std::uint64_t frames = 0;
+        std::uint64_t allocations_baseline = 0;
+};
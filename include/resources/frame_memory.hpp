@@ -0,0 +1,12 @@
+#pragma once
+
+#include <core/frame_arena.hpp>
+
+/**
+ * @brief Scratch memory of the current frame, reset by GameplayPlugin once per frame.
+ * @details For containers a system builds and drops within its own run (entity lists gathered
+ * from events...). Use `std::pmr` types on `resource()`. Take it as ResMut: the arena is not
+ * thread-safe, and ResMut keeps two systems from allocating at the same time.
+ */
+struct FrameMemory : FrameArena {
+};
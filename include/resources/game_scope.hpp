@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Groups of game states that share their per-frame systems.
+ * @details Systems gated on a scope test one bit of ActiveScopes instead of chaining an
+ * `in_state` condition per state they run in.
+ */
+enum class GameScope : std::uint8_t {
+    Menu = 1u << 0,   ///< MainMenu (attract mode)
+    Battle = 1u << 1, ///< EnemiesBattle and BossBattle
+    Boss = 1u << 2,   ///< BossBattle only
+    Paused = 1u << 3,
+};
+
+/**
+ * @brief Scopes of the current GameState, recomputed by GameStatePlugin on every state change.
+ */
+struct ActiveScopes {
+        std::uint8_t mask = static_cast<std::uint8_t>(GameScope::Menu);
+};
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <R-Engine/Maths/Vec.hpp>
+
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -11,6 +14,7 @@ enum class EnemyBehaviorType {
     Straight,
     SineWave,
     Homing,
+    SplinePath, ///< Follows one of the level's paths, spawned as a formation
 };
 
 struct EnemyData {
@@ -19,6 +23,16 @@ struct EnemyData {
         float speed;
         EnemyBehaviorType behavior;
         int score_value;
+        std::size_t path_index = 0;    ///< SplinePath only: index in LevelData::paths
+        int formation_size = 1;        ///< SplinePath only: members spawned together
+        float formation_spacing = 0.4f;///< SplinePath only: seconds between two members
+};
+
+/**
+ * @brief Flight path through `control_points`, baked into a SplinePath when the level starts.
+ */
+struct SplinePathData {
+        std::vector<r::Vec3f> control_points;
 };
 
 enum class BossBehaviorType {
@@ -34,6 +48,15 @@ struct BossData {
         int score_value;
 };
 
+/**
+ * @brief Upper estimates of how many entities a level keeps alive at once.
+ * @details Used to reserve the level arenas up front so tracking never reallocates mid-level.
+ */
+struct LevelCapacityHints {
+        std::size_t battle_entities = 256;
+        std::size_t scenery_entities = 32;
+};
+
 struct LevelData {
         int id;
         float enemy_spawn_interval;
@@ -42,6 +65,8 @@ struct LevelData {
         std::string scenery_model_path;
         std::vector<EnemyData> enemy_types;
         BossData boss_data;
+        LevelCapacityHints capacity = {};
+        std::vector<SplinePathData> paths = {};
 };
 
 struct GameLevels {
@@ -56,15 +81,6 @@ struct CurrentLevel {
 /* Level Progression Timers */
 /* ================================================================================= */
 
-struct EnemySpawnTimer {
-        float time_left = 1.0f; /* Default value, will be overwritten by level data */
-};
-
-struct BossSpawnTimer {
-        float time_left = 4.0f; /* Default value, will be overwritten by level data */
-        bool spawned = false;
-};
-
 struct BossShootTimer {
         float time_left = 2.0f;
         static constexpr float FIRE_RATE = 2.0f;
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <core/entity_arena.hpp>
+
+/**
+ * @brief Entities that live for the duration of a battle (enemies, bosses, projectiles).
+ * @details Released wholesale by CombatPlugin when a level (re)starts, instead of
+ * querying and despawning every gameplay type one by one.
+ */
+struct BattleArena : EntityArena {
+};
+
+/**
+ * @brief Scenery entities (background, buildings, asteroids) of the current level.
+ * @details Released wholesale by MapPlugin before the next level's scenery is spawned.
+ */
+struct SceneryArena : EntityArena {
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <R-Engine/Plugins/MeshPlugin.hpp>
+#include <core/spline_path.hpp>
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief The current level's flight paths, baked from LevelData::paths when the level starts.
+ */
+struct LevelPaths {
+        std::vector<SplinePath> paths;
+};
+
+/**
+ * @brief Formation members still waiting for their turn to enter their path.
+ * @details A member only spawns once it reaches the start of the path, so the ones waiting are
+ * never stacked, visible and collidable there.
+ */
+struct FormationQueue {
+        struct Pending {
+                std::size_t path = 0; ///< Index in LevelPaths
+                r::MeshHandle mesh = r::MeshInvalidHandle;
+                int health = 0;
+                int score_value = 0;
+                float speed = 1.0f;
+                float spacing = 0.0f; ///< Seconds between two members
+                float wait = 0.0f;    ///< Seconds until the next member spawns
+                int remaining = 0;
+        };
+
+        std::vector<Pending> pending;
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <core/async_task.hpp>
+#include <core/double_buffer.hpp>
+#include <core/particle_pool.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+class JobPool;
+
+/**
+ * @brief Particle meshes: each kind is exported as its own instance list and drawn in one instanced call.
+ */
+enum class ParticleKind : std::uint8_t {
+    Spark, ///< Hit sparks, small cubes
+    Ember, ///< Explosion debris, low-poly spheres
+    Trail, ///< Wave cannon trail, small cubes
+    Count
+};
+
+/**
+ * @brief Room for every particle of a crowded fight: 100k live particles plus headroom.
+ */
+inline constexpr std::size_t PARTICLE_CAPACITY = 131072;
+
+/**
+ * @brief Explosions, hit sparks and beam trails of the current battle.
+ * @details The pool is stepped on `simulation` while the engine renders the previous frame, and
+ * writes its instance lists to the back of `instances`. ParticlesPlugin publishes them at the start
+ * of the next UPDATE; RENDER_3D only ever reads the front snapshot.
+ */
+struct Particles {
+        ParticlePool pool{PARTICLE_CAPACITY, static_cast<std::uint8_t>(ParticleKind::Count)};
+        DoubleBuffer<ParticlePool::InstanceLists> instances{ParticlePool::InstanceLists(static_cast<std::size_t>(ParticleKind::Count))};
+        float step = 0.0f;             ///< Frame time handed to the simulation job
+        const JobPool *jobs = nullptr; ///< Workers the simulation job splits the pool across
+        AsyncTask simulation;
+
+        /**
+         * @brief The pool, once the simulation job is done with it. Emitters go through this.
+         */
+        ParticlePool &edit()
+        {
+            simulation.wait();
+            return pool;
+        }
+};
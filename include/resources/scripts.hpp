@@ -0,0 +1,55 @@
+#pragma once
+
+#include "R-Engine/Components/Transform3d.hpp"
+#include <R-Engine/ECS/Command.hpp>
+#include <R-Engine/ECS/Event.hpp>
+#include <R-Engine/ECS/Query.hpp>
+
+#include <components/common.hpp>
+#include <components/enemy.hpp>
+#include <core/script.hpp>
+#include <events/game_events.hpp>
+#include <resources/assets.hpp>
+#include <resources/level_arena.hpp>
+
+#include <memory>
+
+/* ================================================================================= */
+/* Signals */
+/* ================================================================================= */
+
+/**
+ * @brief Raised when the last boss shield is destroyed.
+ */
+inline constexpr ScriptSignal SIGNAL_SHIELDS_DOWN = 0;
+
+/* ================================================================================= */
+/* Script World */
+/* ================================================================================= */
+
+using BossScriptQuery =
+    r::ecs::Query<r::ecs::Mut<r::Transform3d>, r::ecs::Mut<Velocity>, r::ecs::Mut<HomingAttackBoss>, r::ecs::Ref<BossPhase>>;
+
+/**
+ * @brief What scripts can act on. Filled by GameplayPlugin's script runner right before it
+ * resumes scripts and reset right after: the pointers are only valid inside a script body,
+ * never across a co_await.
+ */
+struct ScriptWorld {
+        r::ecs::Commands *commands = nullptr;
+        BattleArena *arena = nullptr;
+        const BossBulletAssets *boss_bullets = nullptr;
+        r::ecs::EventWriter<EnemySpawnRequestEvent> *enemy_spawns = nullptr;
+        r::ecs::EventWriter<BossTimeReachedEvent> *boss_time = nullptr;
+        BossScriptQuery *bosses = nullptr;
+};
+
+/**
+ * @brief Gameplay scripts (level timeline, boss phases) and the world they act on.
+ * @details Copies of the resource share the scheduler and the world. Scripts hold the world by
+ * shared_ptr, so it lives as long as any script that may still use it.
+ */
+struct ScriptRunner {
+        ScriptScheduler scheduler;
+        std::shared_ptr<ScriptWorld> world = std::make_shared<ScriptWorld>();
+};
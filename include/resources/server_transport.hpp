@@ -0,0 +1,72 @@
+#pragma once
+
+#include <core/snapshot.hpp>
+#include <server/gateway_registration.hpp>
+#include <server/udp_socket.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief The dedicated server's bound socket and the clients it has heard from.
+ * @details Every SendRTypePacket is sent to each peer: one process runs one match.
+ */
+struct ServerTransport {
+        UdpSocket socket;
+        std::vector<UdpSocket::Endpoint> peers;
+        std::vector<std::uint8_t> datagram = std::vector<std::uint8_t>(UdpSocket::MAX_DATAGRAM_SIZE); ///< Receive and encode scratch
+};
+
+/**
+ * @brief Recent world snapshots and the last one each peer acknowledged, see ServerSnapshotPlugin.
+ * @details Only peers that set F_SNAPSHOTS in their packet headers are in `acked`, and only they are
+ * sent snapshots: older clients do not know CMD_SNAPSHOT. They acknowledge through the ackBase of their
+ * headers; one that acknowledged nothing yet, or whose snapshot fell out of `history`, gets a full snapshot.
+ */
+struct ServerSnapshots {
+        SnapshotHistory history{SNAPSHOT_HISTORY};
+        ReplicationRegistry registry{SNAPSHOT_HISTORY}; ///< A NetId is reused once no baseline in `history` can hold it
+        std::uint32_t sequence = 0; ///< Of the last snapshot taken
+        std::uint32_t time = 0; ///< Of the last snapshot taken: FrameTime deltas summed in microseconds, see WorldSnapshot::time
+        std::unordered_map<UdpSocket::Endpoint, std::uint32_t, UdpSocket::EndpointHash> acked;
+        std::vector<std::uint8_t> payload; ///< Encode scratch
+};
+
+/**
+ * @brief When the server started and when its last tick did, see HeadlessCorePlugin.
+ */
+struct HeadlessClock {
+        std::chrono::steady_clock::time_point started{};
+        std::chrono::steady_clock::time_point last_tick{};
+        bool ticked = false;
+};
+
+/**
+ * @brief Deadline of the next server tick, see ServerPlugin.
+ * @details While idle (no peer, or no battle running) the server does not tick: it waits for a
+ * datagram, waking up at least once a second.
+ */
+struct ServerClock {
+        std::chrono::steady_clock::time_point next_tick{};
+        bool idle = false;
+        std::chrono::steady_clock::time_point idle_since{};
+};
+
+/**
+ * @brief Memory budget of the match and when it was last reported, see ServerPlugin.
+ */
+struct ServerMemory {
+        std::size_t budget = 0; ///< Heap cap applied by ServerMain, 0 = none
+        bool compacted = false; ///< Since the server last went idle
+        std::chrono::steady_clock::time_point next_report{};
+};
+
+/**
+ * @brief Registration of this server with r-type-gateway, when started with `--gateway`.
+ */
+struct ServerGateway {
+        GatewayRegistration registration;
+};
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <core/target_index.hpp>
+
+#include <cstdint>
+
+/**
+ * @brief Living players, indexed for nearest-target queries by enemies and Forces.
+ * @details Rebuilt by PlayerPlugin at the start of every battle tick.
+ */
+struct PlayerTargets : TargetIndex {
+};
+
+/**
+ * @brief Number of simulation ticks run since startup, advanced once per battle update.
+ * @details Used to spread periodic per-entity work (AI re-targeting...) across ticks.
+ */
+struct SimulationTick {
+        std::uint64_t value = 0;
+};
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <core/update_tier.hpp>
+
+/**
+ * @brief Clock of the reduced-rate cosmetic systems, advanced once per frame by GameplayPlugin in every state.
+ */
+struct UpdateTiers : TierClock {
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <server/tcp_frame.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+
+/**
+ * @brief The game server's TCP connection to r-type-gateway, see `gateway/gateway.hpp` for the messages.
+ * @details Connects blocking at startup, then is drained once per tick without blocking: poll() reads
+ * what arrived and hands every frame to the callback as a view into the receive buffer. Output is
+ * buffered and written on the next poll() when the socket is full. Copies share the connection and
+ * its buffers: ServerMain connects before building the Application, whose ServerGateway resource
+ * holds a copy. The last copy closes it. Clients of the gateway can use it too.
+ *
+ * POSIX only, like the server target. Implementation lives in the source file `src/server/gateway_link.cpp`.
+ */
+class GatewayLink
+{
+    public:
+        using FrameFn = std::function<void(const wire::TcpFrame &)>;
+
+        GatewayLink();
+
+        /**
+         * @brief Connects to `address:port`. On failure, last_error() holds the errno.
+         */
+        bool connect(const std::string &address, std::uint16_t port);
+
+        void send(rtype::protocol::RTypeTCPMessage type, std::span<const std::uint8_t> payload = {});
+
+        /**
+         * @brief Flushes pending output, then hands each received frame to `handle`.
+         * @return false once the gateway closed the connection or sent garbage; the link is then closed.
+         */
+        bool poll(const FrameFn &handle);
+
+        bool is_open() const noexcept;
+        int last_error() const noexcept;
+
+    private:
+        struct State;
+
+        std::shared_ptr<State> _state;
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <server/gateway_link.hpp>
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief A single-match r-type-server's side of the gateway protocol, see `gateway/gateway.hpp`.
+ * @details The server registers with a capacity of one room, ROOM. The first GCMD_CREATE claims the
+ * match and is answered with GCMD_GID; others get GCMD_CREATE_KO until it is released. The match is
+ * released, with GCMD_GAME_END, when its last player leaves, or when nobody joined within JOIN_GRACE
+ * of the claim. GCMD_OCCUPANCY reports the claim and whether players are in, every REPORT_PERIOD.
+ *
+ * Engine-free, so it runs in the loopback tests as well as in ServerPlugin. POSIX only, like the
+ * server target. Implementation lives in the source file `src/server/gateway_registration.cpp`.
+ */
+class GatewayRegistration
+{
+    public:
+        static constexpr std::uint32_t ROOM = 1;
+        static constexpr std::chrono::seconds JOIN_GRACE{30};
+        static constexpr std::chrono::seconds REPORT_PERIOD{1};
+
+        /**
+         * @brief What one update() saw, for the caller to log.
+         */
+        struct Update {
+                bool registered = false; ///< GCMD_GS_OK arrived, see server_id()
+                bool refused = false;    ///< GCMD_GS_KO arrived
+                bool claimed = false;    ///< A GCMD_CREATE claimed the match
+                bool released = false;   ///< GCMD_GAME_END was sent
+                bool lost = false;       ///< The connection closed; nothing more will be routed here
+        };
+
+        GatewayRegistration() = default;
+
+        /**
+         * @param link Connected to the gateway.
+         * @param udp_port Where clients reach this server, announced in GCMD_GS.
+         */
+        GatewayRegistration(GatewayLink link, std::uint16_t udp_port);
+
+        /**
+         * @brief Handles what the gateway sent, releases the match when it is over and reports the occupancy.
+         * @param players Whether any client is connected to the match now.
+         */
+        Update update(bool players, std::chrono::steady_clock::time_point now);
+
+        bool is_open() const noexcept;
+        std::uint32_t server_id() const noexcept;
+        bool claimed() const noexcept;
+
+    private:
+        GatewayLink _link;
+        std::uint32_t _server_id = 0;
+        bool _claimed = false;
+        bool _joined = false; ///< Players connected since the claim
+        std::chrono::steady_clock::time_point _claimed_at{};
+        std::chrono::steady_clock::time_point _next_report{};
+};
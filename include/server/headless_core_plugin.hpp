@@ -0,0 +1,27 @@
+#pragma once
+#include <R-Engine/Plugins/Plugin.hpp>
+
+#include <chrono>
+
+/**
+ * @brief What the simulation needs from DefaultPlugins, without the window, GPU, audio and UI it brings:
+ * r::core::FrameTime and r::GlobalTransform3d.
+ * @details At the start of each UPDATE, FrameTime gets the wall time since the previous tick, and every
+ * GlobalTransform3d is recomputed from its Transform3d and Parent. Combat and snapshots read those
+ * global transforms, so without this plugin they would never move on the server. The first tick
+ * also logs how long the server took to start, from `started`, and its peak resident memory.
+ *
+ * Add it first, so every other system of the tick sees the updated values.
+ *
+ * Implementation lives in the source file `src/server/headless_core_plugin.cpp`.
+ */
+class HeadlessCorePlugin final : public r::Plugin
+{
+    public:
+        explicit HeadlessCorePlugin(std::chrono::steady_clock::time_point started) noexcept;
+
+        void build(r::Application &app) override;
+
+    private:
+        std::chrono::steady_clock::time_point _started;
+};
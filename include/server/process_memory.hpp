@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @brief Memory of the server process. A server process runs one match, so these are the match's.
+ */
+struct ProcessMemory {
+        std::size_t resident_bytes = 0;
+        std::size_t peak_resident_bytes = 0;
+};
+
+/**
+ * @brief Current and peak resident memory, 0 where the platform does not report them.
+ */
+ProcessMemory read_process_memory();
+
+/**
+ * @brief Caps the process heap (RLIMIT_DATA) at `bytes`: past it, allocations fail with std::bad_alloc.
+ * @details Only this process, so only its match, goes down when the cap is hit. Thread stacks and
+ * reserved address space do not count against it. On failure, errno holds the reason.
+ */
+bool limit_process_memory(std::size_t bytes);
+
+/**
+ * @brief Hands the free pages of the heap back to the system.
+ * @return The resident bytes it released, 0 where the allocator cannot trim (non-glibc).
+ *
+ * POSIX only, like the server target. Implementation lives in the source file `src/server/process_memory.cpp`.
+ */
+std::size_t compact_process_memory();
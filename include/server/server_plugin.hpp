@@ -0,0 +1,31 @@
+#pragma once
+#include <R-Engine/Plugins/Plugin.hpp>
+
+#include <cstddef>
+
+struct ServerPluginConfig {
+        std::size_t memory_budget = 0; ///< Heap cap ServerMain applied to the process, in bytes (0 = none), for the reports
+        bool gateway = false;          ///< A ServerGateway resource is inserted: its registration is driven every tick
+};
+
+/**
+ * @brief Headless side of the dedicated server: moves R-Type packets through ServerTransport,
+ * starts the battle without a menu and paces the ticks, as there is no vsync to wait on.
+ * @details Packets become ReceivedRTypePacket / SendRTypePacket events: one process runs one match.
+ * With no peer or no battle running, the match is idle: it stops ticking until a datagram arrives,
+ * and after 30 s of it hands its free heap back to the system once. Resident memory is
+ * logged periodically, with a warning when it nears the budget. With a gateway, the match is offered
+ * to it and released when its players are gone, see GatewayRegistration.
+ *
+ * Expects a bound ServerTransport resource, see `src/server/ServerMain.cpp`.
+ */
+class ServerPlugin final : public r::Plugin
+{
+    public:
+        explicit ServerPlugin(ServerPluginConfig config = {}) noexcept;
+
+        void build(r::Application &app) override;
+
+    private:
+        ServerPluginConfig _config;
+};
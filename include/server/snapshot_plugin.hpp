@@ -0,0 +1,20 @@
+#pragma once
+#include <R-Engine/Plugins/Plugin.hpp>
+
+/**
+ * @brief Replicates the battle of a single-match server: every tick, takes a WorldSnapshot and sends
+ * each peer that advertises F_SNAPSHOTS a CMD_SNAPSHOT delta against the last snapshot it acknowledged.
+ * @details Snapshots are pushed once into the shared SnapshotHistory of ServerSnapshots, and every
+ * peer's baseline is a reference into it, so the cost of a peer is its encoded delta only.
+ *
+ * The game client does not decode CMD_SNAPSHOT yet and never sets F_SNAPSHOTS, so no client is
+ * sent snapshots so far: the bandwidth figures come from `r-type-bench snapshot`, not from a match.
+ *
+ * Add it after the simulation plugins so the snapshot sees the state of the finished tick.
+ * Expects ServerPlugin in single-match mode.
+ */
+class ServerSnapshotPlugin final : public r::Plugin
+{
+    public:
+        void build(r::Application &app) override;
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <core/rtype_protocol.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace wire {
+
+/**
+ * @brief RTypeTCPPacket on a stream: magic, version, flags, type, then the payload size, big-endian, without padding.
+ */
+inline constexpr std::size_t TCP_HEADER_SIZE = 7;
+inline constexpr std::uint16_t TCP_MAGIC = 0x4257;
+
+/**
+ * @brief Largest payload accepted. Gateway messages are a few bytes; anything bigger is a broken peer.
+ */
+inline constexpr std::size_t TCP_MAX_PAYLOAD = 1024;
+
+/**
+ * @brief One frame as parsed from the stream. `payload` points into the FrameParser buffer.
+ */
+struct TcpFrame {
+        std::uint8_t version;
+        std::uint8_t flags;
+        rtype::protocol::RTypeTCPMessage type;
+        std::span<const std::uint8_t> payload;
+};
+
+/**
+ * @brief Incremental framing of a TCP stream, without copying the frames out.
+ * @details The socket reads straight into prepare(), commit() publishes what it read, and next()
+ * returns the complete frames one after the other as views into the buffer. Consumed bytes are only
+ * moved back to the front when prepare() runs out of room, so a read that carries many frames costs
+ * one recv() and no copy.
+ *
+ * Implementation lives in the source file `src/server/tcp_frame.cpp`.
+ */
+class FrameParser
+{
+    public:
+        enum class Status : std::uint8_t {
+            Frame,   ///< `frame` holds the next frame
+            NeedMore,///< No complete frame buffered
+            Invalid  ///< Wrong magic or oversized payload: the stream cannot be resynchronised
+        };
+
+        /**
+         * @brief Writable space of at least `min_size` bytes at the end of the buffer.
+         * @details Invalidates the payloads returned so far.
+         */
+        std::span<std::uint8_t> prepare(std::size_t min_size = 4096);
+
+        /**
+         * @brief Marks `size` bytes of the last prepare() as received.
+         */
+        void commit(std::size_t size) noexcept;
+
+        /**
+         * @brief Extracts the next complete frame. Its payload stays valid until the next prepare().
+         */
+        Status next(TcpFrame &frame) noexcept;
+
+    private:
+        std::vector<std::uint8_t> _buffer;
+        std::size_t _begin = 0;///< First byte not yet parsed
+        std::size_t _end = 0;  ///< One past the last received byte
+};
+
+/**
+ * @brief Appends the frame of `type` carrying `payload` to `out`.
+ * @return false, leaving `out` untouched, if the payload is over TCP_MAX_PAYLOAD.
+ */
+bool encode_frame(rtype::protocol::RTypeTCPMessage type, std::span<const std::uint8_t> payload, std::vector<std::uint8_t> &out);
+
+/**
+ * @brief Big-endian field of `width` bytes at `offset`; the caller checks the bounds.
+ */
+std::uint32_t load_be(std::span<const std::uint8_t> bytes, std::size_t offset, std::size_t width) noexcept;
+
+/**
+ * @brief Appends `value` as a big-endian field of `width` bytes.
+ */
+void append_be(std::vector<std::uint8_t> &out, std::size_t width, std::uint32_t value);
+
+}// namespace wire
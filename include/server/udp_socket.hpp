@@ -0,0 +1,72 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+
+/**
+ * @brief Non-blocking IPv4 UDP socket owned by the dedicated server.
+ * @details The engine's NetworkPlugin only connects out, so the server binds its own socket to the
+ * address and port of `network.cfg` and drains it once per tick. Copies share the descriptor:
+ * ServerMain binds it before building the Application, which then stores a copy in ServerTransport.
+ * The last copy closes it.
+ *
+ * POSIX only, like the server target. Implementation lives in the source file `src/server/udp_socket.cpp`.
+ */
+class UdpSocket
+{
+    public:
+        /**
+         * @brief IPv4 address and port, both in network byte order.
+         */
+        struct Endpoint {
+                std::uint32_t address = 0;
+                std::uint16_t port = 0;
+
+                bool operator==(const Endpoint &) const = default;
+        };
+
+        struct EndpointHash {
+                std::size_t operator()(const Endpoint &endpoint) const noexcept;
+        };
+
+        static constexpr std::size_t MAX_DATAGRAM_SIZE = 65507;
+
+        UdpSocket();
+
+        /**
+         * @brief Opens the socket on `address:port`. On failure, last_error() holds the errno.
+         */
+        bool bind(const std::string &address, std::uint16_t port);
+
+        /**
+         * @brief Reads one pending datagram into `buffer`, truncated to its size.
+         * @return The datagram length, or std::nullopt when nothing is pending.
+         */
+        std::optional<std::size_t> receive(std::span<std::uint8_t> buffer, Endpoint &from) const;
+
+        bool send(std::span<const std::uint8_t> datagram, const Endpoint &to) const;
+
+        /**
+         * @brief Blocks until a datagram is pending or `timeout` has passed.
+         * @return true when a datagram is pending.
+         */
+        bool wait_readable(std::chrono::milliseconds timeout) const;
+
+        bool is_open() const noexcept;
+        int last_error() const noexcept;
+
+        /**
+         * @brief `a.b.c.d:port`, for logs.
+         */
+        static std::string to_string(const Endpoint &endpoint);
+
+    private:
+        struct State;
+
+        std::shared_ptr<State> _state;
+};
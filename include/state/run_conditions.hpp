@@ -3,8 +3,12 @@
 #include <R-Engine/Core/States.hpp>
 #include <R-Engine/ECS/Query.hpp>
 #include <resources/game_mode.hpp>
+#include <resources/game_scope.hpp>
+#include <resources/update_tiers.hpp>
 #include <state/game_state.hpp>
 
+#include <cstdint>
+
 namespace run_conditions {
 
 /**
@@ -21,4 +25,48 @@ bool is_resuming_from_pause(r::ecs::Res<r::State<GameState>> state);
  */
 bool is_online_mode(r::ecs::Res<GameMode> mode);
 
+/**
+ * @brief Counts one run condition evaluation, see condition_evaluations().
+ * @details Compiled out of release builds, where conditions run every frame and stay a plain mask test.
+ */
+#if defined(R_TYPE_DEBUG)
+void count_condition_evaluation() noexcept;
+#else
+inline void count_condition_evaluation() noexcept
+{
+}
+#endif
+
+/**
+ * @brief Number of run conditions of this namespace evaluated since startup, to measure scheduler overhead.
+ * @details Every condition declared here counts, so a group gated on a scope and on the game mode
+ * counts twice. The engine's own conditions (`r::run_conditions::on_event`) are not counted.
+ * Only counted in R_TYPE_DEBUG builds, always 0 otherwise.
+ */
+std::uint64_t condition_evaluations() noexcept;
+
+/**
+ * @brief Run condition that returns true if the current GameState belongs to any of `Scopes`.
+ * @details A single mask test, whichever number of states the scopes cover.
+ */
+template<GameScope... Scopes>
+bool in_scope(r::ecs::Res<ActiveScopes> scopes)
+{
+    constexpr auto mask = static_cast<std::uint8_t>((static_cast<unsigned>(Scopes) | ...));
+    count_condition_evaluation();
+    return scopes.ptr && (scopes.ptr->mask & mask) != 0;
+}
+
+/**
+ * @brief Run condition for reduced-rate systems: true one frame out of `Period`, at `Phase`.
+ * @details The system then integrates UpdateTiers::elapsed(Period) instead of the frame time.
+ */
+template<std::uint32_t Period, std::uint32_t Phase = 0>
+bool every_n_frames(r::ecs::Res<UpdateTiers> tiers)
+{
+    static_assert(Period >= 1 && Period <= MAX_TIER_PERIOD && Phase < Period);
+    count_condition_evaluation();
+    return tiers.ptr && tiers.ptr->due(Period, Phase);
+}
+
 }// namespace run_conditions
@@ -3,19 +3,18 @@
 #include <plugins/enemy.hpp>
 #include <plugins/force.hpp>
 #include <plugins/game_state.hpp>
+#include <plugins/game_setup.hpp>
 #include <plugins/gameplay.hpp>
 #include <plugins/map.hpp>
 #include <plugins/menu.hpp>
+#include <plugins/particles.hpp>
 #include <plugins/ui_sfx.hpp>
 #include <plugins/pause.hpp>
 #include <plugins/player.hpp>
 #include <plugins/rtype_protocol_plugin.hpp>
 #include <plugins/settings.hpp>
 
-#include <events/debug.hpp>
-#include <events/game_events.hpp>
 #include <resources/game_mode.hpp>
-#include <resources/level.hpp>
 #include <state/game_state.hpp>
 
 #include <R-Engine/Application.hpp>
@@ -30,8 +29,6 @@
 
 #include <cstdlib>
 #include <ctime>
-#include <fstream>
-#include <string>
 
 /**
  * @brief Disables the default ESC key behavior for closing the window.
@@ -71,145 +68,13 @@ static void setup_core_game_system(r::ecs::ResMut<r::Camera3d> camera, r::ecs::R
     input_map.ptr->bindAction("Pause", r::GAMEPAD, GAMEPAD_BUTTON_MIDDLE_RIGHT);    ///< 'Start' button
 }
 
-static void setup_levels_system(r::ecs::Commands &commands)
-{
-    GameLevels game_levels;
-    game_levels.levels = {
-        {
-            .id = 1,
-            .enemy_spawn_interval = 0.75f,
-            .boss_spawn_time = 10.0f,
-            .background_texture_path = "assets/textures/background.png",
-            .scenery_model_path = "assets/models/BlackBuilding.glb",
-            .enemy_types =
-                {
-                    {
-                        "assets/models/enemy.glb",
-                        1,
-                        2.0f,
-                        EnemyBehaviorType::Straight,
-                        100,
-                    },
-                    {
-                        "assets/models/enemy.glb",
-                        2,
-                        1.5f,
-                        EnemyBehaviorType::Straight,
-                        150,
-                    },
-                },
-            .boss_data =
-                {
-                    .model_path = "assets/models/Boss.glb",
-                    .max_health = 500,
-                    .behavior = BossBehaviorType::VerticalPatrol,
-                    .score_value = 5000,
-                },
-        },
-        {
-            .id = 2,
-            .enemy_spawn_interval = 0.5f,
-            .boss_spawn_time = 15.0f,
-            .background_texture_path = "assets/textures/background_level2.png",
-            .scenery_model_path = "assets/models/Asteroid.glb",
-            .enemy_types =
-                {
-                    {
-                        "assets/models/enemy_2.glb",
-                        2,
-                        3.0f,
-                        EnemyBehaviorType::SineWave,
-                        200,
-                    },
-                },
-            .boss_data =
-                {
-                    .model_path = "assets/models/boss_2.glb",
-                    .max_health = 750,
-                    .behavior = BossBehaviorType::HomingAttack,
-                    .score_value = 7500,
-                },
-        },
-        {
-            .id = 3,
-            .enemy_spawn_interval = 0.3f,
-            .boss_spawn_time = 20.0f,
-            .background_texture_path = "assets/textures/background_level3.png",
-            .scenery_model_path = "assets/models/FortressWall.glb",
-            .enemy_types =
-                {
-                    {
-                        "assets/models/enemy.glb",
-                        3,
-                        2.0f,
-                        EnemyBehaviorType::Homing,
-                        300,
-                    },
-                    {
-                        "assets/models/enemy.glb",
-                        1,
-                        4.0f,
-                        EnemyBehaviorType::Straight,
-                        100,
-                    },
-                },
-            .boss_data =
-                {
-                    .model_path = "assets/models/Boss.glb",
-                    .max_health = 1000,
-                    .behavior = BossBehaviorType::Turret,
-                    .score_value = 10000,
-                },
-        },
-    };
-    commands.insert_resource(game_levels);
-    commands.insert_resource(CurrentLevel{0}); /* Start at level 0 */
-}
-
 /**
  * @brief (STARTUP) Loads network settings from `network.cfg`.
- * @details If the file doesn't exist, it creates it with default values.
- * This allows players to configure the server address and port externally.
+ * @details This allows players to configure the server address and port externally.
  */
 static void load_network_config_system(r::ecs::Commands &commands)
 {
-    NetworkConfig config;
-    const std::string filename = "network.cfg";
-    std::ifstream config_file(filename);
-
-    if (config_file.is_open()) {
-        std::string line;
-        while (std::getline(config_file, line)) {
-            std::string key;
-            std::string value;
-            size_t separator_pos = line.find('=');
-            if (separator_pos != std::string::npos) {
-                key = line.substr(0, separator_pos);
-                value = line.substr(separator_pos + 1);
-
-                if (key == "address") {
-                    config.server_address = value;
-                } else if (key == "port") {
-                    try {
-                        config.server_port = static_cast<unsigned short>(std::stoi(value));
-                    } catch (...) {
-                        /* Keep default port if parsing fails */
-                    }
-                }
-            }
-        }
-        r::Logger::info("Loaded network config from " + filename);
-    } else {
-        // File doesn't exist, create it with defaults
-        std::ofstream new_config_file(filename);
-        if (new_config_file.is_open()) {
-            new_config_file << "address=" << config.server_address << std::endl;
-            new_config_file << "port=" << config.server_port << std::endl;
-            r::Logger::info(filename + " not found. Created with default settings.");
-        }
-    }
-
-    commands.insert_resource(config);
+    commands.insert_resource(load_network_config("network.cfg"));
 }
 
 int main()
@@ -228,8 +93,8 @@ int main()
                     .engine_assets_prefix = "external/R-Engine/assets/",
                 }}))
 
-        /* Register all custom game events */
-        .add_events<PlayerDiedEvent, BossTimeReachedEvent, BossDefeatedEvent, EntityDiedEvent, DebugSwitchLevelEvent>()
+        /* Register the game events and the level table */
+        .add_plugins(GameSetupPlugin{})
 
         /* Insert game-wide resources */
         .insert_resource(GameMode::Offline)
@@ -250,13 +115,13 @@ int main()
         .add_plugins(EnemyPlugin{})
         .add_plugins(GameplayPlugin{})
         .add_plugins(CombatPlugin{})
+        .add_plugins(ParticlesPlugin{})
         // .add_plugins(DebugPlugin{})
 
         /* Add the remaining core setup */
         .add_systems<disable_escape_key_system>(r::Schedule::STARTUP)
         .add_systems<load_network_config_system>(r::Schedule::STARTUP)
         .add_systems<setup_core_game_system>(r::Schedule::STARTUP)
-        .add_systems<setup_levels_system>(r::Schedule::STARTUP)
 
         .run();
 
@@ -0,0 +1,43 @@
+#include <core/alloc_counter.hpp>
+
+#if defined(R_TYPE_DEBUG)
+
+    #include <atomic>
+    #include <cstdlib>
+    #include <new>
+
+static std::atomic<std::uint64_t> allocation_count{0};
+
+/* The array and nothrow forms forward to these two by default, so they are counted too */
+void *operator new(std::size_t size)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void *ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+std::uint64_t global_allocations() noexcept
+{
+    return allocation_count.load(std::memory_order_relaxed);
+}
+
+#else
+
+std::uint64_t global_allocations() noexcept
+{
+    return 0;
+}
+
+#endif
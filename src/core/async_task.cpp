@@ -0,0 +1,90 @@
+#include <core/async_task.hpp>
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+struct AsyncTask::State {
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable done;
+
+        TaskFn fn = nullptr;
+        void *context = nullptr;
+        bool pending = false; /* Launched and not finished yet */
+        bool stop = false;
+        std::exception_ptr error;
+
+        std::thread thread;
+
+        State() : thread([this] { loop(); })
+        {
+        }
+
+        ~State()
+        {
+            {
+                std::unique_lock lock(mutex);
+                done.wait(lock, [this] { return !pending; });
+                stop = true;
+            }
+            wake.notify_one();
+            thread.join();
+        }
+
+        void loop()
+        {
+            std::unique_lock lock(mutex);
+            for (;;) {
+                wake.wait(lock, [this] { return stop || (pending && fn); });
+                if (stop) {
+                    return;
+                }
+                const TaskFn job = std::exchange(fn, nullptr);
+                lock.unlock();
+                std::exception_ptr failure;
+                try {
+                    job(context);
+                } catch (...) {
+                    failure = std::current_exception();
+                }
+                lock.lock();
+                error = failure;
+                pending = false;
+                done.notify_all();
+            }
+        }
+};
+
+AsyncTask::AsyncTask() : _state(std::make_shared<State>())
+{
+}
+
+void AsyncTask::launch(TaskFn fn, void *context)
+{
+    wait();
+    {
+        std::lock_guard lock(_state->mutex);
+        _state->fn = fn;
+        _state->context = context;
+        _state->pending = true;
+    }
+    _state->wake.notify_one();
+}
+
+void AsyncTask::wait() const
+{
+    std::unique_lock lock(_state->mutex);
+    _state->done.wait(lock, [this] { return !_state->pending; });
+    if (_state->error) {
+        std::rethrow_exception(std::exchange(_state->error, nullptr));
+    }
+}
+
+bool AsyncTask::busy() const noexcept
+{
+    std::lock_guard lock(_state->mutex);
+    return _state->pending;
+}
@@ -0,0 +1,51 @@
+#include <core/bit_stream.hpp>
+
+/* ================================================================================= */
+/* BitReader */
+/* ================================================================================= */
+
+BitReader::BitReader(std::span<const std::uint8_t> in) noexcept : _in(in)
+{
+}
+
+std::uint32_t BitReader::read(unsigned bits) noexcept
+{
+    if (bits > remaining_bits()) {
+        _failed = true;
+        _position = _in.size() * 8;
+        return 0;
+    }
+    std::uint32_t value = 0;
+    while (bits > 0) {
+        /* Take as many bits as the current byte has left, at most the ones still wanted */
+        const unsigned offset = static_cast<unsigned>(_position % 8);
+        const unsigned available = 8 - offset;
+        const unsigned take = bits < available ? bits : available;
+        const unsigned byte = _in[_position / 8];
+        const unsigned chunk = (byte >> (available - take)) & ((1u << take) - 1);
+        value = static_cast<std::uint32_t>((std::uint64_t{value} << take) | chunk);
+        _position += take;
+        bits -= take;
+    }
+    return value;
+}
+
+bool BitReader::read_bool() noexcept
+{
+    return read(1) != 0;
+}
+
+float BitReader::read(const QuantizedRange &range) noexcept
+{
+    return range.dequantize(read(range.bits));
+}
+
+bool BitReader::failed() const noexcept
+{
+    return _failed;
+}
+
+std::size_t BitReader::remaining_bits() const noexcept
+{
+    return _in.size() * 8 - _position;
+}
@@ -0,0 +1,136 @@
+#include <core/collision_shapes.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace shapes {
+
+static float dot(const r::Vec3f &a, const r::Vec3f &b) noexcept
+{
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+bool sphere_vs_sphere(const r::Vec3f &center, float radius, const r::Vec3f &other_center, float other_radius) noexcept
+{
+    const r::Vec3f delta = center - other_center;
+    const float radii = radius + other_radius;
+    return dot(delta, delta) < radii * radii;
+}
+
+float point_segment_distance_sq(const r::Vec3f &point, const r::Vec3f &seg_a, const r::Vec3f &seg_b) noexcept
+{
+    const r::Vec3f segment = seg_b - seg_a;
+    const r::Vec3f to_point = point - seg_a;
+    const float length_sq = dot(segment, segment);
+
+    float t = 0.0f;
+    if (length_sq > 0.0f) {
+        t = std::clamp(dot(to_point, segment) / length_sq, 0.0f, 1.0f);
+    }
+    const r::Vec3f delta = to_point - segment * t;
+    return dot(delta, delta);
+}
+
+bool sphere_vs_capsule(const r::Vec3f &center, float radius, const r::Vec3f &seg_a, const r::Vec3f &seg_b, float capsule_radius) noexcept
+{
+    const float radii = radius + capsule_radius;
+    return point_segment_distance_sq(center, seg_a, seg_b) < radii * radii;
+}
+
+bool sphere_vs_aabb(const r::Vec3f &center, float radius, const r::Vec3f &box_center, const r::Vec3f &half_extents) noexcept
+{
+    const r::Vec3f local = center - box_center;
+    const r::Vec3f closest = {
+        std::clamp(local.x, -half_extents.x, half_extents.x),
+        std::clamp(local.y, -half_extents.y, half_extents.y),
+        std::clamp(local.z, -half_extents.z, half_extents.z),
+    };
+    const r::Vec3f delta = local - closest;
+    return dot(delta, delta) < radius * radius;
+}
+
+float segment_segment_distance_sq(const r::Vec3f &a0, const r::Vec3f &a1, const r::Vec3f &b0, const r::Vec3f &b1) noexcept
+{
+    constexpr float EPSILON = 1e-8f;
+    const r::Vec3f d1 = a1 - a0;
+    const r::Vec3f d2 = b1 - b0;
+    const r::Vec3f r0 = a0 - b0;
+    const float a = dot(d1, d1);
+    const float e = dot(d2, d2);
+    const float f = dot(d2, r0);
+
+    float s = 0.0f;
+    float t = 0.0f;
+    if (a <= EPSILON && e <= EPSILON) {
+        return dot(r0, r0);
+    }
+    if (a <= EPSILON) {
+        t = std::clamp(f / e, 0.0f, 1.0f);
+    } else {
+        const float c = dot(d1, r0);
+        if (e <= EPSILON) {
+            s = std::clamp(-c / a, 0.0f, 1.0f);
+        } else {
+            const float b = dot(d1, d2);
+            const float denom = a * e - b * b;
+            /* Parallel segments: any s works, pick the start */
+            s = denom > EPSILON ? std::clamp((b * f - c * e) / denom, 0.0f, 1.0f) : 0.0f;
+            t = (b * s + f) / e;
+            if (t < 0.0f) {
+                t = 0.0f;
+                s = std::clamp(-c / a, 0.0f, 1.0f);
+            } else if (t > 1.0f) {
+                t = 1.0f;
+                s = std::clamp((b - c) / a, 0.0f, 1.0f);
+            }
+        }
+    }
+    const r::Vec3f delta = (a0 + d1 * s) - (b0 + d2 * t);
+    return dot(delta, delta);
+}
+
+/* ================================================================================= */
+/* Swept tests */
+/* ================================================================================= */
+
+bool sweep_vs_sphere(const Sweep &sweep, const r::Vec3f &center, float radius) noexcept
+{
+    const float radii = sweep.radius + radius;
+    return point_segment_distance_sq(center, sweep.start, sweep.end) < radii * radii;
+}
+
+bool sweep_vs_capsule(const Sweep &sweep, const r::Vec3f &seg_a, const r::Vec3f &seg_b, float capsule_radius) noexcept
+{
+    const float radii = sweep.radius + capsule_radius;
+    return segment_segment_distance_sq(sweep.start, sweep.end, seg_a, seg_b) < radii * radii;
+}
+
+/* Clips the segment parameter range [t_min, t_max] against one slab of the grown box */
+static bool clip_slab(float start, float delta, float slab_min, float slab_max, float &t_min, float &t_max) noexcept
+{
+    if (std::fabs(delta) < 1e-8f) {
+        return start >= slab_min && start <= slab_max;
+    }
+    float t0 = (slab_min - start) / delta;
+    float t1 = (slab_max - start) / delta;
+    if (t0 > t1) {
+        std::swap(t0, t1);
+    }
+    t_min = std::max(t_min, t0);
+    t_max = std::min(t_max, t1);
+    return t_min <= t_max;
+}
+
+bool sweep_vs_aabb(const Sweep &sweep, const r::Vec3f &box_center, const r::Vec3f &half_extents) noexcept
+{
+    const r::Vec3f start = sweep.start - box_center;
+    const r::Vec3f delta = sweep.end - sweep.start;
+    const r::Vec3f grown = {half_extents.x + sweep.radius, half_extents.y + sweep.radius, half_extents.z + sweep.radius};
+    float t_min = 0.0f;
+    float t_max = 1.0f;
+
+    return clip_slab(start.x, delta.x, -grown.x, grown.x, t_min, t_max) && clip_slab(start.y, delta.y, -grown.y, grown.y, t_min, t_max)
+        && clip_slab(start.z, delta.z, -grown.z, grown.z, t_min, t_max);
+}
+
+}// namespace shapes
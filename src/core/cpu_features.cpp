@@ -0,0 +1,62 @@
+#include <core/cpu_features.hpp>
+
+#if defined(R_TYPE_SIMD_X86) && defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+#if defined(R_TYPE_SIMD_X86) && defined(_MSC_VER) && !defined(__clang__)
+
+static bool msvc_os_saves(unsigned long long xcr0_mask)
+{
+    int regs[4] = {};
+    __cpuid(regs, 1);
+    const bool osxsave = (regs[2] & (1 << 27)) != 0;
+    return osxsave && (_xgetbv(0) & xcr0_mask) == xcr0_mask;
+}
+
+static CpuFeatures detect()
+{
+    int leaf1[4] = {};
+    int leaf7[4] = {};
+    __cpuid(leaf1, 1);
+    __cpuidex(leaf7, 7, 0);
+
+    const bool ymm = msvc_os_saves(0x6);
+    const bool zmm = msvc_os_saves(0xE6);
+
+    CpuFeatures features;
+    features.sse2 = (leaf1[3] & (1 << 26)) != 0;
+    features.fma = ymm && (leaf1[2] & (1 << 12)) != 0;
+    features.avx2 = ymm && (leaf7[1] & (1 << 5)) != 0;
+    features.avx512f = zmm && (leaf7[1] & (1 << 16)) != 0;
+    return features;
+}
+
+#elif defined(R_TYPE_SIMD_X86)
+
+static CpuFeatures detect()
+{
+    __builtin_cpu_init();
+
+    CpuFeatures features;
+    features.sse2 = __builtin_cpu_supports("sse2");
+    features.avx2 = __builtin_cpu_supports("avx2");
+    features.fma = __builtin_cpu_supports("fma");
+    features.avx512f = __builtin_cpu_supports("avx512f");
+    return features;
+}
+
+#else
+
+static CpuFeatures detect()
+{
+    return {};
+}
+
+#endif
+
+const CpuFeatures &cpu_features() noexcept
+{
+    static const CpuFeatures features = detect();
+    return features;
+}
@@ -0,0 +1,72 @@
+#include <core/entity_arena.hpp>
+
+#include <algorithm>
+
+void EntityArena::reserve(std::size_t capacity)
+{
+    _dense.reserve(capacity);
+}
+
+void EntityArena::track(r::ecs::Entity entity)
+{
+    if (entity == r::ecs::NULL_ENTITY || contains(entity)) {
+        return;
+    }
+
+    const auto index = static_cast<std::size_t>(entity);
+    if (index >= _sparse.size()) {
+        _sparse.resize(std::max(index + 1, _sparse.size() * 2));
+    }
+    _sparse[index] = static_cast<std::uint32_t>(_dense.size());
+    _dense.push_back(entity);
+}
+
+void EntityArena::release(r::ecs::Entity entity) noexcept
+{
+    if (!contains(entity)) {
+        return;
+    }
+
+    const std::uint32_t slot = _sparse[static_cast<std::size_t>(entity)];
+    const r::ecs::Entity last = _dense.back();
+
+    _dense[slot] = last;
+    _sparse[static_cast<std::size_t>(last)] = slot;
+    _dense.pop_back();
+}
+
+bool EntityArena::contains(r::ecs::Entity entity) const noexcept
+{
+    const auto index = static_cast<std::size_t>(entity);
+    if (index >= _sparse.size()) {
+        return false;
+    }
+    const std::uint32_t slot = _sparse[index];
+    return slot < _dense.size() && _dense[slot] == entity;
+}
+
+void EntityArena::clear() noexcept
+{
+    /* Entities are trivially destructible: this only resets the size. */
+    _dense.clear();
+}
+
+std::size_t EntityArena::size() const noexcept
+{
+    return _dense.size();
+}
+
+std::size_t EntityArena::capacity() const noexcept
+{
+    return _dense.capacity();
+}
+
+const r::ecs::Entity *EntityArena::begin() const noexcept
+{
+    return _dense.data();
+}
+
+const r::ecs::Entity *EntityArena::end() const noexcept
+{
+    return _dense.data() + _dense.size();
+}
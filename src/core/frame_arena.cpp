@@ -0,0 +1,67 @@
+#include <core/frame_arena.hpp>
+
+namespace {
+
+/**
+ * @brief Upstream of the monotonic resource: forwards to the heap and counts what spilled there.
+ */
+class OverflowResource final : public std::pmr::memory_resource
+{
+    public:
+        std::size_t bytes = 0;
+
+    private:
+        void *do_allocate(std::size_t size, std::size_t alignment) override
+        {
+            bytes += size;
+            return std::pmr::new_delete_resource()->allocate(size, alignment);
+        }
+
+        void do_deallocate(void *ptr, std::size_t size, std::size_t alignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(ptr, size, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+        {
+            return this == &other;
+        }
+};
+
+}// namespace
+
+struct FrameArena::State {
+        std::unique_ptr<std::byte[]> block;
+        OverflowResource overflow;
+        std::pmr::monotonic_buffer_resource arena;
+
+        explicit State(std::size_t capacity)
+            : block(std::make_unique<std::byte[]>(capacity)), arena(block.get(), capacity, &overflow)
+        {
+        }
+};
+
+FrameArena::FrameArena() : FrameArena(DEFAULT_CAPACITY)
+{
+}
+
+FrameArena::FrameArena(std::size_t capacity) : _state(std::make_shared<State>(capacity))
+{
+}
+
+std::pmr::memory_resource *FrameArena::resource() const noexcept
+{
+    return &_state->arena;
+}
+
+void FrameArena::reset() noexcept
+{
+    /* Returns the spilled chunks to the heap and rewinds to the start of the block */
+    _state->arena.release();
+    _state->overflow.bytes = 0;
+}
+
+std::size_t FrameArena::overflow_bytes() const noexcept
+{
+    return _state->overflow.bytes;
+}
@@ -0,0 +1,204 @@
+#include <core/job_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* ================================================================================= */
+/* Shared state */
+/* ================================================================================= */
+
+/* Set on worker threads and while the caller executes chunks, so nested parallel_for calls run inline. */
+static thread_local bool tl_inside_job = false;
+
+namespace {
+
+/**
+ * @brief Contiguous run of chunk indices owned by one thread. The owner pops from the front,
+ * thieves pop from the back.
+ */
+struct ChunkRange {
+        std::mutex mutex;
+        std::size_t front = 0;
+        std::size_t back = 0;
+};
+
+}// namespace
+
+struct JobPool::State {
+        std::vector<std::thread> workers;
+        std::unique_ptr<ChunkRange[]> ranges;
+        std::size_t range_count = 0;
+
+        std::mutex submit_mutex;
+
+        std::mutex wake_mutex;
+        std::condition_variable wake;
+        std::uint64_t generation = 0;
+        bool stop = false;
+
+        std::mutex done_mutex;
+        std::condition_variable done;
+        std::atomic<std::size_t> remaining{0};
+
+        ChunkFn fn = nullptr;
+        void *context = nullptr;
+        std::size_t count = 0;
+        std::size_t grain = 1;
+
+        ~State();
+
+        bool take_own(std::size_t slot, std::size_t &chunk);
+        bool steal(std::size_t thief, std::size_t &chunk);
+        void run(std::size_t slot);
+        void worker_loop(std::size_t slot);
+};
+
+JobPool::State::~State()
+{
+    {
+        std::lock_guard lock(wake_mutex);
+        stop = true;
+    }
+    wake.notify_all();
+    for (auto &worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+bool JobPool::State::take_own(std::size_t slot, std::size_t &chunk)
+{
+    auto &range = ranges[slot];
+    std::lock_guard lock(range.mutex);
+
+    if (range.front >= range.back) {
+        return false;
+    }
+    chunk = range.front++;
+    return true;
+}
+
+bool JobPool::State::steal(std::size_t thief, std::size_t &chunk)
+{
+    for (std::size_t offset = 1; offset < range_count; ++offset) {
+        auto &range = ranges[(thief + offset) % range_count];
+        std::lock_guard lock(range.mutex);
+
+        if (range.front < range.back) {
+            chunk = --range.back;
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobPool::State::run(std::size_t slot)
+{
+    std::size_t chunk = 0;
+
+    while (take_own(slot, chunk) || steal(slot, chunk)) {
+        const std::size_t begin = chunk * grain;
+        const std::size_t end = std::min(begin + grain, count);
+        fn(context, begin, end);
+
+        if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::lock_guard lock(done_mutex);
+            done.notify_one();
+        }
+    }
+}
+
+void JobPool::State::worker_loop(std::size_t slot)
+{
+    tl_inside_job = true;
+    std::uint64_t seen = 0;
+
+    for (;;) {
+        {
+            std::unique_lock lock(wake_mutex);
+            wake.wait(lock, [&] { return stop || generation != seen; });
+            if (stop) {
+                return;
+            }
+            seen = generation;
+        }
+        run(slot);
+    }
+}
+
+/* ================================================================================= */
+/* JobPool */
+/* ================================================================================= */
+
+JobPool::JobPool(std::size_t worker_count) : _state(std::make_shared<State>())
+{
+    if (worker_count == 0) {
+        const std::size_t hardware = std::thread::hardware_concurrency();
+        worker_count = hardware > 1 ? hardware - 1 : 0;
+    }
+
+    _state->range_count = worker_count + 1;
+    _state->ranges = std::make_unique<ChunkRange[]>(_state->range_count);
+    _state->workers.reserve(worker_count);
+
+    /* Slot 0 belongs to the thread calling parallel_for */
+    for (std::size_t slot = 1; slot <= worker_count; ++slot) {
+        _state->workers.emplace_back([state = _state.get(), slot] { state->worker_loop(slot); });
+    }
+}
+
+std::size_t JobPool::concurrency() const noexcept
+{
+    return _state->range_count;
+}
+
+void JobPool::dispatch(std::size_t count, std::size_t grain, ChunkFn fn, void *context) const
+{
+    if (count == 0) {
+        return;
+    }
+    grain = std::max<std::size_t>(grain, 1);
+    const std::size_t chunks = (count + grain - 1) / grain;
+
+    if (chunks == 1 || _state->workers.empty() || tl_inside_job) {
+        for (std::size_t begin = 0; begin < count; begin += grain) {
+            fn(context, begin, std::min(begin + grain, count));
+        }
+        return;
+    }
+
+    State &state = *_state;
+    std::lock_guard submit(state.submit_mutex);
+
+    state.fn = fn;
+    state.context = context;
+    state.count = count;
+    state.grain = grain;
+    state.remaining.store(chunks, std::memory_order_relaxed);
+
+    for (std::size_t slot = 0; slot < state.range_count; ++slot) {
+        auto &range = state.ranges[slot];
+        std::lock_guard lock(range.mutex);
+        range.front = slot * chunks / state.range_count;
+        range.back = (slot + 1) * chunks / state.range_count;
+    }
+
+    {
+        std::lock_guard lock(state.wake_mutex);
+        ++state.generation;
+    }
+    state.wake.notify_all();
+
+    tl_inside_job = true;
+    state.run(0);
+    tl_inside_job = false;
+
+    std::unique_lock lock(state.done_mutex);
+    state.done.wait(lock, [&] { return state.remaining.load(std::memory_order_acquire) == 0; });
+}
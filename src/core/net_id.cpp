@@ -0,0 +1,114 @@
+#include <core/net_id.hpp>
+
+#include <algorithm>
+
+/* ================================================================================= */
+/* ReplicationRegistry */
+/* ================================================================================= */
+
+ReplicationRegistry::ReplicationRegistry(std::size_t quarantine) : _quarantine(quarantine)
+{
+}
+
+void ReplicationRegistry::begin_snapshot() noexcept
+{
+    ++_snapshot;
+}
+
+NetId ReplicationRegistry::replicate(r::ecs::Entity entity)
+{
+    if (entity == r::ecs::NULL_ENTITY) {
+        return {};
+    }
+    const NetId known = find(entity);
+    if (known) {
+        _slots[known.index()].seen = _snapshot;
+        return known;
+    }
+
+    while (!_quarantined.empty() && _quarantined.front().until <= _snapshot) {
+        _free.push_back(_quarantined.front().index);
+        _quarantined.pop_front();
+    }
+    std::uint16_t index = 0;
+    if (!_free.empty()) {
+        index = _free.back();
+        _free.pop_back();
+    } else if (_slots.size() <= NET_ID_CAPACITY) {
+        index = static_cast<std::uint16_t>(_slots.size());
+        _slots.emplace_back();
+    } else {
+        return {};
+    }
+
+    Slot &slot = _slots[index];
+    slot.entity = entity;
+    slot.seen = _snapshot;
+    _live.push_back(index);
+
+    const NetId id = NetId::make(index, slot.generation);
+    const auto position = static_cast<std::size_t>(entity);
+    if (position >= _sparse.size()) {
+        _sparse.resize(std::max(position + 1, _sparse.size() * 2));
+    }
+    _sparse[position] = id;
+    return id;
+}
+
+void ReplicationRegistry::end_snapshot()
+{
+    for (std::size_t i = _live.size(); i-- > 0;) {
+        const std::uint16_t index = _live[i];
+        Slot &slot = _slots[index];
+        if (slot.seen == _snapshot) {
+            continue;
+        }
+        _sparse[static_cast<std::size_t>(slot.entity)] = {};
+        slot.entity = r::ecs::NULL_ENTITY;
+        slot.generation = static_cast<std::uint16_t>((slot.generation + 1) & NetId::GENERATION_MASK);
+        _quarantined.push_back({index, static_cast<std::uint32_t>(_snapshot + _quarantine + 1)});
+        _live[i] = _live.back();
+        _live.pop_back();
+    }
+}
+
+NetId ReplicationRegistry::find(r::ecs::Entity entity) const noexcept
+{
+    const auto position = static_cast<std::size_t>(entity);
+    return position < _sparse.size() ? _sparse[position] : NetId{};
+}
+
+std::size_t ReplicationRegistry::size() const noexcept
+{
+    return _live.size();
+}
+
+/* ================================================================================= */
+/* NetEntityMap */
+/* ================================================================================= */
+
+NetEntityMap::NetEntityMap() : _bindings(NET_ID_CAPACITY + 1)
+{
+}
+
+void NetEntityMap::bind(NetId id, r::ecs::Entity entity) noexcept
+{
+    if (id) {
+        _bindings[id.index()] = {id, entity};
+    }
+}
+
+r::ecs::Entity NetEntityMap::unbind(NetId id) noexcept
+{
+    const r::ecs::Entity entity = find(id);
+    if (entity != r::ecs::NULL_ENTITY) {
+        _bindings[id.index()] = {};
+    }
+    return entity;
+}
+
+r::ecs::Entity NetEntityMap::find(NetId id) const noexcept
+{
+    const Binding &binding = _bindings[id.index()];
+    return id && binding.id == id ? binding.entity : r::ecs::NULL_ENTITY;
+}
@@ -0,0 +1,324 @@
+#include <core/packet_payload.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <vector>
+
+static constexpr std::size_t SIZE_CLASS_COUNT = 6;              /* 64 B, 256 B, 1 KiB, 4 KiB, 16 KiB, 64 KiB */
+static constexpr std::size_t SMALLEST_CLASS = 64;
+static constexpr std::size_t MAX_FREE_PER_CLASS = 256;
+static constexpr std::size_t MAX_FREE_BYTES_PER_CLASS = 1024 * 1024; /* Caps what a burst of big packets leaves behind */
+static constexpr std::uint8_t UNPOOLED = SIZE_CLASS_COUNT;
+
+static constexpr std::size_t class_capacity(std::size_t size_class) noexcept
+{
+    return SMALLEST_CLASS << (2 * size_class);
+}
+
+/**
+ * @brief Smallest class holding `size` bytes, UNPOOLED past the biggest one.
+ */
+static std::uint8_t class_of(std::size_t size) noexcept
+{
+    std::uint8_t size_class = 0;
+    while (size_class < SIZE_CLASS_COUNT && class_capacity(size_class) < size) {
+        ++size_class;
+    }
+    return size_class;
+}
+
+/* ================================================================================= */
+/* Pool */
+/* ================================================================================= */
+
+struct PacketPayload::Block {
+        std::atomic<std::uint32_t> refs{1};
+        std::uint32_t capacity;
+        std::uint8_t size_class;
+
+        Block(std::uint32_t bytes, std::uint8_t index) noexcept : capacity(bytes), size_class(index)
+        {
+        }
+
+        /* The bytes follow the header in the same allocation */
+        std::uint8_t *bytes() noexcept
+        {
+            return reinterpret_cast<std::uint8_t *>(this + 1);
+        }
+};
+
+struct PacketPayload::Pool {
+        struct SizeClass {
+                std::mutex mutex;
+                std::vector<Block *> free;
+        };
+
+        std::array<SizeClass, SIZE_CLASS_COUNT> classes;
+        std::atomic<std::size_t> allocated{0};
+        std::atomic<std::size_t> recycled{0};
+
+        Pool()
+        {
+            /* Reserved up front: recycling a block never allocates */
+            for (std::size_t i = 0; i < SIZE_CLASS_COUNT; ++i) {
+                classes[i].free.reserve(limit(i));
+            }
+        }
+
+        static std::size_t limit(std::size_t size_class) noexcept
+        {
+            return std::min(MAX_FREE_PER_CLASS, MAX_FREE_BYTES_PER_CLASS / class_capacity(size_class));
+        }
+
+        /* Never destroyed: payloads in static storage may be released after it would have been */
+        static Pool &instance()
+        {
+            static Pool *pool = new Pool;
+            return *pool;
+        }
+
+        Block *acquire(std::size_t size)
+        {
+            const std::uint8_t size_class = class_of(size);
+            if (size_class != UNPOOLED) {
+                SizeClass &entry = classes[size_class];
+                const std::scoped_lock lock{entry.mutex};
+                if (!entry.free.empty()) {
+                    Block *block = entry.free.back();
+                    entry.free.pop_back();
+                    block->refs.store(1, std::memory_order_relaxed);
+                    recycled.fetch_add(1, std::memory_order_relaxed);
+                    return block;
+                }
+            }
+
+            const std::size_t capacity = size_class == UNPOOLED ? size : class_capacity(size_class);
+            void *memory = ::operator new(sizeof(Block) + capacity);
+            allocated.fetch_add(1, std::memory_order_relaxed);
+            return ::new (memory) Block{static_cast<std::uint32_t>(capacity), size_class};
+        }
+
+        void recycle(Block *block) noexcept
+        {
+            if (block->size_class != UNPOOLED) {
+                SizeClass &entry = classes[block->size_class];
+                const std::scoped_lock lock{entry.mutex};
+                if (entry.free.size() < entry.free.capacity()) {
+                    entry.free.push_back(block);
+                    return;
+                }
+            }
+            block->~Block();
+            ::operator delete(block);
+        }
+};
+
+/* ================================================================================= */
+/* Payload */
+/* ================================================================================= */
+
+PacketPayload::PacketPayload(std::span<const std::uint8_t> bytes)
+{
+    assign(bytes);
+}
+
+PacketPayload::PacketPayload(const PacketPayload &other) noexcept : _block(other._block), _size(other._size), _inline(other._inline)
+{
+    if (_block) {
+        _block->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+PacketPayload::PacketPayload(PacketPayload &&other) noexcept : _block(other._block), _size(other._size), _inline(other._inline)
+{
+    other._block = nullptr;
+    other._size = 0;
+}
+
+PacketPayload &PacketPayload::operator=(const PacketPayload &other) noexcept
+{
+    if (this != &other) {
+        if (other._block) {
+            other._block->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+        release();
+        _block = other._block;
+        _size = other._size;
+        _inline = other._inline;
+    }
+    return *this;
+}
+
+PacketPayload &PacketPayload::operator=(PacketPayload &&other) noexcept
+{
+    if (this != &other) {
+        release();
+        _block = other._block;
+        _size = other._size;
+        _inline = other._inline;
+        other._block = nullptr;
+        other._size = 0;
+    }
+    return *this;
+}
+
+PacketPayload::~PacketPayload()
+{
+    release();
+}
+
+void PacketPayload::assign(std::span<const std::uint8_t> bytes)
+{
+    if (bytes.size() <= INLINE_CAPACITY) {
+        /* Back to inline: a small payload gives its block back right away */
+        std::array<std::uint8_t, INLINE_CAPACITY> copy{};
+        std::ranges::copy(bytes, copy.begin());
+        release();
+        _inline = copy;
+    } else if (owns_block(bytes.size())) {
+        /* memmove: `bytes` may be a part of this payload */
+        std::memmove(_block->bytes(), bytes.data(), bytes.size());
+    } else {
+        Block *block = Pool::instance().acquire(bytes.size());
+        std::memcpy(block->bytes(), bytes.data(), bytes.size());
+        release();
+        _block = block;
+    }
+    _size = static_cast<std::uint32_t>(bytes.size());
+}
+
+void PacketPayload::push_back(std::uint8_t byte)
+{
+    make_unique(_size + 1);
+    storage()[_size++] = byte;
+}
+
+void PacketPayload::resize(std::size_t size)
+{
+    make_unique(size);
+    _size = static_cast<std::uint32_t>(size);
+}
+
+void PacketPayload::reserve(std::size_t capacity)
+{
+    make_unique(capacity);
+}
+
+void PacketPayload::clear() noexcept
+{
+    release();
+    _size = 0;
+}
+
+const std::uint8_t *PacketPayload::data() const noexcept
+{
+    return _block ? _block->bytes() : _inline.data();
+}
+
+std::uint8_t *PacketPayload::data()
+{
+    make_unique(_size);
+    return storage();
+}
+
+std::size_t PacketPayload::size() const noexcept
+{
+    return _size;
+}
+
+std::size_t PacketPayload::capacity() const noexcept
+{
+    return _block ? _block->capacity : INLINE_CAPACITY;
+}
+
+bool PacketPayload::empty() const noexcept
+{
+    return _size == 0;
+}
+
+bool PacketPayload::is_inline() const noexcept
+{
+    return _block == nullptr;
+}
+
+std::uint8_t PacketPayload::front() const noexcept
+{
+    return data()[0];
+}
+
+std::uint8_t PacketPayload::operator[](std::size_t index) const noexcept
+{
+    return data()[index];
+}
+
+const std::uint8_t *PacketPayload::begin() const noexcept
+{
+    return data();
+}
+
+const std::uint8_t *PacketPayload::end() const noexcept
+{
+    return data() + _size;
+}
+
+PacketPayload::operator std::span<const std::uint8_t>() const noexcept
+{
+    return {data(), _size};
+}
+
+bool PacketPayload::operator==(const PacketPayload &other) const noexcept
+{
+    return _size == other._size && (_size == 0 || std::memcmp(data(), other.data(), _size) == 0);
+}
+
+PacketPayload::PoolStats PacketPayload::pool_stats() noexcept
+{
+    Pool &pool = Pool::instance();
+    std::size_t free = 0;
+    for (Pool::SizeClass &entry : pool.classes) {
+        const std::scoped_lock lock{entry.mutex};
+        free += entry.free.size();
+    }
+    return {pool.allocated.load(std::memory_order_relaxed), pool.recycled.load(std::memory_order_relaxed), free};
+}
+
+void PacketPayload::make_unique(std::size_t capacity)
+{
+    capacity = std::max<std::size_t>(capacity, _size);
+    if ((!_block && capacity <= INLINE_CAPACITY) || owns_block(capacity)) {
+        return;
+    }
+
+    Block *block = Pool::instance().acquire(capacity);
+    if (_size > 0) {
+        std::memcpy(block->bytes(), storage(), _size);
+    }
+    release();
+    _block = block;
+}
+
+void PacketPayload::release() noexcept
+{
+    if (_block && _block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        Pool::instance().recycle(_block);
+    }
+    _block = nullptr;
+}
+
+/**
+ * @brief Whether this payload is the only owner of a block of at least `capacity` bytes.
+ * @details The acquire pairs with the releases of the copies that were dropped, so their last reads
+ * happen before we write.
+ */
+bool PacketPayload::owns_block(std::size_t capacity) const noexcept
+{
+    return _block && _block->capacity >= capacity && _block->refs.load(std::memory_order_acquire) == 1;
+}
+
+std::uint8_t *PacketPayload::storage() noexcept
+{
+    return _block ? _block->bytes() : _inline.data();
+}
@@ -0,0 +1,235 @@
+#include <core/particle_pool.hpp>
+
+#include <core/cpu_features.hpp>
+#include <core/job_pool.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace {
+
+struct ParticleSpan {
+        float *px, *py, *pz;
+        float *vx, *vy, *vz;
+        float *life;
+};
+
+using StepFn = void (*)(const ParticleSpan &, std::size_t, std::size_t, float, float) noexcept;
+
+}// namespace
+
+/* ================================================================================= */
+/* Kernels */
+/* ================================================================================= */
+
+/* v *= keep; p += v * dt; life -= dt over [begin, end) */
+static void step_scalar(const ParticleSpan &p, std::size_t begin, std::size_t end, float dt, float keep) noexcept
+{
+    for (std::size_t i = begin; i < end; ++i) {
+        p.vx[i] *= keep;
+        p.vy[i] *= keep;
+        p.vz[i] *= keep;
+        p.px[i] += p.vx[i] * dt;
+        p.py[i] += p.vy[i] * dt;
+        p.pz[i] += p.vz[i] * dt;
+        p.life[i] -= dt;
+    }
+}
+
+#if defined(R_TYPE_SIMD_X86)
+
+R_TYPE_TARGET("sse2")
+static void step_sse2(const ParticleSpan &p, std::size_t begin, std::size_t end, float dt, float keep) noexcept
+{
+    const __m128 step = _mm_set1_ps(dt);
+    const __m128 damp = _mm_set1_ps(keep);
+    std::size_t i = begin;
+
+    for (; i + 4 <= end; i += 4) {
+        const __m128 vx = _mm_mul_ps(_mm_loadu_ps(p.vx + i), damp);
+        const __m128 vy = _mm_mul_ps(_mm_loadu_ps(p.vy + i), damp);
+        const __m128 vz = _mm_mul_ps(_mm_loadu_ps(p.vz + i), damp);
+        _mm_storeu_ps(p.vx + i, vx);
+        _mm_storeu_ps(p.vy + i, vy);
+        _mm_storeu_ps(p.vz + i, vz);
+        _mm_storeu_ps(p.px + i, _mm_add_ps(_mm_loadu_ps(p.px + i), _mm_mul_ps(vx, step)));
+        _mm_storeu_ps(p.py + i, _mm_add_ps(_mm_loadu_ps(p.py + i), _mm_mul_ps(vy, step)));
+        _mm_storeu_ps(p.pz + i, _mm_add_ps(_mm_loadu_ps(p.pz + i), _mm_mul_ps(vz, step)));
+        _mm_storeu_ps(p.life + i, _mm_sub_ps(_mm_loadu_ps(p.life + i), step));
+    }
+    step_scalar(p, i, end, dt, keep);
+}
+
+R_TYPE_TARGET("avx2,fma")
+static void step_avx2(const ParticleSpan &p, std::size_t begin, std::size_t end, float dt, float keep) noexcept
+{
+    const __m256 step = _mm256_set1_ps(dt);
+    const __m256 damp = _mm256_set1_ps(keep);
+    std::size_t i = begin;
+
+    for (; i + 8 <= end; i += 8) {
+        const __m256 vx = _mm256_mul_ps(_mm256_loadu_ps(p.vx + i), damp);
+        const __m256 vy = _mm256_mul_ps(_mm256_loadu_ps(p.vy + i), damp);
+        const __m256 vz = _mm256_mul_ps(_mm256_loadu_ps(p.vz + i), damp);
+        _mm256_storeu_ps(p.vx + i, vx);
+        _mm256_storeu_ps(p.vy + i, vy);
+        _mm256_storeu_ps(p.vz + i, vz);
+        _mm256_storeu_ps(p.px + i, _mm256_fmadd_ps(vx, step, _mm256_loadu_ps(p.px + i)));
+        _mm256_storeu_ps(p.py + i, _mm256_fmadd_ps(vy, step, _mm256_loadu_ps(p.py + i)));
+        _mm256_storeu_ps(p.pz + i, _mm256_fmadd_ps(vz, step, _mm256_loadu_ps(p.pz + i)));
+        _mm256_storeu_ps(p.life + i, _mm256_sub_ps(_mm256_loadu_ps(p.life + i), step));
+    }
+    step_scalar(p, i, end, dt, keep);
+}
+
+static StepFn select_step()
+{
+    const CpuFeatures &cpu = cpu_features();
+    if (cpu.avx2 && cpu.fma) {
+        return step_avx2;
+    }
+    if (cpu.sse2) {
+        return step_sse2;
+    }
+    return step_scalar;
+}
+
+#else
+
+static StepFn select_step()
+{
+    return step_scalar;
+}
+
+#endif
+
+static StepFn step_kernel()
+{
+    static const StepFn selected = select_step();
+    return selected;
+}
+
+/* ================================================================================= */
+/* Pool */
+/* ================================================================================= */
+
+ParticlePool::ParticlePool(std::size_t capacity, std::uint8_t kind_count)
+    : _px(capacity), _py(capacity), _pz(capacity), _vx(capacity), _vy(capacity), _vz(capacity), _life(capacity),
+      _inv_max_life(capacity), _size(capacity), _rgba(capacity), _kind(capacity), _kind_count(kind_count)
+{
+}
+
+bool ParticlePool::emit(const r::Vec3f &position, const r::Vec3f &velocity, float life, float size, std::uint32_t rgba,
+    std::uint8_t kind) noexcept
+{
+    if (_count == _px.size() || life <= 0.0f || kind >= _kind_count) {
+        return false;
+    }
+    const std::size_t i = _count++;
+    _px[i] = position.x;
+    _py[i] = position.y;
+    _pz[i] = position.z;
+    _vx[i] = velocity.x;
+    _vy[i] = velocity.y;
+    _vz[i] = velocity.z;
+    _life[i] = life;
+    _inv_max_life[i] = 1.0f / life;
+    _size[i] = size;
+    _rgba[i] = rgba;
+    _kind[i] = kind;
+    return true;
+}
+
+std::size_t ParticlePool::emit(const Burst &burst) noexcept
+{
+    const std::size_t count = std::min(burst.count, _px.size() - _count);
+    for (std::size_t n = 0; n < count; ++n) {
+        /* Uniform direction on the sphere: uniform z and azimuth */
+        const float z = random_unit() * 2.0f - 1.0f;
+        const float azimuth = random_unit() * 2.0f * std::numbers::pi_v<float>;
+        const float ring = std::sqrt(std::max(0.0f, 1.0f - z * z));
+        const float speed = burst.min_speed + (burst.max_speed - burst.min_speed) * random_unit();
+        const float life = burst.life * (0.5f + 0.5f * random_unit());
+        const r::Vec3f velocity{ring * std::cos(azimuth) * speed, ring * std::sin(azimuth) * speed, z * speed};
+        emit(burst.position, velocity, life, burst.size, burst.rgba, burst.kind);
+    }
+    return count;
+}
+
+void ParticlePool::update(float dt, float damping, const JobPool *jobs)
+{
+    const ParticleSpan span{_px.data(), _py.data(), _pz.data(), _vx.data(), _vy.data(), _vz.data(), _life.data()};
+    const float keep = std::pow(damping, dt);
+    const StepFn step = step_kernel();
+
+    if (jobs && _count >= PARALLEL_FOR_THRESHOLD) {
+        jobs->parallel_for(_count, [&](std::size_t begin, std::size_t end) { step(span, begin, end, dt, keep); });
+    } else {
+        step(span, 0, _count, dt, keep);
+    }
+
+    /* Swap-remove the dead: walking backwards, the particle moved in is always already updated and alive */
+    for (std::size_t i = _count; i-- > 0;) {
+        if (_life[i] > 0.0f) {
+            continue;
+        }
+        const std::size_t last = --_count;
+        _px[i] = _px[last];
+        _py[i] = _py[last];
+        _pz[i] = _pz[last];
+        _vx[i] = _vx[last];
+        _vy[i] = _vy[last];
+        _vz[i] = _vz[last];
+        _life[i] = _life[last];
+        _inv_max_life[i] = _inv_max_life[last];
+        _size[i] = _size[last];
+        _rgba[i] = _rgba[last];
+        _kind[i] = _kind[last];
+    }
+}
+
+void ParticlePool::build_instances(InstanceLists &lists) const
+{
+    lists.resize(_kind_count);
+    for (std::vector<Instance> &list : lists) {
+        list.clear();
+    }
+    constexpr float TO_UNIT = 1.0f / 255.0f;
+    for (std::size_t i = 0; i < _count; ++i) {
+        const float fade = std::clamp(_life[i] * _inv_max_life[i], 0.0f, 1.0f);
+        const std::uint32_t rgba = _rgba[i];
+        const float size = _size[i];
+        lists[_kind[i]].push_back({{
+            {size, 0.0f, 0.0f, _px[i]},
+            {0.0f, size, 0.0f, _py[i]},
+            {0.0f, 0.0f, size, _pz[i]},
+            {static_cast<float>(rgba >> 24) * TO_UNIT, static_cast<float>((rgba >> 16) & 0xFFu) * TO_UNIT,
+                static_cast<float>((rgba >> 8) & 0xFFu) * TO_UNIT, static_cast<float>(rgba & 0xFFu) * TO_UNIT * fade},
+        }});
+    }
+}
+
+void ParticlePool::clear() noexcept
+{
+    _count = 0;
+}
+
+std::size_t ParticlePool::size() const noexcept
+{
+    return _count;
+}
+
+std::size_t ParticlePool::capacity() const noexcept
+{
+    return _px.size();
+}
+
+/* xorshift32: bursts only need cheap, decorrelated directions */
+float ParticlePool::random_unit() noexcept
+{
+    _rng ^= _rng << 13;
+    _rng ^= _rng >> 17;
+    _rng ^= _rng << 5;
+    return static_cast<float>(_rng >> 8) * (1.0f / 16777216.0f);
+}
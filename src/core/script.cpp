@@ -0,0 +1,408 @@
+#include <core/script.hpp>
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/* ================================================================================= */
+/* Frame pool */
+/* ================================================================================= */
+
+namespace {
+
+constexpr std::size_t FRAME_CLASS_SIZE = 64;
+constexpr std::size_t FRAME_CLASS_COUNT = 16; /* Frames up to 1 KiB are pooled */
+constexpr std::size_t FRAMES_PER_SLAB = 32;
+
+struct FreeFrame {
+        FreeFrame *next;
+};
+
+struct FramePool {
+        std::mutex mutex;
+        std::array<FreeFrame *, FRAME_CLASS_COUNT> free_lists{};
+        std::vector<std::unique_ptr<std::byte[]>> slabs;
+        std::size_t live = 0;
+
+        static std::size_t class_of(std::size_t size) noexcept
+        {
+            return (size + FRAME_CLASS_SIZE - 1) / FRAME_CLASS_SIZE - 1;
+        }
+
+        void refill(std::size_t size_class)
+        {
+            const std::size_t block = (size_class + 1) * FRAME_CLASS_SIZE;
+            auto slab = std::make_unique<std::byte[]>(block * FRAMES_PER_SLAB);
+            for (std::size_t i = 0; i < FRAMES_PER_SLAB; ++i) {
+                auto *frame = ::new (static_cast<void *>(slab.get() + i * block)) FreeFrame{free_lists[size_class]};
+                free_lists[size_class] = frame;
+            }
+            slabs.push_back(std::move(slab));
+        }
+};
+
+FramePool &frame_pool()
+{
+    static FramePool pool;
+    return pool;
+}
+
+}// namespace
+
+void *ScriptFramePool::allocate(std::size_t size)
+{
+    FramePool &pool = frame_pool();
+    const std::size_t size_class = FramePool::class_of(size);
+    std::lock_guard lock(pool.mutex);
+
+    ++pool.live;
+    if (size_class >= FRAME_CLASS_COUNT) {
+        return ::operator new(size);
+    }
+    if (!pool.free_lists[size_class]) {
+        pool.refill(size_class);
+    }
+    FreeFrame *frame = pool.free_lists[size_class];
+    pool.free_lists[size_class] = frame->next;
+    return frame;
+}
+
+void ScriptFramePool::deallocate(void *ptr, std::size_t size) noexcept
+{
+    FramePool &pool = frame_pool();
+    const std::size_t size_class = FramePool::class_of(size);
+    std::lock_guard lock(pool.mutex);
+
+    --pool.live;
+    if (size_class >= FRAME_CLASS_COUNT) {
+        ::operator delete(ptr, size);
+        return;
+    }
+    pool.free_lists[size_class] = ::new (ptr) FreeFrame{pool.free_lists[size_class]};
+}
+
+std::size_t ScriptFramePool::live_frames() noexcept
+{
+    FramePool &pool = frame_pool();
+    std::lock_guard lock(pool.mutex);
+    return pool.live;
+}
+
+/* ================================================================================= */
+/* Script */
+/* ================================================================================= */
+
+Script Script::promise_type::get_return_object() noexcept
+{
+    return Script{std::coroutine_handle<promise_type>::from_promise(*this)};
+}
+
+std::suspend_always Script::promise_type::initial_suspend() const noexcept
+{
+    return {};
+}
+
+std::suspend_always Script::promise_type::final_suspend() const noexcept
+{
+    return {};
+}
+
+void Script::promise_type::return_void() const noexcept
+{
+}
+
+void Script::promise_type::unhandled_exception() const
+{
+    throw;
+}
+
+void *Script::promise_type::operator new(std::size_t size)
+{
+    return ScriptFramePool::allocate(size);
+}
+
+void Script::promise_type::operator delete(void *ptr, std::size_t size) noexcept
+{
+    ScriptFramePool::deallocate(ptr, size);
+}
+
+Script::Script(std::coroutine_handle<promise_type> handle) noexcept : _handle(handle)
+{
+}
+
+Script::Script(Script &&other) noexcept : _handle(std::exchange(other._handle, {}))
+{
+}
+
+Script &Script::operator=(Script &&other) noexcept
+{
+    if (this != &other) {
+        if (_handle) {
+            _handle.destroy();
+        }
+        _handle = std::exchange(other._handle, {});
+    }
+    return *this;
+}
+
+Script::~Script()
+{
+    if (_handle) {
+        _handle.destroy();
+    }
+}
+
+/* ================================================================================= */
+/* Scheduler */
+/* ================================================================================= */
+
+struct ScriptScheduler::State {
+        using Handle = std::coroutine_handle<Script::promise_type>;
+
+        struct Slot {
+                Handle handle;
+                std::uint32_t generation = 0;
+                std::uint64_t owner = NO_OWNER;
+        };
+
+        struct Timer {
+                double wake;
+                std::uint64_t order; /* Keeps scripts due on the same tick in scheduling order */
+                ScriptId id;
+        };
+
+        /* std heap functions build a max-heap: invert to keep the earliest wake on top */
+        static bool later(const Timer &a, const Timer &b) noexcept
+        {
+            return a.wake > b.wake || (a.wake == b.wake && a.order > b.order);
+        }
+
+        std::vector<Slot> slots;
+        std::vector<std::uint32_t> free_slots;
+        std::size_t running = 0;
+
+        std::vector<Timer> timers;
+        std::vector<std::vector<ScriptId>> waiters; /* Indexed by signal */
+        std::vector<ScriptId> ready;
+        std::vector<ScriptId> resuming;
+        std::unordered_map<std::uint64_t, std::vector<ScriptId>> by_owner;
+
+        double clock = 0.0;
+        double current = 0.0;
+        std::uint64_t next_order = 0;
+
+        ~State()
+        {
+            for (Slot &slot : slots) {
+                if (slot.handle) {
+                    slot.handle.destroy();
+                }
+            }
+        }
+
+        bool alive(ScriptId id) const noexcept
+        {
+            return id.slot < slots.size() && slots[id.slot].handle && slots[id.slot].generation == id.generation;
+        }
+
+        void schedule(ScriptId id, double wake)
+        {
+            timers.push_back({wake, next_order++, id});
+            std::push_heap(timers.begin(), timers.end(), later);
+        }
+
+        void destroy(ScriptId id)
+        {
+            Slot &slot = slots[id.slot];
+            if (slot.owner != NO_OWNER) {
+                auto owned = by_owner.find(slot.owner);
+                if (owned != by_owner.end()) {
+                    std::erase_if(owned->second, [&](const ScriptId &other) { return other.slot == id.slot; });
+                    if (owned->second.empty()) {
+                        by_owner.erase(owned);
+                    }
+                }
+            }
+            slot.handle.destroy();
+            slot.handle = {};
+            slot.owner = NO_OWNER;
+            ++slot.generation; /* Invalidates the timer and waiter entries left behind */
+            free_slots.push_back(id.slot);
+            --running;
+        }
+
+        void resume(ScriptId id, double at)
+        {
+            if (!alive(id)) {
+                return;
+            }
+            current = at;
+            Handle handle = slots[id.slot].handle;
+            handle.resume();
+            if (handle.done()) {
+                destroy(id);
+            }
+        }
+};
+
+ScriptScheduler::ScriptScheduler() : _state(std::make_shared<State>())
+{
+}
+
+ScriptId ScriptScheduler::start(Script script, std::uint64_t owner)
+{
+    State &state = *_state;
+    std::uint32_t index = 0;
+    if (!state.free_slots.empty()) {
+        index = state.free_slots.back();
+        state.free_slots.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(state.slots.size());
+        state.slots.emplace_back();
+    }
+
+    State::Slot &slot = state.slots[index];
+    slot.handle = std::exchange(script._handle, {});
+    slot.owner = owner;
+    const ScriptId id{index, slot.generation};
+    slot.handle.promise().scheduler = _state.get();
+    slot.handle.promise().id = id;
+
+    if (owner != NO_OWNER) {
+        state.by_owner[owner].push_back(id);
+    }
+    state.ready.push_back(id);
+    ++state.running;
+    return id;
+}
+
+void ScriptScheduler::advance(float dt)
+{
+    State &state = *_state;
+    state.clock += static_cast<double>(dt);
+
+    /* Scripts woken by a signal or just started run first, at the current time */
+    state.resuming.clear();
+    std::swap(state.resuming, state.ready);
+    for (const ScriptId id : state.resuming) {
+        state.resume(id, state.clock);
+    }
+
+    while (!state.timers.empty() && state.timers.front().wake <= state.clock) {
+        std::pop_heap(state.timers.begin(), state.timers.end(), State::later);
+        const State::Timer timer = state.timers.back();
+        state.timers.pop_back();
+        state.resume(timer.id, timer.wake);
+    }
+    state.current = state.clock;
+}
+
+void ScriptScheduler::raise(ScriptSignal signal)
+{
+    State &state = *_state;
+    if (signal >= state.waiters.size()) {
+        return;
+    }
+    std::vector<ScriptId> &waiting = state.waiters[signal];
+    state.ready.insert(state.ready.end(), waiting.begin(), waiting.end());
+    waiting.clear();
+}
+
+void ScriptScheduler::cancel(ScriptId id)
+{
+    if (_state->alive(id)) {
+        _state->destroy(id);
+    }
+}
+
+void ScriptScheduler::cancel_owner(std::uint64_t owner)
+{
+    State &state = *_state;
+    auto owned = state.by_owner.find(owner);
+    if (owned == state.by_owner.end()) {
+        return;
+    }
+    /* destroy() edits the owner's list, work on a copy */
+    const std::vector<ScriptId> ids = std::move(owned->second);
+    state.by_owner.erase(owned);
+    for (const ScriptId id : ids) {
+        if (state.alive(id)) {
+            state.slots[id.slot].owner = NO_OWNER;
+            state.destroy(id);
+        }
+    }
+}
+
+void ScriptScheduler::clear()
+{
+    State &state = *_state;
+    for (std::uint32_t index = 0; index < state.slots.size(); ++index) {
+        if (state.slots[index].handle) {
+            state.slots[index].owner = NO_OWNER;
+            state.destroy({index, state.slots[index].generation});
+        }
+    }
+    state.by_owner.clear();
+    state.timers.clear();
+    state.waiters.clear();
+    state.ready.clear();
+    state.clock = 0.0;
+    state.current = 0.0;
+}
+
+bool ScriptScheduler::is_running(ScriptId id) const noexcept
+{
+    return _state->alive(id);
+}
+
+std::size_t ScriptScheduler::size() const noexcept
+{
+    return _state->running;
+}
+
+double ScriptScheduler::now() const noexcept
+{
+    return _state->current;
+}
+
+/* ================================================================================= */
+/* Awaitables */
+/* ================================================================================= */
+
+bool WaitSeconds::await_ready() const noexcept
+{
+    return seconds <= 0.0f;
+}
+
+void WaitSeconds::await_suspend(std::coroutine_handle<Script::promise_type> handle) const
+{
+    ScriptScheduler::State &state = *handle.promise().scheduler;
+    state.schedule(handle.promise().id, state.current + static_cast<double>(seconds));
+}
+
+void WaitSeconds::await_resume() const noexcept
+{
+}
+
+bool WaitSignal::await_ready() const noexcept
+{
+    return false;
+}
+
+void WaitSignal::await_suspend(std::coroutine_handle<Script::promise_type> handle) const
+{
+    ScriptScheduler::State &state = *handle.promise().scheduler;
+    if (signal >= state.waiters.size()) {
+        state.waiters.resize(signal + 1);
+    }
+    state.waiters[signal].push_back(handle.promise().id);
+}
+
+void WaitSignal::await_resume() const noexcept
+{
+}
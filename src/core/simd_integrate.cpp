@@ -0,0 +1,128 @@
+#include <core/simd_integrate.hpp>
+
+#include <core/cpu_features.hpp>
+
+using IntegrateFn = void (*)(float *, const float *, std::size_t, float) noexcept;
+
+/* ================================================================================= */
+/* Kernels */
+/* ================================================================================= */
+
+static void integrate_scalar(float *positions, const float *velocities, std::size_t count, float dt) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        positions[i] += velocities[i] * dt;
+    }
+}
+
+#if defined(R_TYPE_SIMD_X86)
+
+R_TYPE_TARGET("sse2")
+static void integrate_sse2(float *positions, const float *velocities, std::size_t count, float dt) noexcept
+{
+    const __m128 step = _mm_set1_ps(dt);
+    std::size_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        const __m128 p = _mm_loadu_ps(positions + i);
+        const __m128 v = _mm_loadu_ps(velocities + i);
+        _mm_storeu_ps(positions + i, _mm_add_ps(p, _mm_mul_ps(v, step)));
+    }
+    integrate_scalar(positions + i, velocities + i, count - i, dt);
+}
+
+R_TYPE_TARGET("avx2,fma")
+static void integrate_avx2(float *positions, const float *velocities, std::size_t count, float dt) noexcept
+{
+    const __m256 step = _mm256_set1_ps(dt);
+    std::size_t i = 0;
+
+    /* Two independent FMAs per iteration to hide their latency */
+    for (; i + 16 <= count; i += 16) {
+        const __m256 p0 = _mm256_loadu_ps(positions + i);
+        const __m256 p1 = _mm256_loadu_ps(positions + i + 8);
+        const __m256 v0 = _mm256_loadu_ps(velocities + i);
+        const __m256 v1 = _mm256_loadu_ps(velocities + i + 8);
+        _mm256_storeu_ps(positions + i, _mm256_fmadd_ps(v0, step, p0));
+        _mm256_storeu_ps(positions + i + 8, _mm256_fmadd_ps(v1, step, p1));
+    }
+    for (; i + 8 <= count; i += 8) {
+        const __m256 p = _mm256_loadu_ps(positions + i);
+        const __m256 v = _mm256_loadu_ps(velocities + i);
+        _mm256_storeu_ps(positions + i, _mm256_fmadd_ps(v, step, p));
+    }
+    integrate_scalar(positions + i, velocities + i, count - i, dt);
+}
+
+R_TYPE_TARGET("avx512f")
+static void integrate_avx512(float *positions, const float *velocities, std::size_t count, float dt) noexcept
+{
+    const __m512 step = _mm512_set1_ps(dt);
+    std::size_t i = 0;
+
+    for (; i + 16 <= count; i += 16) {
+        const __m512 p = _mm512_loadu_ps(positions + i);
+        const __m512 v = _mm512_loadu_ps(velocities + i);
+        _mm512_storeu_ps(positions + i, _mm512_fmadd_ps(v, step, p));
+    }
+    /* Masked tail instead of a scalar loop */
+    if (i < count) {
+        const auto mask = static_cast<__mmask16>((1u << (count - i)) - 1u);
+        const __m512 p = _mm512_maskz_loadu_ps(mask, positions + i);
+        const __m512 v = _mm512_maskz_loadu_ps(mask, velocities + i);
+        _mm512_mask_storeu_ps(positions + i, mask, _mm512_fmadd_ps(v, step, p));
+    }
+}
+
+#endif
+
+/* ================================================================================= */
+/* Dispatch */
+/* ================================================================================= */
+
+struct IntegrateKernel {
+        IntegrateFn fn;
+        const char *isa;
+};
+
+#if defined(R_TYPE_SIMD_X86)
+
+static IntegrateKernel select_kernel()
+{
+    const CpuFeatures &cpu = cpu_features();
+    if (cpu.avx512f) {
+        return {integrate_avx512, "avx512f"};
+    }
+    if (cpu.avx2 && cpu.fma) {
+        return {integrate_avx2, "avx2"};
+    }
+    if (cpu.sse2) {
+        return {integrate_sse2, "sse2"};
+    }
+    return {integrate_scalar, "scalar"};
+}
+
+#else
+
+static IntegrateKernel select_kernel()
+{
+    return {integrate_scalar, "scalar"};
+}
+
+#endif
+
+static const IntegrateKernel &kernel()
+{
+    static const IntegrateKernel selected = select_kernel();
+    return selected;
+}
+
+void integrate_positions(float *positions, const float *velocities, std::size_t count, float dt) noexcept
+{
+    kernel().fn(positions, velocities, count, dt);
+}
+
+const char *integrate_positions_isa() noexcept
+{
+    return kernel().isa;
+}
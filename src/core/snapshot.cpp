@@ -0,0 +1,294 @@
+#include <core/snapshot.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+
+static constexpr std::size_t HEADER_SIZE = 16;
+static constexpr std::size_t COUNTS_OFFSET = 12; /* After the two sequences and the time */
+static constexpr unsigned ID_GAP_BITS = 4;
+
+/* ================================================================================= */
+/* History */
+/* ================================================================================= */
+
+SnapshotHistory::SnapshotHistory(std::size_t capacity) : _ring(capacity)
+{
+}
+
+void SnapshotHistory::push(std::shared_ptr<const WorldSnapshot> snapshot)
+{
+    if (snapshot && snapshot->sequence != 0) {
+        _ring[snapshot->sequence % _ring.size()] = std::move(snapshot);
+    }
+}
+
+std::shared_ptr<const WorldSnapshot> SnapshotHistory::find(std::uint32_t sequence) const noexcept
+{
+    if (sequence == 0) {
+        return nullptr;
+    }
+    const std::shared_ptr<const WorldSnapshot> &slot = _ring[sequence % _ring.size()];
+    return slot && slot->sequence == sequence ? slot : nullptr;
+}
+
+/* ================================================================================= */
+/* Extrapolation */
+/* ================================================================================= */
+
+/**
+ * @brief `range` as integers, which the wire arithmetic below needs to be exact.
+ */
+struct WholeRange {
+        std::int64_t min;
+        std::int64_t width;
+        std::int64_t steps;
+};
+
+static constexpr WholeRange whole(const QuantizedRange &range) noexcept
+{
+    return {static_cast<std::int64_t>(range.min), static_cast<std::int64_t>(range.max - range.min), range.steps()};
+}
+
+static constexpr bool is_whole(const QuantizedRange &range) noexcept
+{
+    return range.min == static_cast<float>(whole(range).min) && range.max == static_cast<float>(whole(range).min + whole(range).width);
+}
+
+static_assert(is_whole(snapshot_quantization::X) && is_whole(snapshot_quantization::Y) && is_whole(snapshot_quantization::VELOCITY));
+
+static constexpr WholeRange SPEED = whole(snapshot_quantization::VELOCITY);
+
+static_assert(SPEED.width * SPEED.steps * std::int64_t{SNAPSHOT_EXTRAPOLATION_LIMIT} * whole(snapshot_quantization::X).steps
+        < INT64_MAX / 2,
+    "Extrapolating the widest axis at full speed must not overflow");
+
+/**
+ * @brief Wire position `position` moved for `elapsed` microseconds at wire velocity `velocity`, in integers only.
+ * @details The velocity is `min + velocity * width / steps`, so the distance in position steps is
+ * `(min * steps + velocity * width) * elapsed * position steps / (steps * 1e6 * position width)`,
+ * rounded to the nearest. A velocity within half a step of zero does not move: the odd number of
+ * steps puts none of them on zero.
+ */
+static std::uint32_t extrapolate_axis(
+    std::uint32_t position, std::uint32_t velocity, std::uint32_t elapsed, const QuantizedRange &axis) noexcept
+{
+    const WholeRange range = whole(axis);
+    const std::int64_t scaled = SPEED.min * SPEED.steps + static_cast<std::int64_t>(velocity) * SPEED.width;
+    if (2 * std::llabs(scaled) <= SPEED.width) {
+        return position;
+    }
+    const std::int64_t numerator = scaled * elapsed * range.steps;
+    const std::int64_t denominator = SPEED.steps * 1'000'000 * range.width;
+    const std::int64_t distance = (numerator >= 0 ? numerator + denominator / 2 : numerator - denominator / 2) / denominator;
+    const std::int64_t moved = static_cast<std::int64_t>(position) + distance;
+    return static_cast<std::uint32_t>(moved < 0 ? 0 : (moved > range.steps ? range.steps : moved));
+}
+
+/**
+ * @brief `state` moved along its velocity for `elapsed` microseconds, computed on the wire values so the client gets the same.
+ */
+static EntityState extrapolate(const EntityState &state, std::uint32_t elapsed) noexcept
+{
+    using namespace snapshot_quantization;
+    EntityState moved = state;
+    if (elapsed == 0 || elapsed > SNAPSHOT_EXTRAPOLATION_LIMIT) {
+        return moved;
+    }
+    r::Vec3f &position = moved.transform.position;
+    const std::uint32_t x = X.quantize(position.x);
+    const std::uint32_t y = Y.quantize(position.y);
+    const std::uint32_t moved_x = extrapolate_axis(x, VELOCITY.quantize(state.velocity.value.x), elapsed, X);
+    const std::uint32_t moved_y = extrapolate_axis(y, VELOCITY.quantize(state.velocity.value.y), elapsed, Y);
+    if (moved_x != x) {
+        position.x = X.dequantize(moved_x);
+    }
+    if (moved_y != y) {
+        position.y = Y.dequantize(moved_y);
+    }
+    return moved;
+}
+
+/* ================================================================================= */
+/* Codec */
+/* ================================================================================= */
+
+/**
+ * @brief Writes `id` as its distance from `previous`, the id written before it in the same list, and updates `previous`.
+ */
+static void write_id(BitWriter &writer, std::uint16_t &previous, NetId id)
+{
+    const std::uint32_t gap = static_cast<std::uint32_t>(id.value - previous);
+    if (gap >= 1 && gap <= (1u << ID_GAP_BITS)) {
+        writer.write(1, 1);
+        writer.write(gap - 1, ID_GAP_BITS);
+    } else {
+        writer.write(0, 1);
+        writer.write(id.value, NET_ID_BITS);
+    }
+    previous = id.value;
+}
+
+/**
+ * @brief Reads what write_id() wrote. Lists go by ascending id, so an id not above `previous` is malformed.
+ */
+static bool read_id(BitReader &reader, std::uint16_t &previous, NetId &id) noexcept
+{
+    std::uint32_t value = 0;
+    if (reader.read(1) != 0) {
+        value = previous + reader.read(ID_GAP_BITS) + 1;
+    } else {
+        value = reader.read(NET_ID_BITS);
+    }
+    if (reader.failed() || value <= previous || value > UINT16_MAX) {
+        return false;
+    }
+    id.value = static_cast<std::uint16_t>(value);
+    previous = id.value;
+    return true;
+}
+
+static void write_entity(BitWriter &writer, std::uint16_t &previous, const EntityState &from, const EntityState &to, net::Mask mask)
+{
+    write_id(writer, previous, to.id);
+    net::encode_delta(from, to, writer, mask);
+}
+
+static void patch_u16(std::vector<std::uint8_t> &out, std::size_t offset, std::uint16_t value) noexcept
+{
+    out[offset] = static_cast<std::uint8_t>(value >> 8);
+    out[offset + 1] = static_cast<std::uint8_t>(value);
+}
+
+void encode_snapshot(const WorldSnapshot *baseline, const WorldSnapshot &current, std::vector<std::uint8_t> &out)
+{
+    static const std::vector<EntityState> nothing;
+    const std::vector<EntityState> &before = baseline ? baseline->entities : nothing;
+    const std::vector<EntityState> &after = current.entities;
+
+    BitWriter writer{out};
+    const std::size_t start = out.size();
+    writer.write(current.sequence, 32);
+    writer.write(baseline ? baseline->sequence : 0, 32);
+    writer.write(current.time, 32);
+    writer.write(0, 16); /* Counts, patched at the end */
+    writer.write(0, 16);
+
+    /* Both lists are sorted by id: one merge pass finds the new, changed and removed entities */
+    const std::uint32_t elapsed = baseline ? current.time - baseline->time : 0;
+    std::uint16_t changed = 0;
+    std::uint16_t previous_id = 0;
+    std::vector<NetId> removed;
+    std::size_t b = 0;
+    for (const EntityState &entity : after) {
+        while (b < before.size() && before[b].id < entity.id) {
+            removed.push_back(before[b++].id);
+        }
+        if (b < before.size() && before[b].id == entity.id) {
+            /* Compared on the wire, to where its velocity took it: moving less than a quantization step from there is not a change */
+            const EntityState previous = extrapolate(before[b++], elapsed);
+            const net::Mask mask = net::diff(previous, entity);
+            if (mask != 0) {
+                write_entity(writer, previous_id, previous, entity, mask);
+                ++changed;
+            }
+        } else {
+            /* New: sent against a default state, so only what differs from the defaults is written */
+            static const EntityState fresh{};
+            write_entity(writer, previous_id, fresh, entity, net::diff(fresh, entity));
+            ++changed;
+        }
+    }
+    for (; b < before.size(); ++b) {
+        removed.push_back(before[b].id);
+    }
+    previous_id = 0;
+    for (const NetId id : removed) {
+        write_id(writer, previous_id, id);
+    }
+    writer.flush();
+    patch_u16(out, start + COUNTS_OFFSET, changed);
+    patch_u16(out, start + COUNTS_OFFSET + 2, static_cast<std::uint16_t>(removed.size()));
+}
+
+std::uint32_t snapshot_baseline(std::span<const std::uint8_t> payload) noexcept
+{
+    if (payload.size() < HEADER_SIZE) {
+        return 0;
+    }
+    BitReader reader{payload};
+    reader.read(32);
+    return reader.read(32);
+}
+
+bool decode_snapshot(const WorldSnapshot *baseline, std::span<const std::uint8_t> payload, WorldSnapshot &out)
+{
+    BitReader reader{payload};
+    const std::uint32_t sequence = reader.read(32);
+    const std::uint32_t baseline_sequence = reader.read(32);
+    const std::uint32_t time = reader.read(32);
+    const std::uint32_t changed = reader.read(16);
+    std::vector<NetId> removed(reader.read(16));
+    if (reader.failed() || baseline_sequence != (baseline ? baseline->sequence : 0)) {
+        return false;
+    }
+
+    /* Each record is a delta from the extrapolated baseline state of its entity, or from a default one if it is new */
+    static const std::vector<EntityState> nothing;
+    const std::vector<EntityState> &before = baseline ? baseline->entities : nothing;
+    const std::uint32_t elapsed = baseline ? time - baseline->time : 0;
+    std::vector<EntityState> updated;
+    updated.reserve(changed);
+    std::size_t b = 0;
+    std::uint16_t previous_id = 0;
+    for (std::uint32_t i = 0; i < changed; ++i) {
+        NetId id;
+        if (!read_id(reader, previous_id, id)) {
+            return false;
+        }
+        while (b < before.size() && before[b].id < id) {
+            ++b;
+        }
+        EntityState entity = b < before.size() && before[b].id == id ? extrapolate(before[b], elapsed) : EntityState{};
+        entity.id = id;
+        net::decode_delta(entity, reader);
+        updated.push_back(entity);
+    }
+    previous_id = 0;
+    for (NetId &id : removed) {
+        if (!read_id(reader, previous_id, id)) {
+            return false;
+        }
+    }
+    if (reader.failed() || reader.remaining_bits() >= 8) {
+        return false;
+    }
+
+    /* Three sorted lists: baseline entities, changes and removals, merged in one pass */
+    out.sequence = sequence;
+    out.time = time;
+    out.entities.clear();
+    out.entities.reserve(before.size() + updated.size());
+    std::size_t r = 0;
+    const auto keep = [&](const EntityState &entity) {
+        while (r < removed.size() && removed[r] < entity.id) {
+            ++r;
+        }
+        if (r == removed.size() || removed[r] != entity.id) {
+            out.entities.push_back(extrapolate(entity, elapsed));
+        }
+    };
+    b = 0;
+    for (const EntityState &entity : updated) {
+        for (; b < before.size() && before[b].id < entity.id; ++b) {
+            keep(before[b]);
+        }
+        if (b < before.size() && before[b].id == entity.id) {
+            ++b;
+        }
+        out.entities.push_back(entity);
+    }
+    for (; b < before.size(); ++b) {
+        keep(before[b]);
+    }
+    return true;
+}
@@ -0,0 +1,173 @@
+#include <core/spline_path.hpp>
+
+#include <core/cpu_features.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+/* Dense steps per control segment used to measure arc length before resampling */
+static constexpr std::size_t ARC_STEPS_PER_SEGMENT = 64;
+
+/* ================================================================================= */
+/* Baking */
+/* ================================================================================= */
+
+static r::Vec3f catmull_rom(const r::Vec3f &p0, const r::Vec3f &p1, const r::Vec3f &p2, const r::Vec3f &p3, float t) noexcept
+{
+    const float t2 = t * t;
+    const float t3 = t2 * t;
+    return (p1 * 2.0f + (p2 - p0) * t + (p0 * 2.0f - p1 * 5.0f + p2 * 4.0f - p3) * t2 + (p1 * 3.0f - p0 - p2 * 3.0f + p3) * t3) * 0.5f;
+}
+
+SplinePath SplinePath::bake(std::span<const r::Vec3f> control_points, std::size_t samples)
+{
+    SplinePath path;
+    samples = std::max<std::size_t>(samples, 2);
+
+    if (control_points.size() < 2) {
+        const r::Vec3f point = control_points.empty() ? r::Vec3f{0.0f, 0.0f, 0.0f} : control_points.front();
+        path._x.assign(samples, point.x);
+        path._y.assign(samples, point.y);
+        path._z.assign(samples, point.z);
+        return path;
+    }
+
+    /* Dense polyline along the spline, endpoints duplicated so the curve goes through every point */
+    const std::size_t segments = control_points.size() - 1;
+    std::vector<r::Vec3f> dense;
+    std::vector<float> distance;
+    dense.reserve(segments * ARC_STEPS_PER_SEGMENT + 1);
+    distance.reserve(segments * ARC_STEPS_PER_SEGMENT + 1);
+    dense.push_back(control_points.front());
+    distance.push_back(0.0f);
+
+    for (std::size_t s = 0; s < segments; ++s) {
+        const r::Vec3f &p0 = control_points[s == 0 ? 0 : s - 1];
+        const r::Vec3f &p1 = control_points[s];
+        const r::Vec3f &p2 = control_points[s + 1];
+        const r::Vec3f &p3 = control_points[std::min(s + 2, segments)];
+        for (std::size_t step = 1; step <= ARC_STEPS_PER_SEGMENT; ++step) {
+            const float t = static_cast<float>(step) / static_cast<float>(ARC_STEPS_PER_SEGMENT);
+            const r::Vec3f point = catmull_rom(p0, p1, p2, p3, t);
+            distance.push_back(distance.back() + (point - dense.back()).length());
+            dense.push_back(point);
+        }
+    }
+
+    /* Resample at even arc-length spacing */
+    path._length = distance.back();
+    path._x.resize(samples);
+    path._y.resize(samples);
+    path._z.resize(samples);
+    const float spacing = path._length / static_cast<float>(samples - 1);
+    path._inv_spacing = spacing > 0.0f ? 1.0f / spacing : 0.0f;
+
+    std::size_t cursor = 0;
+    for (std::size_t i = 0; i < samples; ++i) {
+        const float target = std::min(static_cast<float>(i) * spacing, path._length);
+        while (cursor + 2 < distance.size() && distance[cursor + 1] < target) {
+            ++cursor;
+        }
+        const float span = distance[cursor + 1] - distance[cursor];
+        const float f = span > 0.0f ? std::clamp((target - distance[cursor]) / span, 0.0f, 1.0f) : 0.0f;
+        const r::Vec3f point = dense[cursor] + (dense[cursor + 1] - dense[cursor]) * f;
+        path._x[i] = point.x;
+        path._y[i] = point.y;
+        path._z[i] = point.z;
+    }
+    return path;
+}
+
+float SplinePath::length() const noexcept
+{
+    return _length;
+}
+
+/* ================================================================================= */
+/* Sampling */
+/* ================================================================================= */
+
+namespace {
+
+struct Table {
+        const float *x;
+        const float *y;
+        const float *z;
+        float inv_spacing;
+        float last; /* Index of the last sample, as a float */
+};
+
+}// namespace
+
+static void sample_scalar(const Table &table, const float *distances, std::size_t count, float *out_x, float *out_y, float *out_z) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        const float t = std::clamp(distances[i] * table.inv_spacing, 0.0f, table.last);
+        const auto index = std::min(static_cast<std::size_t>(t), static_cast<std::size_t>(table.last) - 1);
+        const float f = t - static_cast<float>(index);
+        out_x[i] = table.x[index] + (table.x[index + 1] - table.x[index]) * f;
+        out_y[i] = table.y[index] + (table.y[index + 1] - table.y[index]) * f;
+        out_z[i] = table.z[index] + (table.z[index + 1] - table.z[index]) * f;
+    }
+}
+
+#if defined(R_TYPE_SIMD_X86)
+
+R_TYPE_TARGET("avx2,fma")
+static __m256 lerp_gather(const float *lut, __m256i index, __m256 f) noexcept
+{
+    const __m256 a = _mm256_i32gather_ps(lut, index, 4);
+    const __m256 b = _mm256_i32gather_ps(lut + 1, index, 4);
+    return _mm256_fmadd_ps(_mm256_sub_ps(b, a), f, a);
+}
+
+R_TYPE_TARGET("avx2,fma")
+static void sample_avx2(const Table &table, const float *distances, std::size_t count, float *out_x, float *out_y, float *out_z) noexcept
+{
+    const __m256 inv_spacing = _mm256_set1_ps(table.inv_spacing);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 last = _mm256_set1_ps(table.last);
+    const __m256i last_index = _mm256_set1_epi32(static_cast<int>(table.last) - 1);
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+        const __m256 t = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(distances + i), inv_spacing), zero), last);
+        const __m256i index = _mm256_min_epi32(_mm256_cvttps_epi32(t), last_index);
+        const __m256 f = _mm256_sub_ps(t, _mm256_cvtepi32_ps(index));
+        _mm256_storeu_ps(out_x + i, lerp_gather(table.x, index, f));
+        _mm256_storeu_ps(out_y + i, lerp_gather(table.y, index, f));
+        _mm256_storeu_ps(out_z + i, lerp_gather(table.z, index, f));
+    }
+    sample_scalar(table, distances + i, count - i, out_x + i, out_y + i, out_z + i);
+}
+
+#endif
+
+using SampleFn = void (*)(const Table &, const float *, std::size_t, float *, float *, float *) noexcept;
+
+static SampleFn select_sampler() noexcept
+{
+#if defined(R_TYPE_SIMD_X86)
+    if (cpu_features().avx2 && cpu_features().fma) {
+        return sample_avx2;
+    }
+#endif
+    return sample_scalar;
+}
+
+r::Vec3f SplinePath::sample(float distance) const noexcept
+{
+    r::Vec3f point{0.0f, 0.0f, 0.0f};
+    sample(&distance, 1, &point.x, &point.y, &point.z);
+    return point;
+}
+
+void SplinePath::sample(const float *distances, std::size_t count, float *out_x, float *out_y, float *out_z) const noexcept
+{
+    if (_x.empty()) {
+        return;
+    }
+    static const SampleFn sampler = select_sampler();
+    const Table table{_x.data(), _y.data(), _z.data(), _inv_spacing, static_cast<float>(_x.size() - 1)};
+    sampler(table, distances, count, out_x, out_y, out_z);
+}
@@ -0,0 +1,49 @@
+#include <core/target_index.hpp>
+
+void TargetIndex::clear() noexcept
+{
+    _targets.clear();
+}
+
+void TargetIndex::insert(r::ecs::Entity entity, const r::Vec3f &position)
+{
+    _targets.push_back({entity, position});
+}
+
+const TargetIndex::Target *TargetIndex::nearest(const r::Vec3f &from) const noexcept
+{
+    const Target *best = nullptr;
+    float best_distance_sq = 0.0f;
+
+    for (const Target &target : _targets) {
+        const float distance_sq = (target.position - from).length_sq();
+        if (!best || distance_sq < best_distance_sq) {
+            best = &target;
+            best_distance_sq = distance_sq;
+        }
+    }
+    return best;
+}
+
+const TargetIndex::Target *TargetIndex::find(r::ecs::Entity entity) const noexcept
+{
+    if (entity == r::ecs::NULL_ENTITY) {
+        return nullptr;
+    }
+    for (const Target &target : _targets) {
+        if (target.entity == entity) {
+            return &target;
+        }
+    }
+    return nullptr;
+}
+
+bool TargetIndex::empty() const noexcept
+{
+    return _targets.empty();
+}
+
+std::size_t TargetIndex::size() const noexcept
+{
+    return _targets.size();
+}
@@ -0,0 +1,34 @@
+#include <core/update_tier.hpp>
+
+#include <algorithm>
+
+void TierClock::advance(float dt) noexcept
+{
+    ++_frame;
+    _history[_frame % MAX_TIER_PERIOD] = dt;
+}
+
+bool TierClock::due(std::uint32_t period, std::uint32_t phase) const noexcept
+{
+    return period <= 1 || _frame % period == phase % period;
+}
+
+float TierClock::elapsed(std::uint32_t period) const noexcept
+{
+    const std::uint64_t frames = std::min<std::uint64_t>(std::clamp<std::uint32_t>(period, 1, MAX_TIER_PERIOD), _frame);
+    float total = 0.0f;
+    for (std::uint64_t i = 0; i < frames; ++i) {
+        total += _history[(_frame - i) % MAX_TIER_PERIOD];
+    }
+    return total;
+}
+
+std::uint32_t TierClock::slice(std::uint32_t slices) const noexcept
+{
+    return slices <= 1 ? 0 : static_cast<std::uint32_t>(_frame % slices);
+}
+
+std::uint64_t TierClock::frame() const noexcept
+{
+    return _frame;
+}
@@ -0,0 +1,112 @@
+#include <core/wire.hpp>
+
+#include <bit>
+#include <cstring>
+#include <limits>
+
+namespace wire {
+
+/* Fixed-width loads and stores: one memcpy and at most one byte swap per field */
+template<typename T>
+static T load(const std::uint8_t *bytes) noexcept
+{
+    T value;
+    std::memcpy(&value, bytes, sizeof(T));
+    if constexpr (std::endian::native == std::endian::little) {
+        value = std::byteswap(value);
+    }
+    return value;
+}
+
+template<typename T>
+static void store(std::uint8_t *bytes, T value) noexcept
+{
+    if constexpr (std::endian::native == std::endian::little) {
+        value = std::byteswap(value);
+    }
+    std::memcpy(bytes, &value, sizeof(T));
+}
+
+bool decode_datagram(std::span<const std::uint8_t> datagram, RTypePacketView &view) noexcept
+{
+    if (datagram.size() < RTYPE_HEADER_SIZE) {
+        return false;
+    }
+    const std::uint8_t *bytes = datagram.data();
+    rtype::protocol::RTypeHeader &header = view.header;
+    header.magic = load<std::uint16_t>(bytes + offset::MAGIC);
+    if (header.magic != RTYPE_MAGIC) {
+        return false;
+    }
+    header.version = bytes[offset::VERSION];
+    header.flags = bytes[offset::FLAGS];
+    header.seq = load<std::uint32_t>(bytes + offset::SEQ);
+    header.ackBase = load<std::uint32_t>(bytes + offset::ACK_BASE);
+    header.ackBits = bytes[offset::ACK_BITS];
+    header.channel = bytes[offset::CHANNEL];
+    header.size = load<std::uint16_t>(bytes + offset::SIZE);
+    header.id = load<std::uint32_t>(bytes + offset::ID);
+    header.command = bytes[offset::COMMAND];
+    if (header.size > datagram.size() - RTYPE_HEADER_SIZE) {
+        return false;
+    }
+    view.payload = datagram.subspan(RTYPE_HEADER_SIZE, header.size);
+    return true;
+}
+
+bool decode_datagram(std::span<const std::uint8_t> datagram, rtype::protocol::RTypePacket &packet)
+{
+    RTypePacketView view{};
+    if (!decode_datagram(datagram, view)) {
+        return false;
+    }
+    packet.header = view.header;
+    packet.payload.assign(view.payload);
+    return true;
+}
+
+std::size_t encode_datagram(const rtype::protocol::RTypeHeader &header, std::span<const std::uint8_t> payload,
+    std::span<std::uint8_t> out) noexcept
+{
+    const std::size_t length = RTYPE_HEADER_SIZE + payload.size();
+    if (length > out.size() || payload.size() > std::numeric_limits<std::uint16_t>::max()) {
+        return 0;
+    }
+    std::uint8_t *bytes = out.data();
+    store<std::uint16_t>(bytes + offset::MAGIC, header.magic);
+    bytes[offset::VERSION] = header.version;
+    bytes[offset::FLAGS] = header.flags;
+    store<std::uint32_t>(bytes + offset::SEQ, header.seq);
+    store<std::uint32_t>(bytes + offset::ACK_BASE, header.ackBase);
+    bytes[offset::ACK_BITS] = header.ackBits;
+    bytes[offset::CHANNEL] = header.channel;
+    store<std::uint16_t>(bytes + offset::SIZE, static_cast<std::uint16_t>(payload.size()));
+    store<std::uint32_t>(bytes + offset::ID, header.id);
+    bytes[offset::COMMAND] = header.command;
+    if (!payload.empty()) {
+        std::memcpy(bytes + RTYPE_HEADER_SIZE, payload.data(), payload.size());
+    }
+    return length;
+}
+
+std::size_t encode_datagram(const rtype::protocol::RTypePacket &packet, std::span<std::uint8_t> out) noexcept
+{
+    return encode_datagram(packet.header, packet.payload, out);
+}
+
+rtype::protocol::RTypePacket to_packet(const RTypePacketView &view)
+{
+    return {view.header, PacketPayload{view.payload}};
+}
+
+rtype::protocol::RTypePacket make_packet(rtype::protocol::RTypeCommand command, std::span<const std::uint8_t> payload)
+{
+    rtype::protocol::RTypePacket packet{};
+    packet.header.magic = RTYPE_MAGIC;
+    packet.header.version = 1;
+    packet.header.command = static_cast<std::uint8_t>(command);
+    packet.payload.assign(payload);
+    return packet;
+}
+
+}// namespace wire
@@ -0,0 +1,48 @@
+#include <gateway/gateway.hpp>
+
+#include <atomic>
+#include <charconv>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+static std::atomic<bool> stop_requested{false};
+
+static void request_stop(int)
+{
+    stop_requested.store(true, std::memory_order_relaxed);
+}
+
+/**
+ * @brief `r-type-gateway [address] [port]`: listens on 0.0.0.0:GATEWAY_PORT by default.
+ * @details Game servers register with `r-type-server --gateway address:port`, one match each. Several
+ * servers can run on one box as long as each binds its own UDP port (`--port`).
+ */
+int main(int argc, char **argv)
+{
+    std::string address = "0.0.0.0";
+    std::uint16_t port = GATEWAY_PORT;
+    if (argc > 1) {
+        address = argv[1];
+    }
+    if (argc > 2) {
+        const std::string_view text{argv[2]};
+        std::from_chars(text.data(), text.data() + text.size(), port);
+    }
+
+    Gateway gateway;
+    if (!gateway.listen(address, port)) {
+        std::cerr << "Cannot listen on " << address << ":" << port << ": " << std::strerror(gateway.last_error()) << '\n';
+        return EXIT_FAILURE;
+    }
+    std::clog << "Gateway listening on " << address << ":" << port << '\n';
+
+    std::signal(SIGINT, request_stop);
+    std::signal(SIGTERM, request_stop);
+    gateway.run(stop_requested);
+
+    return 0;
+}
@@ -0,0 +1,548 @@
+#include <gateway/gateway.hpp>
+
+#include <server/tcp_frame.hpp>
+
+#include <arpa/inet.h>
+#include <array>
+#include <cerrno>
+#include <iostream>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+using rtype::protocol::RTypeTCPMessage;
+
+static constexpr int MAX_EVENTS = 64;
+static constexpr int WAIT_TIMEOUT_MS = 500;
+static constexpr std::size_t MAX_PENDING_OUTPUT = 64 * 1024; /* A peer that stops reading is dropped past this */
+static constexpr std::uint64_t LISTENER = 0;                 /* epoll tag of the listening socket */
+
+namespace {
+
+enum class Role : std::uint8_t { Unknown, Server, Client };
+
+struct Connection {
+        int fd = -1;
+        Role role = Role::Unknown;
+        std::uint32_t address = 0;///< Peer IPv4, network order
+        std::uint32_t server = 0; ///< Server id once registered
+        wire::FrameParser input;
+        std::vector<std::uint8_t> output;
+        std::size_t sent = 0;///< Bytes of `output` already written
+        bool writable_armed = false;
+        bool closing = false;
+};
+
+struct GameServer {
+        std::uint64_t connection;
+        std::uint32_t address;///< Network order
+        std::uint16_t port;   ///< Host order
+        std::uint32_t capacity;
+        std::uint32_t rooms = 0;
+        std::uint32_t ticking = 0;
+        std::unordered_map<std::uint32_t, std::uint32_t> games;///< Room id -> game id
+};
+
+struct Ticket {
+        std::uint64_t client;
+        std::uint32_t server;
+};
+
+struct Game {
+        std::uint32_t server;
+        std::uint32_t room;
+};
+
+}// namespace
+
+struct Gateway::State {
+        int epoll = -1;
+        int listener = -1;
+        int error = 0;
+
+        std::unordered_map<std::uint64_t, Connection> connections;
+        std::uint64_t next_connection = LISTENER + 1;
+        std::vector<std::uint64_t> dirty;///< Connections with output to flush at the end of the iteration
+
+        std::unordered_map<std::uint32_t, GameServer> servers;
+        std::unordered_map<std::uint32_t, Ticket> tickets;
+        std::unordered_map<std::uint32_t, Game> games;
+        std::uint32_t next_server = 1;
+        std::uint32_t next_ticket = 1;
+        std::uint32_t next_game = 1;
+
+        std::vector<std::uint8_t> scratch;///< Payload encode scratch
+
+        ~State()
+        {
+            for (const auto &[id, connection] : connections) {
+                ::close(connection.fd);
+            }
+            if (listener >= 0) {
+                ::close(listener);
+            }
+            if (epoll >= 0) {
+                ::close(epoll);
+            }
+        }
+
+        void accept_all();
+        void read(std::uint64_t id, Connection &connection);
+        void flush(std::uint64_t id, Connection &connection);
+        void close(std::uint64_t id);
+
+        void queue(std::uint64_t id, RTypeTCPMessage type, std::span<const std::uint8_t> payload);
+        void handle(std::uint64_t id, Connection &connection, const wire::TcpFrame &frame);
+        void handle_server(std::uint64_t id, Connection &connection, const wire::TcpFrame &frame);
+        void handle_client(std::uint64_t id, const wire::TcpFrame &frame);
+        void reply_game(std::uint64_t client, std::uint32_t game_id, const Game &game);
+        std::uint32_t least_loaded() const noexcept;
+};
+
+/* ================================================================================= */
+/* Connections */
+/* ================================================================================= */
+
+static void watch(int epoll, int op, int fd, std::uint64_t id, bool writable)
+{
+    epoll_event event{};
+    event.events = EPOLLIN | EPOLLRDHUP | (writable ? EPOLLOUT : 0u);
+    event.data.u64 = id;
+    ::epoll_ctl(epoll, op, fd, &event);
+}
+
+void Gateway::State::accept_all()
+{
+    while (true) {
+        sockaddr_in remote{};
+        socklen_t remote_size = sizeof(remote);
+        const int fd = ::accept4(listener, reinterpret_cast<sockaddr *>(&remote), &remote_size, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            /* EAGAIN: backlog drained. Anything else (EMFILE...) is retried on the next wakeup */
+            return;
+        }
+        const int on = 1;
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+
+        const std::uint64_t id = next_connection++;
+        Connection &connection = connections[id];
+        connection.fd = fd;
+        connection.address = remote.sin_addr.s_addr;
+        watch(epoll, EPOLL_CTL_ADD, fd, id, false);
+    }
+}
+
+/**
+ * @brief Reads everything available and handles each complete frame in place.
+ */
+void Gateway::State::read(std::uint64_t id, Connection &connection)
+{
+    while (!connection.closing) {
+        const std::span<std::uint8_t> space = connection.input.prepare();
+        const ssize_t length = ::recv(connection.fd, space.data(), space.size(), 0);
+        if (length == 0 || (length < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+            close(id);
+            return;
+        }
+        if (length < 0) {
+            return;
+        }
+        connection.input.commit(static_cast<std::size_t>(length));
+
+        wire::TcpFrame frame{};
+        wire::FrameParser::Status status = wire::FrameParser::Status::NeedMore;
+        while (!connection.closing && (status = connection.input.next(frame)) == wire::FrameParser::Status::Frame) {
+            handle(id, connection, frame);
+        }
+        if (!connection.closing && status == wire::FrameParser::Status::Invalid) {
+            std::cerr << "Gateway: dropping a connection that sent an invalid frame\n";
+            close(id);
+        }
+    }
+}
+
+void Gateway::State::flush(std::uint64_t id, Connection &connection)
+{
+    while (connection.sent < connection.output.size()) {
+        const ssize_t sent = ::send(connection.fd, connection.output.data() + connection.sent, connection.output.size() - connection.sent,
+            MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                break;
+            }
+            if (errno == EINTR) {
+                continue;
+            }
+            close(id);
+            return;
+        }
+        connection.sent += static_cast<std::size_t>(sent);
+    }
+
+    const bool pending = connection.sent < connection.output.size();
+    if (!pending) {
+        connection.output.clear();
+        connection.sent = 0;
+    }
+    if (pending != connection.writable_armed) {
+        watch(epoll, EPOLL_CTL_MOD, connection.fd, id, pending);
+        connection.writable_armed = pending;
+    }
+}
+
+/**
+ * @brief Marks the connection for removal at the end of the iteration, and forgets a server's games
+ * and pending tickets right away so nothing is routed to it anymore.
+ */
+void Gateway::State::close(std::uint64_t id)
+{
+    const auto it = connections.find(id);
+    if (it == connections.end() || it->second.closing) {
+        return;
+    }
+    Connection &connection = it->second;
+    connection.closing = true;
+
+    if (connection.role != Role::Server) {
+        return;
+    }
+    const auto server = servers.find(connection.server);
+    if (server == servers.end()) {
+        return;
+    }
+    for (const auto &[room, game] : server->second.games) {
+        games.erase(game);
+    }
+    for (auto ticket = tickets.begin(); ticket != tickets.end();) {
+        if (ticket->second.server == connection.server) {
+            queue(ticket->second.client, RTypeTCPMessage::GCMD_CREATE_KO, {});
+            ticket = tickets.erase(ticket);
+        } else {
+            ++ticket;
+        }
+    }
+    std::clog << "Gateway: server " << connection.server << " left\n";
+    servers.erase(server);
+}
+
+void Gateway::State::queue(std::uint64_t id, RTypeTCPMessage type, std::span<const std::uint8_t> payload)
+{
+    const auto it = connections.find(id);
+    if (it == connections.end() || it->second.closing) {
+        return;
+    }
+    Connection &connection = it->second;
+    if (connection.output.size() - connection.sent > MAX_PENDING_OUTPUT) {
+        std::cerr << "Gateway: dropping a connection that does not read its replies\n";
+        close(id);
+        return;
+    }
+    if (connection.output.size() == connection.sent) {
+        dirty.push_back(id);
+    }
+    wire::encode_frame(type, payload, connection.output);
+}
+
+/* ================================================================================= */
+/* Routing */
+/* ================================================================================= */
+
+void Gateway::State::handle(std::uint64_t id, Connection &connection, const wire::TcpFrame &frame)
+{
+    switch (frame.type) {
+        case RTypeTCPMessage::GCMD_GS:
+        case RTypeTCPMessage::GCMD_OCCUPANCY:
+        case RTypeTCPMessage::GCMD_GID:
+        case RTypeTCPMessage::GCMD_CREATE_KO:
+        case RTypeTCPMessage::GCMD_GAME_END:
+            if (connection.role == Role::Unknown && frame.type == RTypeTCPMessage::GCMD_GS) {
+                connection.role = Role::Server;
+            }
+            if (connection.role == Role::Server) {
+                handle_server(id, connection, frame);
+            }
+            break;
+        case RTypeTCPMessage::GCMD_CREATE:
+        case RTypeTCPMessage::GCMD_JOIN:
+            if (connection.role == Role::Unknown) {
+                connection.role = Role::Client;
+            }
+            if (connection.role == Role::Client) {
+                handle_client(id, frame);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void Gateway::State::handle_server(std::uint64_t id, Connection &connection, const wire::TcpFrame &frame)
+{
+    const std::span<const std::uint8_t> p = frame.payload;
+    const auto server = servers.find(connection.server);
+
+    if (frame.type == RTypeTCPMessage::GCMD_GS) {
+        if (server != servers.end() || p.size() < 7) {
+            return;
+        }
+        if (p[0] != static_cast<std::uint8_t>(rtype::protocol::RTypeGameType::G_RTYPE)) {
+            queue(id, RTypeTCPMessage::GCMD_GS_KO, {});
+            return;
+        }
+        connection.server = next_server++;
+        servers.emplace(connection.server,
+            GameServer{.connection = id,
+                .address = connection.address,
+                .port = static_cast<std::uint16_t>(wire::load_be(p, 1, 2)),
+                .capacity = wire::load_be(p, 3, 4),
+                .rooms = 0,
+                .ticking = 0,
+                .games = {}});
+        scratch.clear();
+        wire::append_be(scratch, 4, connection.server);
+        queue(id, RTypeTCPMessage::GCMD_GS_OK, scratch);
+        std::clog << "Gateway: server " << connection.server << " registered on UDP port " << wire::load_be(p, 1, 2) << " with "
+                  << wire::load_be(p, 3, 4) << " rooms\n";
+        return;
+    }
+    if (server == servers.end()) {
+        return;
+    }
+    GameServer &host = server->second;
+
+    switch (frame.type) {
+        case RTypeTCPMessage::GCMD_OCCUPANCY:
+            if (p.size() >= 8) {
+                host.rooms = wire::load_be(p, 0, 4);
+                host.ticking = wire::load_be(p, 4, 4);
+            }
+            break;
+        case RTypeTCPMessage::GCMD_GID: {
+            if (p.size() < 8) {
+                break;
+            }
+            const auto ticket = tickets.find(wire::load_be(p, 0, 4));
+            if (ticket == tickets.end() || ticket->second.server != connection.server) {
+                break;
+            }
+            const Game game{connection.server, wire::load_be(p, 4, 4)};
+            const std::uint32_t game_id = next_game++;
+            games.emplace(game_id, game);
+            host.games.emplace(game.room, game_id);
+            reply_game(ticket->second.client, game_id, game);
+            tickets.erase(ticket);
+            break;
+        }
+        case RTypeTCPMessage::GCMD_CREATE_KO: {
+            if (p.size() < 4) {
+                break;
+            }
+            const auto ticket = tickets.find(wire::load_be(p, 0, 4));
+            if (ticket != tickets.end() && ticket->second.server == connection.server) {
+                queue(ticket->second.client, RTypeTCPMessage::GCMD_CREATE_KO, {});
+                tickets.erase(ticket);
+            }
+            break;
+        }
+        case RTypeTCPMessage::GCMD_GAME_END: {
+            if (p.size() < 4) {
+                break;
+            }
+            const auto game = host.games.find(wire::load_be(p, 0, 4));
+            if (game != host.games.end()) {
+                games.erase(game->second);
+                host.games.erase(game);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void Gateway::State::handle_client(std::uint64_t id, const wire::TcpFrame &frame)
+{
+    const std::span<const std::uint8_t> p = frame.payload;
+
+    if (frame.type == RTypeTCPMessage::GCMD_CREATE) {
+        std::uint32_t server_id = 0;
+        if (!p.empty() && p[0] == static_cast<std::uint8_t>(rtype::protocol::RTypeGameType::G_RTYPE)) {
+            server_id = least_loaded();
+        }
+        if (server_id == 0) {
+            queue(id, RTypeTCPMessage::GCMD_CREATE_KO, {});
+            return;
+        }
+        GameServer &server = servers.at(server_id);
+        const std::uint32_t ticket = next_ticket++;
+        tickets.emplace(ticket, Ticket{id, server_id});
+        /* Count the room now: the next GCMD_OCCUPANCY corrects it, and a burst of creates spreads meanwhile */
+        ++server.rooms;
+        scratch.clear();
+        wire::append_be(scratch, 4, ticket);
+        queue(server.connection, RTypeTCPMessage::GCMD_CREATE, scratch);
+        return;
+    }
+
+    const auto game = p.size() >= 4 ? games.find(wire::load_be(p, 0, 4)) : games.end();
+    if (game == games.end()) {
+        queue(id, RTypeTCPMessage::GCMD_JOIN_KO, {});
+        return;
+    }
+    reply_game(id, game->first, game->second);
+}
+
+void Gateway::State::reply_game(std::uint64_t client, std::uint32_t game_id, const Game &game)
+{
+    const GameServer &server = servers.at(game.server);
+    scratch.clear();
+    wire::append_be(scratch, 4, game_id);
+    wire::append_be(scratch, 4, ntohl(server.address));
+    wire::append_be(scratch, 2, server.port);
+    wire::append_be(scratch, 4, game.room);
+    queue(client, RTypeTCPMessage::GCMD_GID, scratch);
+}
+
+/**
+ * @brief Id of the server with the lowest open rooms / capacity ratio among those below capacity, 0 if all are full.
+ */
+std::uint32_t Gateway::State::least_loaded() const noexcept
+{
+    std::uint32_t best_id = 0;
+    const GameServer *best = nullptr;
+    for (const auto &[id, server] : servers) {
+        if (server.rooms >= server.capacity) {
+            continue;
+        }
+        /* rooms / capacity < best.rooms / best.capacity, without dividing */
+        if (!best
+            || static_cast<std::uint64_t>(server.rooms) * best->capacity < static_cast<std::uint64_t>(best->rooms) * server.capacity) {
+            best_id = id;
+            best = &server;
+        }
+    }
+    return best_id;
+}
+
+/* ================================================================================= */
+/* Gateway */
+/* ================================================================================= */
+
+Gateway::Gateway() : _state(std::make_unique<State>())
+{
+}
+
+Gateway::~Gateway() = default;
+
+bool Gateway::listen(const std::string &address, std::uint16_t port)
+{
+    State &state = *_state;
+    sockaddr_in local{};
+    local.sin_family = AF_INET;
+    local.sin_port = htons(port);
+    if (::inet_pton(AF_INET, address.c_str(), &local.sin_addr) != 1) {
+        state.error = EINVAL;
+        return false;
+    }
+
+    if (state.epoll < 0 && (state.epoll = ::epoll_create1(EPOLL_CLOEXEC)) < 0) {
+        state.error = errno;
+        return false;
+    }
+    const int fd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        state.error = errno;
+        return false;
+    }
+    const int on = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    if (::bind(fd, reinterpret_cast<const sockaddr *>(&local), sizeof(local)) != 0 || ::listen(fd, SOMAXCONN) != 0) {
+        state.error = errno;
+        ::close(fd);
+        return false;
+    }
+    if (state.listener >= 0) {
+        ::close(state.listener);
+    }
+    state.listener = fd;
+    watch(state.epoll, EPOLL_CTL_ADD, fd, LISTENER, false);
+    state.error = 0;
+    return true;
+}
+
+std::uint16_t Gateway::local_port() const noexcept
+{
+    sockaddr_in local{};
+    socklen_t local_size = sizeof(local);
+    if (_state->listener < 0 || ::getsockname(_state->listener, reinterpret_cast<sockaddr *>(&local), &local_size) != 0) {
+        return 0;
+    }
+    return ntohs(local.sin_port);
+}
+
+void Gateway::run(const std::atomic<bool> &stop)
+{
+    State &state = *_state;
+    std::array<epoll_event, MAX_EVENTS> events{};
+
+    while (!stop.load(std::memory_order_relaxed)) {
+        const int count = ::epoll_wait(state.epoll, events.data(), MAX_EVENTS, WAIT_TIMEOUT_MS);
+        for (int i = 0; i < count; ++i) {
+            const epoll_event &event = events[static_cast<std::size_t>(i)];
+            if (event.data.u64 == LISTENER) {
+                state.accept_all();
+                continue;
+            }
+            const auto it = state.connections.find(event.data.u64);
+            if (it == state.connections.end() || it->second.closing) {
+                continue;
+            }
+            if ((event.events & EPOLLIN) != 0) {
+                /* Reads first: a peer that sent its last frames then hung up still gets them handled */
+                state.read(it->first, it->second);
+            }
+            if ((event.events & (EPOLLERR | EPOLLHUP)) != 0) {
+                state.close(it->first);
+            } else if ((event.events & EPOLLOUT) != 0 && !it->second.closing) {
+                state.flush(it->first, it->second);
+            }
+        }
+
+        /* One send per connection and iteration, however many frames were queued to it */
+        for (const std::uint64_t id : state.dirty) {
+            const auto it = state.connections.find(id);
+            if (it != state.connections.end() && !it->second.closing) {
+                state.flush(id, it->second);
+            }
+        }
+        state.dirty.clear();
+
+        for (auto it = state.connections.begin(); it != state.connections.end();) {
+            if (it->second.closing) {
+                ::close(it->second.fd);
+                it = state.connections.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+}
+
+std::size_t Gateway::server_count() const noexcept
+{
+    return _state->servers.size();
+}
+
+std::size_t Gateway::game_count() const noexcept
+{
+    return _state->games.size();
+}
+
+int Gateway::last_error() const noexcept
+{
+    return _state->error;
+}
@@ -10,16 +10,25 @@
 #include <R-Engine/ECS/RunConditions.hpp>
 #include <R-Engine/Plugins/AudioPlugin.hpp>
 #include <R-Engine/Core/Filepath.hpp>
+#include <optional>
 
 #include <components/common.hpp>
 #include <components/enemy.hpp>
 #include <components/player.hpp>
 #include <components/projectiles.hpp>
+#include <core/collision_shapes.hpp>
 #include <events/game_events.hpp>
 #include <resources/level.hpp>
+#include <resources/level_arena.hpp>
 #include <state/game_state.hpp>
 #include <state/run_conditions.hpp>
 
+/* ================================================================================= */
+/* Constants */
+/* ================================================================================= */
+
+static constexpr int WEAK_POINT_DAMAGE_MULTIPLIER = 3;
+
 /* ================================================================================= */
 /* Event Handlers */
 /* ================================================================================= */
@@ -28,9 +37,11 @@
  * @brief Listens for EntityDiedEvent and despawns the corresponding entity.
  * @details This decouples the act of destroying an entity from the logic that decides it should be destroyed.
  */
-static void handle_entity_death(r::ecs::Commands &commands, r::ecs::EventReader<EntityDiedEvent> reader)
+static void handle_entity_death(r::ecs::Commands &commands, r::ecs::EventReader<EntityDiedEvent> reader,
+    r::ecs::ResMut<BattleArena> arena)
 {
     for (const auto &event : reader) {
+        arena.ptr->release(event.entity);
         commands.despawn(event.entity);
     }
 }
@@ -43,7 +54,7 @@ struct ExplosionSfxResource {
 /* Load explosion sound at startup */
 static void explosion_sfx_startup(r::ecs::ResMut<r::AudioManager> audio, r::ecs::ResMut<ExplosionSfxResource> res)
 {
-    if (res.ptr->handle != r::AudioInvalidHandle)
+    if (!audio.ptr || res.ptr->handle != r::AudioInvalidHandle)
         return;
     const std::string &path = r::path::get("assets/sounds/explosion.mp3");
     const auto handle = audio.ptr->load(path);
@@ -55,11 +66,12 @@ static void explosion_sfx_startup(r::ecs::ResMut<r::AudioManager> audio, r::ecs:
     r::Logger::info(std::string{"explosion_sfx_startup: explosion handle="} + std::to_string(handle));
 }
 
-/* Play explosion when an Enemy or Boss dies. Runs before actual despawn to be able to query components. */
+/* Play explosion when an Enemy, Boss or Shield dies. Runs before actual despawn to be able to query components. */
 static void play_explosion_on_death(r::ecs::Commands &commands, r::ecs::EventReader<EntityDiedEvent> reader,
     r::ecs::Res<ExplosionSfxResource> explosion_res,
     r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::With<Enemy>> enemy_query,
-    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::With<Boss>> boss_query)
+    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::With<Boss>> boss_query,
+    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::With<Shield>> shield_query)
 {
     if (explosion_res.ptr->handle == r::AudioInvalidHandle) {
         return; /* nothing to play */
@@ -84,6 +96,14 @@ static void play_explosion_on_death(r::ecs::Commands &commands, r::ecs::EventRea
                 break;
             }
         }
+
+        /* Check shields */
+        for (auto it = shield_query.begin(); it != shield_query.end(); ++it) {
+            if (it.entity() == dead) {
+                commands.spawn(r::AudioPlayer{explosion_res.ptr->handle}, r::AudioSink{}, TimedDespawn{.timer = 1.0f});
+                break;
+            }
+        }
     }
 }
 
@@ -91,31 +111,40 @@ static void play_explosion_on_death(r::ecs::Commands &commands, r::ecs::EventRea
 /* Combat Systems :: Helpers */
 /* ================================================================================= */
 
-static bool process_bullet_enemy_collision(r::ecs::EventWriter<EntityDiedEvent> &entity_death_writer, r::ecs::Entity bullet_entity,
-    const r::Vec3f &bullet_center, float bullet_radius,
-    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::With<Enemy>> &enemy_query,
-    r::ecs::Query<r::ecs::Ref<r::ecs::Parent>, r::ecs::Mut<Health>, r::ecs::With<Shield>> &shield_query)
+/**
+ * @brief Volume covered by a projectile since the previous tick.
+ * @details The previous position is rebuilt as `center - velocity * dt`, the step movement_system
+ * just integrated, so nothing has to be stored per projectile. Targets are taken at their current
+ * position. A CapsuleCollider extends the sweep by its half axis at both ends, which is exact for
+ * projectiles moving along their axis (the wave cannon) and conservative otherwise.
+ */
+static shapes::Sweep projectile_sweep(const r::Vec3f &center, float radius, const Velocity &velocity, const CapsuleCollider *capsule, float dt)
+{
+    const r::Vec3f previous = center - velocity.value * dt;
+    if (!capsule) {
+        return {previous, center, radius};
+    }
+
+    const r::Vec3f &half_axis = capsule->half_axis;
+    const float along = velocity.value.x * half_axis.x + velocity.value.y * half_axis.y + velocity.value.z * half_axis.z;
+    if (along >= 0.0f) {
+        return {previous - half_axis, center + half_axis, radius};
+    }
+    return {previous + half_axis, center - half_axis, radius};
+}
+
+static bool process_bullet_enemy_collision(r::ecs::EventWriter<EntityDiedEvent> &entity_death_writer,
+    r::ecs::EventWriter<HealthChangedEvent> &health_writer, r::ecs::Entity bullet_entity, const shapes::Sweep &sweep,
+    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::With<Enemy>> &enemy_query)
 {
     for (auto enemy_it = enemy_query.begin(); enemy_it != enemy_query.end(); ++enemy_it) {
-    auto [enemy_transform, enemy_collider, health, _e] = *enemy_it;
-    /* Use global transform so child shields (local transform) are evaluated in world space */
-    r::Vec3f enemy_center = enemy_transform.ptr->position + enemy_collider.ptr->offset;
-        float distance = (bullet_center - enemy_center).length();
-        float radii_sum = bullet_radius + enemy_collider.ptr->radius;
+        auto [enemy_transform, enemy_collider, health, _e] = *enemy_it;
+        r::Vec3f enemy_center = enemy_transform.ptr->position + enemy_collider.ptr->offset;
 
-        if (distance < radii_sum) {
+        if (shapes::sweep_vs_sphere(sweep, enemy_center, enemy_collider.ptr->radius)) {
             entity_death_writer.send({bullet_entity});
             health.ptr->current -= 1;
-
-            /* If this entity is a shield, log the damage and remaining HP */
-            for (auto shield_it = shield_query.begin(); shield_it != shield_query.end(); ++shield_it) {
-                auto [parent, shield_health, _s] = *shield_it;
-                if (shield_it.entity() == enemy_it.entity()) {
-                        // r::Logger::info("Shield " + std::to_string(static_cast<uint32_t>(enemy_it.entity())) + " took " + std::to_string(1) + " damage, remaining HP: " + std::to_string(shield_health.ptr->current));
-                    break;
-                }
-                (void)parent; /* parent not used here */
-            }
+            health_writer.send({enemy_it.entity()});
 
             if (health.ptr->current <= 0) {
                 entity_death_writer.send({enemy_it.entity()});
@@ -127,83 +156,159 @@ static bool process_bullet_enemy_collision(r::ecs::EventWriter<EntityDiedEvent>
 }
 
 static void handle_bullet_vs_enemy_collisions(r::ecs::EventWriter<EntityDiedEvent> &entity_death_writer,
-    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Collider>, r::ecs::With<PlayerBullet>> &bullet_query,
-    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::With<Enemy>> &enemy_query,
-    r::ecs::Query<r::ecs::Ref<r::ecs::Parent>, r::ecs::Mut<Health>, r::ecs::With<Shield>> &shield_query)
+    r::ecs::EventWriter<HealthChangedEvent> &health_writer, float dt,
+    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Collider>, r::ecs::Ref<Velocity>, r::ecs::With<PlayerBullet>> &bullet_query,
+    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::With<Enemy>> &enemy_query)
 {
     for (auto bullet_it = bullet_query.begin(); bullet_it != bullet_query.end(); ++bullet_it) {
-        auto [bullet_transform, bullet_collider, _b] = *bullet_it;
+        auto [bullet_transform, bullet_collider, bullet_velocity, _b] = *bullet_it;
         r::Vec3f bullet_center = bullet_transform.ptr->position + bullet_collider.ptr->offset;
+        const shapes::Sweep sweep = projectile_sweep(bullet_center, bullet_collider.ptr->radius, *bullet_velocity.ptr, nullptr, dt);
+
+        process_bullet_enemy_collision(entity_death_writer, health_writer, bullet_it.entity(), sweep, enemy_query);
+    }
+}
+
+/**
+ * @brief Narrow phase against a compound collider, only called once the bounding sphere was hit.
+ * @return The role of the first part overlapping the projectile, or std::nullopt when it passes between parts.
+ * Entities without a CompoundCollider are a single hull sphere, already confirmed by the bound test.
+ */
+static std::optional<HitRole> find_hit_part(const CompoundCollider *compound, const r::Vec3f &position, const shapes::Sweep &sweep)
+{
+    if (!compound) {
+        return HitRole::Hull;
+    }
+    for (const auto &part : compound->parts) {
+        const r::Vec3f part_origin = position + part.offset;
+        bool hit = false;
+        switch (part.shape) {
+            case ColliderPart::Shape::Sphere:
+                hit = shapes::sweep_vs_sphere(sweep, part_origin, part.radius);
+                break;
+            case ColliderPart::Shape::Capsule:
+                hit = shapes::sweep_vs_capsule(sweep, part_origin, position + part.extent, part.radius);
+                break;
+            case ColliderPart::Shape::Box:
+                hit = shapes::sweep_vs_aabb(sweep, part_origin, part.extent);
+                break;
+            default:
+                break;
+        }
+        if (hit) {
+            return part.role;
+        }
+    }
+    return std::nullopt;
+}
+
+static int damage_for_role(HitRole role, int damage)
+{
+    switch (role) {
+        case HitRole::WeakPoint:
+            return damage * WEAK_POINT_DAMAGE_MULTIPLIER;
+        case HitRole::Hull:
+            return damage;
+        case HitRole::Armor:
+        case HitRole::Shield:
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Tests a projectile against the shield entities, which are only reached after a boss bound hit.
+ * @return true if a shield absorbed the projectile.
+ */
+static bool hit_boss_shields(r::ecs::EventWriter<EntityDiedEvent> &entity_death_writer, r::ecs::EventWriter<HealthChangedEvent> &health_writer,
+    r::ecs::Entity projectile, const shapes::Sweep &sweep, int damage,
+    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::Ref<r::ecs::Parent>, r::ecs::With<Shield>> &shield_world_query)
+{
+    for (auto shield_it = shield_world_query.begin(); shield_it != shield_world_query.end(); ++shield_it) {
+        auto [shield_transform, shield_collider, shield_health, shield_parent, _s] = *shield_it;
+        r::Vec3f shield_center = shield_transform.ptr->position + shield_collider.ptr->offset;
+        if (shapes::sweep_vs_sphere(sweep, shield_center, shield_collider.ptr->radius)) {
+            entity_death_writer.send({projectile});
+            shield_health.ptr->current -= damage;
+            health_writer.send({shield_it.entity()});
+            if (shield_health.ptr->current <= 0) {
+                entity_death_writer.send({shield_it.entity()});
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool any_shield_alive(
+    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::Ref<r::ecs::Parent>, r::ecs::With<Shield>> &shield_world_query)
+{
+    for (auto [shield_transform, shield_collider, shield_health, shield_parent, _s] : shield_world_query) {
+        if (shield_health.ptr->current > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Resolves a projectile against one boss: bound sphere, then shields, then compound parts.
+ * @return true if the projectile was consumed by this boss.
+ */
+static bool resolve_boss_hit(r::ecs::EventWriter<EntityDiedEvent> &entity_death_writer, r::ecs::EventWriter<BossDefeatedEvent> &boss_death_writer,
+    r::ecs::EventWriter<HealthChangedEvent> &health_writer, r::ecs::Entity projectile, const shapes::Sweep &sweep, int damage,
+    r::ecs::Entity boss, const r::Vec3f &boss_position, const Collider &bound, Health &health, const CompoundCollider *compound,
+    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::Ref<r::ecs::Parent>, r::ecs::With<Shield>> &shield_world_query)
+{
+    /* Broad phase: a projectile nowhere near the boss costs this single test */
+    if (!shapes::sweep_vs_sphere(sweep, boss_position + bound.offset, bound.radius)) {
+        return false;
+    }
+
+    if (hit_boss_shields(entity_death_writer, health_writer, projectile, sweep, damage, shield_world_query)) {
+        return true;
+    }
+
+    const std::optional<HitRole> role = find_hit_part(compound, boss_position, sweep);
+    if (!role) {
+        return false; /* Inside the bound but between parts */
+    }
 
-    process_bullet_enemy_collision(entity_death_writer, bullet_it.entity(), bullet_center, bullet_collider.ptr->radius, enemy_query, shield_query);
+    entity_death_writer.send({projectile});
+
+    /* While shields are alive the boss is invulnerable */
+    const int dealt = any_shield_alive(shield_world_query) ? 0 : damage_for_role(*role, damage);
+    if (dealt <= 0) {
+        return true;
+    }
+
+    health.current -= dealt;
+    health_writer.send({boss});
+    if (health.current <= 0) {
+        entity_death_writer.send({boss});
+        boss_death_writer.send({});
     }
+    return true;
 }
 
 static void handle_bullet_vs_boss_collisions(r::ecs::EventWriter<EntityDiedEvent> &entity_death_writer,
-    r::ecs::EventWriter<BossDefeatedEvent> &boss_death_writer,
-    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Collider>, r::ecs::With<PlayerBullet>> &bullet_query,
-    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::With<Boss>> &boss_query,
+    r::ecs::EventWriter<BossDefeatedEvent> &boss_death_writer, r::ecs::EventWriter<HealthChangedEvent> &health_writer, float dt,
+    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Collider>, r::ecs::Ref<Velocity>, r::ecs::With<PlayerBullet>> &bullet_query,
+    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::Optional<r::ecs::Ref<CompoundCollider>>,
+        r::ecs::With<Boss>> &boss_query,
     r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::Ref<r::ecs::Parent>, r::ecs::With<Shield>> &shield_world_query)
 {
     for (auto bullet_it = bullet_query.begin(); bullet_it != bullet_query.end(); ++bullet_it) {
-        auto [bullet_transform, bullet_collider, _b] = *bullet_it;
+        auto [bullet_transform, bullet_collider, bullet_velocity, _b] = *bullet_it;
+        r::Vec3f bullet_center = bullet_transform.ptr->position + bullet_collider.ptr->offset;
+        const shapes::Sweep sweep = projectile_sweep(bullet_center, bullet_collider.ptr->radius, *bullet_velocity.ptr, nullptr, dt);
+
         for (auto boss_it = boss_query.begin(); boss_it != boss_query.end(); ++boss_it) {
-            auto [boss_transform, boss_collider, health, _boss] = *boss_it;
-            r::Vec3f bullet_center = bullet_transform.ptr->position + bullet_collider.ptr->offset;
+            auto [boss_transform, boss_collider, health, compound, _boss] = *boss_it;
             /* boss_transform is a global transform to match bullets' world coordinates */
-            r::Vec3f boss_center = boss_transform.ptr->position + boss_collider.ptr->offset;
-            float distance = (bullet_center - boss_center).length();
-            float radii_sum = bullet_collider.ptr->radius + boss_collider.ptr->radius;
-
-            if (distance < radii_sum) {
-                /* First: check explicit shield collisions at bullet position and process them */
-                bool bullet_handled_by_shield = false;
-                for (auto shield_it = shield_world_query.begin(); shield_it != shield_world_query.end(); ++shield_it) {
-                    auto [shield_transform, shield_collider, shield_health, shield_parent, _s] = *shield_it;
-                    r::Vec3f shield_center = shield_transform.ptr->position + shield_collider.ptr->offset;
-                    float shield_radii_sum = bullet_collider.ptr->radius + shield_collider.ptr->radius;
-                    if ((bullet_center - shield_center).length() < shield_radii_sum) {
-                        /* Bullet hits shield: consume bullet and damage shield */
-                        entity_death_writer.send({bullet_it.entity()});
-                        shield_health.ptr->current -= 1;
-                        if (shield_health.ptr->current <= 0) {
-                            entity_death_writer.send({shield_it.entity()});
-                        }
-                        bullet_handled_by_shield = true;
-                        break;
-                    }
-                }
-
-                if (bullet_handled_by_shield) {
-                    break; /* don't let this bullet also damage the boss */
-                }
-
-                /* If any shields exist (child entities with Shield component and health > 0), boss is invulnerable */
-                    bool shields_alive = false;
-                    for (auto shield_it = shield_world_query.begin(); shield_it != shield_world_query.end(); ++shield_it) {
-                        auto [shield_transform_w, shield_collider_w, shield_health_w, shield_parent_w, _s] = *shield_it;
-                        if (shield_health_w.ptr->current > 0) {
-                            shields_alive = true;
-                            break;
-                        }
-                    }
-
-                if (shields_alive) {
-                    /* If shields are alive, bullets should not damage the boss here. Destroy bullet only. */
-                    entity_death_writer.send({bullet_it.entity()});
-                    break;
-                }
-
-                /* No shields blocking: apply damage to boss */
-                entity_death_writer.send({bullet_it.entity()});
-                health.ptr->current -= 1;
-
-                
-
-                if (health.ptr->current <= 0) {
-                    entity_death_writer.send({boss_it.entity()});
-                    boss_death_writer.send({});
-                }
+            if (resolve_boss_hit(entity_death_writer, boss_death_writer, health_writer, bullet_it.entity(), sweep, 1,
+                    boss_it.entity(), boss_transform.ptr->position, *boss_collider.ptr, *health.ptr,
+                    compound.ptr, shield_world_query)) {
                 break; /* A bullet can only hit one boss */
             }
         }
@@ -211,86 +316,50 @@ static void handle_bullet_vs_boss_collisions(r::ecs::EventWriter<EntityDiedEvent
 }
 
 static bool process_beam_boss_collision(r::ecs::EventWriter<EntityDiedEvent> &entity_death_writer,
-    r::ecs::EventWriter<BossDefeatedEvent> &boss_death_writer, r::ecs::Entity beam_entity, const r::Vec3f &beam_center, float beam_radius,
-    int beam_damage, r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::With<Boss>> &boss_query,
+    r::ecs::EventWriter<BossDefeatedEvent> &boss_death_writer, r::ecs::EventWriter<HealthChangedEvent> &health_writer, r::ecs::Entity beam_entity,
+    const shapes::Sweep &sweep, int beam_damage,
+    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::Optional<r::ecs::Ref<CompoundCollider>>,
+        r::ecs::With<Boss>> &boss_query,
     r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::Ref<r::ecs::Parent>, r::ecs::With<Shield>> &shield_world_query)
 {
     for (auto boss_it = boss_query.begin(); boss_it != boss_query.end(); ++boss_it) {
-        auto [boss_transform, boss_collider, health, _boss] = *boss_it;
-        /* Use global transform for boss as well */
-        r::Vec3f boss_center = boss_transform.ptr->position + boss_collider.ptr->offset;
-        if ((beam_center - boss_center).length() < beam_radius + boss_collider.ptr->radius) {
-            /* First: check collision against shields (world positions) and process them */
-            for (auto shield_it = shield_world_query.begin(); shield_it != shield_world_query.end(); ++shield_it) {
-                auto [shield_transform, shield_collider, shield_health, shield_parent, _s] = *shield_it;
-                r::Vec3f shield_center = shield_transform.ptr->position + shield_collider.ptr->offset;
-                if ((beam_center - shield_center).length() < beam_radius + shield_collider.ptr->radius) {
-                    /* Beam hits shield: apply beam damage and destroy beam */
-                    shield_health.ptr->current -= beam_damage;
-                    entity_death_writer.send({beam_entity});
-                    if (shield_health.ptr->current <= 0) {
-                        entity_death_writer.send({shield_it.entity()});
-                    }
-                    return true; /* Beam destroyed upon hitting shield */
-                }
-            }
-
-            /* If any shields attached to this boss are still alive, the boss is invulnerable */
-            bool shields_alive = false;
-            for (auto shield_it = shield_world_query.begin(); shield_it != shield_world_query.end(); ++shield_it) {
-                auto [shield_transform_w, shield_collider_w, shield_health_w, shield_parent_w, _s] = *shield_it;
-                if (shield_health_w.ptr->current > 0) {
-                    shields_alive = true;
-                    break;
-                }
-            }
-
-            if (shields_alive) {
-                entity_death_writer.send({beam_entity});
-                return true; /* Beam destroyed upon hitting shields/boss area */
-            }
-
-            /* No shields: apply damage to boss */
-            health.ptr->current -= beam_damage;
-            entity_death_writer.send({beam_entity});
-
-            
-
-            if (health.ptr->current <= 0) {
-                entity_death_writer.send({boss_it.entity()});
-                boss_death_writer.send({});
-            }
-            return true; /* Beam destroyed upon hitting boss */
+        auto [boss_transform, boss_collider, health, compound, _boss] = *boss_it;
+        if (resolve_boss_hit(entity_death_writer, boss_death_writer, health_writer, beam_entity, sweep, beam_damage,
+                boss_it.entity(), boss_transform.ptr->position, *boss_collider.ptr, *health.ptr, compound.ptr, shield_world_query)) {
+            return true; /* Beam destroyed upon hitting the boss or its shields */
         }
     }
     return false; /* No boss collision */
 }
 
 static void handle_beam_collisions(r::ecs::EventWriter<EntityDiedEvent> &entity_death_writer,
-    r::ecs::EventWriter<BossDefeatedEvent> &boss_death_writer,
-    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Collider>, r::ecs::Ref<WaveCannonBeam>> &beam_query,
+    r::ecs::EventWriter<BossDefeatedEvent> &boss_death_writer, r::ecs::EventWriter<HealthChangedEvent> &health_writer, float dt,
+    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Collider>, r::ecs::Ref<Velocity>, r::ecs::Ref<WaveCannonBeam>,
+        r::ecs::Optional<r::ecs::Ref<CapsuleCollider>>> &beam_query,
     r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::With<Enemy>> &enemy_query,
-    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::With<Boss>> &boss_query,
+    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::Optional<r::ecs::Ref<CompoundCollider>>,
+        r::ecs::With<Boss>> &boss_query,
     r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::Ref<r::ecs::Parent>, r::ecs::With<Shield>> &shield_world_query)
 {
     for (auto beam_it = beam_query.begin(); beam_it != beam_query.end(); ++beam_it) {
-        auto [beam_transform, beam_collider, beam] = *beam_it;
+        auto [beam_transform, beam_collider, beam_velocity, beam, capsule] = *beam_it;
         r::Vec3f beam_center = beam_transform.ptr->position + beam_collider.ptr->offset;
+        const shapes::Sweep sweep = projectile_sweep(beam_center, beam_collider.ptr->radius, *beam_velocity.ptr, capsule.ptr, dt);
 
         /* Collision with enemies (penetrating) */
         for (auto enemy_it = enemy_query.begin(); enemy_it != enemy_query.end(); ++enemy_it) {
             auto [enemy_transform, enemy_collider, health, _e] = *enemy_it;
-            /* enemy_transform is global now so we correctly collide with child shields */
+            /* Shields are resolved through the boss path, not here */
             r::Vec3f enemy_center = enemy_transform.ptr->position + enemy_collider.ptr->offset;
-            if ((beam_center - enemy_center).length() < beam_collider.ptr->radius + enemy_collider.ptr->radius) {
+            if (shapes::sweep_vs_sphere(sweep, enemy_center, enemy_collider.ptr->radius)) {
                 /* Beam is powerful, for now it one-shots regular enemies */
                 entity_death_writer.send({enemy_it.entity()});
             }
         }
 
         /* Collision with boss (not penetrating) */
-        process_beam_boss_collision(entity_death_writer, boss_death_writer, beam_it.entity(), beam_center, beam_collider.ptr->radius,
-            beam.ptr->damage, boss_query, shield_world_query);
+        process_beam_boss_collision(entity_death_writer, boss_death_writer, health_writer, beam_it.entity(), sweep, beam.ptr->damage,
+            boss_query, shield_world_query);
     }
 }
 
@@ -298,27 +367,32 @@ static void handle_beam_collisions(r::ecs::EventWriter<EntityDiedEvent> &entity_
 /* Combat Systems */
 /* ================================================================================= */
 
-static void collision_system(r::ecs::EventWriter<EntityDiedEvent> entity_death_writer,
-    r::ecs::EventWriter<BossDefeatedEvent> boss_death_writer,
-    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Collider>, r::ecs::With<PlayerBullet>> &bullet_query,
-    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Collider>, r::ecs::Ref<WaveCannonBeam>> &beam_query,
+static void collision_system(r::ecs::Res<r::core::FrameTime> time, r::ecs::EventWriter<EntityDiedEvent> entity_death_writer,
+    r::ecs::EventWriter<BossDefeatedEvent> boss_death_writer, r::ecs::EventWriter<HealthChangedEvent> health_writer,
+    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Collider>, r::ecs::Ref<Velocity>, r::ecs::With<PlayerBullet>> &bullet_query,
+    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Collider>, r::ecs::Ref<Velocity>, r::ecs::Ref<WaveCannonBeam>,
+        r::ecs::Optional<r::ecs::Ref<CapsuleCollider>>> &beam_query,
     r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::With<Enemy>> &enemy_query,
-    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::With<Boss>> &boss_query,
-    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::Ref<r::ecs::Parent>, r::ecs::With<Shield>> &shield_world_query,
-    r::ecs::Query<r::ecs::Ref<r::ecs::Parent>, r::ecs::Mut<Health>, r::ecs::With<Shield>> &shield_query)
+    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::Optional<r::ecs::Ref<CompoundCollider>>,
+        r::ecs::With<Boss>> &boss_query,
+    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::Mut<Health>, r::ecs::Ref<r::ecs::Parent>, r::ecs::With<Shield>> &shield_world_query)
 {
-    handle_bullet_vs_enemy_collisions(entity_death_writer, bullet_query, enemy_query, shield_query);
-    handle_bullet_vs_boss_collisions(entity_death_writer, boss_death_writer, bullet_query, boss_query, shield_world_query);
-    handle_beam_collisions(entity_death_writer, boss_death_writer, beam_query, enemy_query, boss_query, shield_world_query);
+    const float dt = time.ptr->delta_time;
+
+    handle_bullet_vs_enemy_collisions(entity_death_writer, health_writer, dt, bullet_query, enemy_query);
+    handle_bullet_vs_boss_collisions(entity_death_writer, boss_death_writer, health_writer, dt, bullet_query, boss_query, shield_world_query);
+    handle_beam_collisions(entity_death_writer, boss_death_writer, health_writer, dt, beam_query, enemy_query, boss_query, shield_world_query);
 }
 
 static void player_collision_system(r::ecs::EventWriter<PlayerDiedEvent> death_writer,
     r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Collider>, r::ecs::With<Player>> player_query,
-    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Collider>, r::ecs::With<Enemy>> enemy_query)
+    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Collider>, r::ecs::With<Enemy>> enemy_query,
+    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::With<Shield>> shield_query)
 {
     for (auto [player_transform, player_collider, _p] : player_query) {
+        r::Vec3f player_center = player_transform.ptr->position + player_collider.ptr->offset;
+
         for (auto [enemy_transform, enemy_collider, _e] : enemy_query) {
-            r::Vec3f player_center = player_transform.ptr->position + player_collider.ptr->offset;
             r::Vec3f delta = player_center - (enemy_transform.ptr->position + enemy_collider.ptr->offset);
             float distance = delta.length();
 
@@ -328,21 +402,29 @@ static void player_collision_system(r::ecs::EventWriter<PlayerDiedEvent> death_w
                 return;
             }
         }
+        /* Shields are not Enemies anymore but still kill on contact */
+        for (auto [shield_transform, shield_collider, _s] : shield_query) {
+            if (shapes::sphere_vs_sphere(player_center, player_collider.ptr->radius, shield_transform.ptr->position + shield_collider.ptr->offset,
+                    shield_collider.ptr->radius)) {
+                death_writer.send({});
+                return;
+            }
+        }
     }
 }
 
-static void player_bullet_collision_system(r::ecs::EventWriter<PlayerDiedEvent> death_writer,
+static void player_bullet_collision_system(r::ecs::Res<r::core::FrameTime> time, r::ecs::EventWriter<PlayerDiedEvent> death_writer,
     r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Collider>, r::ecs::With<Player>> player_query,
-    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Collider>, r::ecs::With<EnemyBullet>> bullet_query)
+    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Collider>, r::ecs::Ref<Velocity>, r::ecs::With<EnemyBullet>> bullet_query)
 {
     for (auto [player_transform, player_collider, _p] : player_query) {
-        for (auto [bullet_transform, bullet_collider, _b] : bullet_query) {
+        for (auto [bullet_transform, bullet_collider, bullet_velocity, _b] : bullet_query) {
             r::Vec3f player_center = player_transform.ptr->position + player_collider.ptr->offset;
-            r::Vec3f delta = player_center - (bullet_transform.ptr->position + bullet_collider.ptr->offset);
-            float distance = delta.length();
+            r::Vec3f bullet_center = bullet_transform.ptr->position + bullet_collider.ptr->offset;
+            const shapes::Sweep sweep =
+                projectile_sweep(bullet_center, bullet_collider.ptr->radius, *bullet_velocity.ptr, nullptr, time.ptr->delta_time);
 
-            float sum_radii = player_collider.ptr->radius + bullet_collider.ptr->radius;
-            if (distance < sum_radii) {
+            if (shapes::sweep_vs_sphere(sweep, player_center, player_collider.ptr->radius)) {
                 death_writer.send({});
                 return;
             }
@@ -350,9 +432,10 @@ static void player_bullet_collision_system(r::ecs::EventWriter<PlayerDiedEvent>
     }
 }
 
-static void force_bullet_collision_system(r::ecs::EventWriter<EntityDiedEvent> entity_death_writer,
+static void force_bullet_collision_system(r::ecs::Res<r::core::FrameTime> time, r::ecs::EventWriter<EntityDiedEvent> entity_death_writer,
     r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<Collider>, r::ecs::With<Force>> force_query,
-    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Collider>, r::ecs::With<EnemyBullet>, r::ecs::Without<Unblockable>> bullet_query)
+    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Collider>, r::ecs::Ref<Velocity>, r::ecs::With<EnemyBullet>, r::ecs::Without<Unblockable>>
+        bullet_query)
 {
     if (force_query.size() == 0 || bullet_query.size() == 0) {
         return;
@@ -361,14 +444,14 @@ static void force_bullet_collision_system(r::ecs::EventWriter<EntityDiedEvent> e
     auto [force_transform, force_collider, _] = *force_query.begin();
 
     for (auto bullet_it = bullet_query.begin(); bullet_it != bullet_query.end(); ++bullet_it) {
-        auto [bullet_transform, bullet_collider, __, ___] = *bullet_it;
+        auto [bullet_transform, bullet_collider, bullet_velocity, __, ___] = *bullet_it;
 
         r::Vec3f force_center = force_transform.ptr->position + force_collider.ptr->offset;
         r::Vec3f bullet_center = bullet_transform.ptr->position + bullet_collider.ptr->offset;
-        float distance = (force_center - bullet_center).length();
-        float radii_sum = force_collider.ptr->radius + bullet_collider.ptr->radius;
+        const shapes::Sweep sweep =
+            projectile_sweep(bullet_center, bullet_collider.ptr->radius, *bullet_velocity.ptr, nullptr, time.ptr->delta_time);
 
-        if (distance < radii_sum) {
+        if (shapes::sweep_vs_sphere(sweep, force_center, force_collider.ptr->radius)) {
             entity_death_writer.send({bullet_it.entity()});
         }
     }
@@ -398,50 +481,63 @@ static void force_enemy_collision_system(r::ecs::EventWriter<EntityDiedEvent> en
     }
 }
 
-static void despawn_offscreen_system(r::ecs::Commands &commands,
+/**
+ * @brief Despawns anything that left the play area, releasing it from the arena that tracks it.
+ * @details Scenery drifting that far is despawned too; it belongs to the SceneryArena, which the
+ * headless server does not have.
+ */
+static void despawn_offscreen_system(r::ecs::Commands &commands, r::ecs::ResMut<BattleArena> arena, r::ecs::ResMut<SceneryArena> scenery,
     r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Without<Player>, r::ecs::Without<Boss>, r::ecs::Without<Force>> query)
 {
     const float despawn_boundary_x = 100.0f;
     for (auto it = query.begin(); it != query.end(); ++it) {
         auto [transform, _, __, ___] = *it;
         if (std::abs(transform.ptr->position.x) > despawn_boundary_x) {
+            arena.ptr->release(it.entity());
+            if (scenery.ptr) {
+                scenery.ptr->release(it.entity());
+            }
             commands.despawn(it.entity());
         }
     }
 }
 
-static void timed_despawn_system(r::ecs::Commands &commands, r::ecs::Res<r::core::FrameTime> time,
+static void timed_despawn_system(r::ecs::Commands &commands, r::ecs::Res<r::core::FrameTime> time, r::ecs::ResMut<BattleArena> arena,
     r::ecs::Query<r::ecs::Mut<TimedDespawn>> query)
 {
     for (auto it = query.begin(); it != query.end(); ++it) {
         auto [despawn_timer] = *it;
         despawn_timer.ptr->timer -= time.ptr->delta_time;
         if (despawn_timer.ptr->timer <= 0.0f) {
+            arena.ptr->release(it.entity());
             commands.despawn(it.entity());
         }
     }
 }
 
-template<typename T>
-static void despawn_all_entities_with(r::ecs::Commands &commands, r::ecs::Query<r::ecs::With<T>> &query)
+/**
+ * @brief Releases every battle entity of the previous level in one pass over the BattleArena.
+ * @details Enemies, bosses (and their child shields) and projectiles are all tracked by the arena,
+ * so no per-type query is needed. Players and their Force are not spawned through the arena
+ * (at most one per client) and are despawned explicitly.
+ */
+static void cleanup_battle_system(r::ecs::Commands &commands, r::ecs::ResMut<BattleArena> arena, r::ecs::Res<CurrentLevel> current_level,
+    r::ecs::Res<GameLevels> game_levels, r::ecs::Query<r::ecs::With<Player>> player_query, r::ecs::Query<r::ecs::With<Force>> force_query)
 {
-    for (auto it = query.begin(); it != query.end(); ++it) {
+    for (const r::ecs::Entity entity : *arena.ptr) {
+        commands.despawn(entity);
+    }
+    arena.ptr->clear();
+
+    for (auto it = player_query.begin(); it != player_query.end(); ++it) {
+        commands.despawn(it.entity());
+    }
+    for (auto it = force_query.begin(); it != force_query.end(); ++it) {
         commands.despawn(it.entity());
     }
-}
 
-static void cleanup_battle_system(r::ecs::Commands &commands, r::ecs::Query<r::ecs::With<Enemy>> enemy_query,
-    r::ecs::Query<r::ecs::With<PlayerBullet>> player_bullet_query, r::ecs::Query<r::ecs::With<EnemyBullet>> enemy_bullet_query,
-    r::ecs::Query<r::ecs::With<WaveCannonBeam>> wave_cannon_query, r::ecs::Query<r::ecs::With<Player>> player_query,
-    r::ecs::Query<r::ecs::With<Force>> force_query, r::ecs::Query<r::ecs::With<Boss>> boss_query)
-{
-    despawn_all_entities_with<Enemy>(commands, enemy_query);
-    despawn_all_entities_with<PlayerBullet>(commands, player_bullet_query);
-    despawn_all_entities_with<EnemyBullet>(commands, enemy_bullet_query);
-    despawn_all_entities_with<WaveCannonBeam>(commands, wave_cannon_query);
-    despawn_all_entities_with<Player>(commands, player_query);
-    despawn_all_entities_with<Force>(commands, force_query);
-    despawn_all_entities_with<Boss>(commands, boss_query);
+    const auto &level_data = game_levels.ptr->levels[static_cast<size_t>(current_level.ptr->index)];
+    arena.ptr->reserve(level_data.capacity.battle_entities);
 }
 
 static void reset_level_progress_system(r::ecs::ResMut<CurrentLevel> current_level)
@@ -453,6 +549,7 @@ static void reset_level_progress_system(r::ecs::ResMut<CurrentLevel> current_lev
 void CombatPlugin::build(r::Application &app)
 {
     app.insert_resource(ExplosionSfxResource{})
+        .insert_resource(BattleArena{})
     .add_systems<reset_level_progress_system>(r::OnTransition{GameState::MainMenu, GameState::EnemiesBattle})
         .add_systems<reset_level_progress_system>(r::OnTransition{GameState::GameOver, GameState::EnemiesBattle})
         .add_systems<reset_level_progress_system>(r::OnTransition{GameState::YouWin, GameState::EnemiesBattle})
@@ -474,6 +571,5 @@ void CombatPlugin::build(r::Application &app)
         /* The collision systems now only send events */
         .add_systems<collision_system, player_collision_system, player_bullet_collision_system, force_bullet_collision_system,
             force_enemy_collision_system>(r::Schedule::UPDATE)
-        .run_if<r::run_conditions::in_state<GameState::EnemiesBattle>>()
-        .run_or<r::run_conditions::in_state<GameState::BossBattle>>();
+        .run_if<run_conditions::in_scope<GameScope::Battle>>();
 }
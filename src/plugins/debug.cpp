@@ -2,14 +2,21 @@
 #include "R-Engine/Components/Transform3d.hpp"
 #include <R-Engine/Application.hpp>
 #include <R-Engine/Core/Backend.hpp>
+#include <R-Engine/Core/Logger.hpp>
 #include <R-Engine/ECS/Event.hpp>
 #include <R-Engine/ECS/Query.hpp>
 #include <R-Engine/ECS/RunConditions.hpp>
 #include <R-Engine/Plugins/InputPlugin.hpp>
 
 #include <components/common.hpp>
+#include <core/alloc_counter.hpp>
 #include <events/debug.hpp>
+#include <resources/ecs_stats.hpp>
+#include <resources/frame_memory.hpp>
 #include <state/game_state.hpp>
+#include <state/run_conditions.hpp>
+
+#include <string>
 
 /* ================================================================================= */
 /* Debug Systems */
@@ -46,13 +53,52 @@ static void debug_level_switch_system(r::ecs::Res<r::UserInput> user_input, r::e
     }
 }
 
+/**
+ * @brief Logs how many run conditions the scheduler evaluated per frame since the last F5.
+ * @details Runs in every state, so the menu overhead is measured as well as the battle one.
+ * Counting needs an R_TYPE_DEBUG build.
+ */
+static void debug_scheduler_stats_system(r::ecs::Res<r::UserInput> user_input, r::ecs::ResMut<SchedulerStats> stats)
+{
+    ++stats.ptr->frames;
+    if (!user_input.ptr->isKeyPressed(KEY_F5)) {
+        return;
+    }
+    const std::uint64_t evaluations = run_conditions::condition_evaluations() - stats.ptr->evaluations_baseline;
+    r::Logger::info("Run conditions: " + std::to_string(evaluations) + " evaluated over " + std::to_string(stats.ptr->frames)
+        + " frames");
+    stats.ptr->frames = 0;
+    stats.ptr->evaluations_baseline = run_conditions::condition_evaluations();
+}
+
+/**
+ * @brief Logs the global allocations per frame since the last F6, and what overflowed the frame arena.
+ * @details The game's own systems keep their steady-state scratch in the frame arena, so what remains is
+ * mostly the engine's (event queues, command buffers). Counting needs an R_TYPE_DEBUG build.
+ */
+static void debug_allocation_stats_system(r::ecs::Res<r::UserInput> user_input, r::ecs::ResMut<FrameMemory> memory,
+    r::ecs::ResMut<AllocationStats> stats)
+{
+    ++stats.ptr->frames;
+    if (!user_input.ptr->isKeyPressed(KEY_F6)) {
+        return;
+    }
+    const std::uint64_t allocations = global_allocations() - stats.ptr->allocations_baseline;
+    r::Logger::info("Global allocations: " + std::to_string(allocations) + " over " + std::to_string(stats.ptr->frames)
+        + " frames, frame arena overflow this frame: " + std::to_string(memory.ptr->overflow_bytes()) + " bytes");
+    stats.ptr->frames = 0;
+    stats.ptr->allocations_baseline = global_allocations();
+}
+
 void DebugPlugin::build(r::Application &app)
 {
+    app.insert_resource(SchedulerStats{})
+        .insert_resource(AllocationStats{})
+        .add_systems<debug_scheduler_stats_system, debug_allocation_stats_system>(r::Schedule::UPDATE);
+
     app.add_systems<debug_draw_colliders_system>(r::Schedule::RENDER_3D)
-        .run_if<r::run_conditions::in_state<GameState::EnemiesBattle>>()
-        .run_or<r::run_conditions::in_state<GameState::BossBattle>>();
+        .run_if<run_conditions::in_scope<GameScope::Battle>>();
 
     app.add_systems<debug_level_switch_system>(r::Schedule::UPDATE)
-        .run_if<r::run_conditions::in_state<GameState::EnemiesBattle>>()
-        .run_or<r::run_conditions::in_state<GameState::BossBattle>>();
+        .run_if<run_conditions::in_scope<GameScope::Battle>>();
 }
@@ -5,18 +5,33 @@
 #include <R-Engine/Core/FrameTime.hpp>
 #include <R-Engine/Core/Logger.hpp>
 #include <R-Engine/ECS/Command.hpp>
+#include <R-Engine/ECS/Event.hpp>
 #include <R-Engine/ECS/Query.hpp>
 #include <R-Engine/ECS/RunConditions.hpp>
 #include <R-Engine/Plugins/MeshPlugin.hpp>
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <utility>
+#include <vector>
 
 #include <components/common.hpp>
 #include <components/enemy.hpp>
 #include <components/player.hpp>
 #include <components/projectiles.hpp>
+#include <core/job_pool.hpp>
+#include <events/game_events.hpp>
 #include <resources/assets.hpp>
+#include <resources/frame_memory.hpp>
 #include <resources/level.hpp>
+#include <resources/level_arena.hpp>
+#include <resources/level_paths.hpp>
+#include <resources/scripts.hpp>
+#include <resources/targeting.hpp>
 #include <state/game_state.hpp>
 #include <state/run_conditions.hpp>
 
@@ -30,20 +45,221 @@ static constexpr float BOSS_VERTICAL_SPEED = 4.5f;
 static constexpr float BOSS_HOMING_MOVE_SPEED = 3.0f;
 static constexpr float BOSS_UPPER_BOUND = 4.0f;
 static constexpr float BOSS_LOWER_BOUND = -15.0f;
+static constexpr int SHIELDED_BOSS_LEVEL_INDEX = 1;
+static constexpr float HOMING_BOSS_BATTLE_X = 8.0f;
+static constexpr float HOMING_BOSS_VERTICAL_BOUND = 4.0f;
+static constexpr float HOMING_BOSS_REPOSITION_TIMEOUT = 3.0f;
+static constexpr float HOMING_BOSS_ATTACK_DURATION = 4.0f;
+static constexpr float HOMING_BOSS_EXPOSED_ATTACK_DURATION = 6.0f;
+static constexpr float HOMING_BOSS_EXPOSED_SPEED_FACTOR = 1.5f;
+static constexpr float HOMING_BOSS_FIRE_RATE = 1.5f;
+static constexpr float HOMING_BOSS_ENRAGED_FIRE_RATE = 0.8f;
+static constexpr std::uint64_t RETARGET_INTERVAL_TICKS = 8; /* Homing entities pick the nearest player this often */
+static constexpr float SHIELDED_BOSS_BOUND_RADIUS = 10.0f;
+
+static const r::Color BOSS_BASE_COLOR = {255, 255, 255, 255};
+static const r::Color BOSS_SHIELDED_TINT = {100, 180, 255, 255}; /* Light blue while shields are up */
+
+/* ================================================================================= */
+/* Boss Scripts */
+/* ================================================================================= */
+
+struct BossView {
+        r::Transform3d *transform;
+        Velocity *velocity;
+        HomingAttackBoss *behavior;
+        const BossPhase *phase;
+};
+
+/**
+ * @brief Looks the scripted boss up in the runner's query. Only valid until the next co_await.
+ */
+static std::optional<BossView> find_boss(const ScriptWorld &world, r::ecs::Entity boss)
+{
+    for (auto it = world.bosses->begin(); it != world.bosses->end(); ++it) {
+        if (it.entity() == boss) {
+            auto [transform, velocity, behavior, phase] = *it;
+            return BossView{transform.ptr, velocity.ptr, behavior.ptr, phase.ptr};
+        }
+    }
+    return std::nullopt; /* Despawned */
+}
+
+static void spawn_homing_missile(const ScriptWorld &world, const r::Vec3f &position)
+{
+    auto missile = world.commands->spawn(EnemyBullet{}, HomingEnemy{1.8f}, TimedDespawn{4.0f},
+        r::Transform3d{
+            .position = position,
+            .scale = {0.7f, 0.7f, 0.7f},
+        },
+        Velocity{
+            {-HOMING_MISSILE_SPEED, 0.0f, 0.0f},
+        },
+        Collider{
+            .radius = 0.5f,
+        },
+        r::Mesh3d{
+            .id = world.boss_bullets->small_missile,
+            .color = r::Color{255, 255, 255, 255},
+            .rotation_offset = {(static_cast<float>(M_PI) / 2.0f), 0.0f, -static_cast<float>(M_PI) / 2.0f},
+        });
+    world.arena->track(missile.id());
+}
+
+SCRIPTS_BEGIN
+
+/**
+ * @brief Level 2 boss: fly in, then alternate between moving to a random height and firing homing missiles.
+ * @details Each leg is a single timed wait (travel time = distance / speed), so the boss costs
+ * nothing between two decisions. Missile cadence carries over between attack phases.
+ */
+static Script homing_attack_boss_script(std::shared_ptr<ScriptWorld> world, r::ecs::Entity boss, float entry_seconds)
+{
+    co_await WaitSeconds{entry_seconds};
+
+    std::optional<BossView> view = find_boss(*world, boss);
+    if (!view) {
+        co_return;
+    }
+    view->transform->position.x = HOMING_BOSS_BATTLE_X;
+    view->velocity->value = {0.0f, 0.0f, 0.0f};
+
+    float shot_timer = BossShootTimer{}.time_left;
+    while (true) {
+        /* Repositioning */
+        view->behavior->current_state = HomingAttackBoss::State::Repositioning;
+        const float target_y =
+            (static_cast<float>(rand()) / static_cast<float>(RAND_MAX)) * (HOMING_BOSS_VERTICAL_BOUND * 2.0f) - HOMING_BOSS_VERTICAL_BOUND;
+        const r::Vec3f direction = r::Vec3f{HOMING_BOSS_BATTLE_X, target_y, 0.0f} - view->transform->position;
+        const float distance = direction.length();
+        const float speed = BOSS_HOMING_MOVE_SPEED * (view->behavior->exposed ? HOMING_BOSS_EXPOSED_SPEED_FACTOR : 1.0f);
+
+        if (distance > 0.1f) {
+            view->velocity->value = direction.normalize() * speed;
+            co_await WaitSeconds{std::min(distance / speed, HOMING_BOSS_REPOSITION_TIMEOUT)};
+            if (!(view = find_boss(*world, boss))) {
+                co_return;
+            }
+            view->velocity->value = {0.0f, 0.0f, 0.0f};
+        }
+
+        /* Attacking */
+        view->behavior->current_state = HomingAttackBoss::State::Attacking;
+        float attack_left = view->behavior->exposed ? HOMING_BOSS_EXPOSED_ATTACK_DURATION : HOMING_BOSS_ATTACK_DURATION;
+        while (attack_left > 0.0f) {
+            const float step = std::min(shot_timer, attack_left);
+            co_await WaitSeconds{step};
+            if (!(view = find_boss(*world, boss))) {
+                co_return;
+            }
+            attack_left -= step;
+            shot_timer -= step;
+            if (shot_timer <= 0.0f) {
+                spawn_homing_missile(*world, view->transform->position);
+                shot_timer = view->phase->enraged ? HOMING_BOSS_ENRAGED_FIRE_RATE : HOMING_BOSS_FIRE_RATE;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Switches a shielded boss to its exposed phase once every shield is destroyed.
+ */
+static Script boss_shields_down_script(std::shared_ptr<ScriptWorld> world, r::ecs::Entity boss)
+{
+    co_await WaitSignal{SIGNAL_SHIELDS_DOWN};
+
+    if (std::optional<BossView> view = find_boss(*world, boss)) {
+        view->behavior->exposed = true;
+        r::Logger::info("Boss shields down: switching to exposed phase.");
+    }
+}
+
+SCRIPTS_END
 
 /* ================================================================================= */
 /* Enemy Spawning */
 /* ================================================================================= */
 
-static void enemy_spawner_system(r::ecs::Commands &commands, r::ecs::ResMut<EnemySpawnTimer> spawn_timer,
-    r::ecs::Res<r::core::FrameTime> time, r::ecs::ResMut<r::Meshes> meshes, r::ecs::Res<CurrentLevel> current_level,
-    r::ecs::Res<GameLevels> game_levels)
+/**
+ * @brief Spawns one formation member `distance` along its path.
+ * @details Path followers carry no Velocity: their position comes straight from the baked path.
+ */
+static void spawn_path_follower(r::ecs::Commands &commands, BattleArena &arena, const FormationQueue::Pending &formation,
+    const SplinePath &path, float distance)
+{
+    auto enemy = commands.spawn(Enemy{}, Health{formation.health, formation.health}, ScoreValue{formation.score_value},
+        r::Transform3d{
+            .position = path.sample(distance),
+            .scale = {1.0f, 1.0f, 1.0f},
+        },
+        Collider{0.5f},
+        r::Mesh3d{
+            .id = formation.mesh,
+            .color = r::Color{255, 255, 255, 255},
+            .rotation_offset = {0.0f, -(static_cast<float>(M_PI) / 2.0f), 0.0f},
+        },
+        PathFollower{
+            .path = formation.path,
+            .distance = distance,
+            .speed = formation.speed,
+        });
+    arena.track(enemy.id());
+}
+
+/**
+ * @brief Spawns the leader of a `formation_size` formation and queues the others, `formation_spacing` seconds apart.
+ */
+static void spawn_formation(r::ecs::Commands &commands, BattleArena &arena, FormationQueue &queue, const EnemyData &data,
+    r::MeshHandle mesh, const SplinePath &path, std::size_t path_index)
 {
-    spawn_timer.ptr->time_left -= time.ptr->delta_time;
-    if (spawn_timer.ptr->time_left <= 0.0f) {
-        const auto &level_data = game_levels.ptr->levels[static_cast<size_t>(current_level.ptr->index)];
-        spawn_timer.ptr->time_left = level_data.enemy_spawn_interval;
+    const FormationQueue::Pending formation{
+        .path = path_index,
+        .mesh = mesh,
+        .health = data.health,
+        .score_value = data.score_value,
+        .speed = data.speed,
+        .spacing = data.formation_spacing,
+        .wait = data.formation_spacing,
+        .remaining = data.formation_size - 1,
+    };
+    spawn_path_follower(commands, arena, formation, path, 0.0f);
+    if (formation.remaining > 0) {
+        queue.pending.push_back(formation);
+    }
+}
 
+/**
+ * @brief Spawns the queued formation members whose turn came, as far along the path as they would be by now.
+ */
+static void formation_release_system(r::ecs::Commands &commands, r::ecs::Res<r::core::FrameTime> time, r::ecs::Res<LevelPaths> paths,
+    r::ecs::ResMut<BattleArena> arena, r::ecs::ResMut<FormationQueue> queue)
+{
+    const float dt = time.ptr->delta_time;
+    for (FormationQueue::Pending &formation : queue.ptr->pending) {
+        formation.wait -= dt;
+        while (formation.remaining > 0 && formation.wait <= 0.0f) {
+            if (formation.path < paths.ptr->paths.size()) {
+                spawn_path_follower(commands, *arena.ptr, formation, paths.ptr->paths[formation.path], -formation.wait * formation.speed);
+            }
+            formation.wait += formation.spacing;
+            --formation.remaining;
+        }
+    }
+    std::erase_if(queue.ptr->pending, [](const FormationQueue::Pending &formation) { return formation.remaining <= 0; });
+}
+
+/**
+ * @brief Spawns one random enemy of the current level per EnemySpawnRequestEvent.
+ * @details The cadence is owned by the level timeline script (GameplayPlugin).
+ */
+static void enemy_spawner_system(r::ecs::Commands &commands, r::ecs::EventReader<EnemySpawnRequestEvent> reader,
+    r::ecs::ResMut<r::Meshes> meshes, r::ecs::Res<CurrentLevel> current_level, r::ecs::Res<GameLevels> game_levels,
+    r::ecs::ResMut<BattleArena> arena, r::ecs::Res<LevelPaths> paths,
+    r::ecs::ResMut<FormationQueue> formations)
+{
+    const auto &level_data = game_levels.ptr->levels[static_cast<size_t>(current_level.ptr->index)];
+    for ([[maybe_unused]] const auto &request : reader) {
         if (level_data.enemy_types.empty()) {
             r::Logger::warn("No enemy types defined for the current level!");
             return;
@@ -54,39 +270,53 @@ static void enemy_spawner_system(r::ecs::Commands &commands, r::ecs::ResMut<Enem
 
         float random_y = (static_cast<float>(rand()) / static_cast<float>(RAND_MAX)) * 10.0f - 5.0f;
 
-        r::MeshHandle enemy_mesh_handle = meshes.ptr->add(enemy_to_spawn.model_path);
-        if (enemy_mesh_handle != r::MeshInvalidHandle) {
-            auto enemy_cmds =
-                commands.spawn(Enemy{}, Health{enemy_to_spawn.health, enemy_to_spawn.health}, ScoreValue{enemy_to_spawn.score_value},
-                    r::Transform3d{
-                        .position = {15.0f, random_y, 0.0f},
-                        .scale = {1.0f, 1.0f, 1.0f},
-                    },
-                    Velocity{
-                        {-enemy_to_spawn.speed, 0.0f, 0.0f},
-                    },
-                    Collider{0.5f},
-                    r::Mesh3d{
-                        .id = enemy_mesh_handle,
-                        .color = r::Color{255, 255, 255, 255},
-                        .rotation_offset = {0.0f, -(static_cast<float>(M_PI) / 2.0f), 0.0f},
-                    });
+        r::MeshHandle enemy_mesh_handle = r::MeshInvalidHandle;
+        if (queue_mesh(meshes.ptr, enemy_to_spawn.model_path, enemy_mesh_handle)) {
+            if (enemy_to_spawn.behavior == EnemyBehaviorType::SplinePath && enemy_to_spawn.path_index < paths.ptr->paths.size()) {
+                spawn_formation(commands, *arena.ptr, *formations.ptr, enemy_to_spawn, enemy_mesh_handle,
+                    paths.ptr->paths[enemy_to_spawn.path_index], enemy_to_spawn.path_index);
+                continue;
+            }
 
-            /* Add the correct behavior component based on level data */
+            /* The behavior component is part of the spawn bundle so the enemy is created in its final archetype */
+            const auto spawn_enemy = [&](auto... behavior) {
+                return commands
+                    .spawn(Enemy{}, Health{enemy_to_spawn.health, enemy_to_spawn.health}, ScoreValue{enemy_to_spawn.score_value},
+                        r::Transform3d{
+                            .position = {15.0f, random_y, 0.0f},
+                            .scale = {1.0f, 1.0f, 1.0f},
+                        },
+                        Velocity{
+                            {-enemy_to_spawn.speed, 0.0f, 0.0f},
+                        },
+                        Collider{0.5f},
+                        r::Mesh3d{
+                            .id = enemy_mesh_handle,
+                            .color = r::Color{255, 255, 255, 255},
+                            .rotation_offset = {0.0f, -(static_cast<float>(M_PI) / 2.0f), 0.0f},
+                        },
+                        behavior...)
+                    .id();
+            };
+
+            r::ecs::Entity enemy = r::ecs::NULL_ENTITY;
             switch (enemy_to_spawn.behavior) {
-                case EnemyBehaviorType::Straight:
-                    /* Default behavior, no component needed */
-                    break;
                 case EnemyBehaviorType::SineWave:
-                    enemy_cmds.insert(SineWaveEnemy{});
+                    enemy = spawn_enemy(SineWaveEnemy{});
                     break;
                 case EnemyBehaviorType::Homing:
-                    enemy_cmds.insert(HomingEnemy{});
+                    enemy = spawn_enemy(HomingEnemy{});
                     break;
+                case EnemyBehaviorType::SplinePath:
+                    r::Logger::warn("Enemy path " + std::to_string(enemy_to_spawn.path_index) + " is not defined, spawning it as Straight.");
+                    [[fallthrough]];
+                case EnemyBehaviorType::Straight:
                 default:
-                    /* Safely do nothing for unhandled cases */
+                    /* Default behavior, no component needed */
+                    enemy = spawn_enemy();
                     break;
             }
+            arena.ptr->track(enemy);
 
         } else {
             r::Logger::error("Failed to queue enemy model for loading: " + enemy_to_spawn.model_path);
@@ -95,19 +325,21 @@ static void enemy_spawner_system(r::ecs::Commands &commands, r::ecs::ResMut<Enem
 }
 
 static void boss_spawn_system(r::ecs::Commands &commands, r::ecs::ResMut<r::Meshes> meshes, r::ecs::Res<CurrentLevel> current_level,
-    r::ecs::Res<GameLevels> game_levels)
+    r::ecs::Res<GameLevels> game_levels, r::ecs::ResMut<BattleArena> arena,
+    r::ecs::ResMut<ScriptRunner> scripts)
 {
     const auto &level_data = game_levels.ptr->levels[static_cast<size_t>(current_level.ptr->index)];
     const auto &boss_data = level_data.boss_data;
 
     r::Logger::info("Spawning boss for Level " + std::to_string(current_level.ptr->index + 1));
 
-    r::MeshHandle boss_mesh_handle = meshes.ptr->add(boss_data.model_path);
-    if (boss_mesh_handle != r::MeshInvalidHandle) {
+    r::MeshHandle boss_mesh_handle = r::MeshInvalidHandle;
+    if (queue_mesh(meshes.ptr, boss_data.model_path, boss_mesh_handle)) {
         /* Prepare component variables that differ between boss types */
         r::Transform3d initial_transform;
         Velocity initial_velocity;
-        Collider initial_collider;
+        Collider initial_collider; /* Bounding sphere of the compound collider */
+        CompoundCollider hit_zones;
 
         /* Set values based on the boss's behavior type */
         switch (boss_data.behavior) {
@@ -123,6 +355,16 @@ static void boss_spawn_system(r::ecs::Commands &commands, r::ecs::ResMut<r::Mesh
                     .radius = 5.5f,
                     .offset = {-2.5f, 4.0f, 0.0f},
                 };
+                /* Dobkeratops layout: exposed abdomen, armored tail, body */
+                hit_zones.parts = {
+                    {.shape = ColliderPart::Shape::Sphere, .role = HitRole::WeakPoint, .offset = {-5.0f, 3.0f, 0.0f}, .radius = 1.2f},
+                    {.shape = ColliderPart::Shape::Capsule,
+                        .role = HitRole::Armor,
+                        .offset = {0.0f, 0.5f, 0.0f},
+                        .extent = {0.0f, 7.0f, 0.0f},
+                        .radius = 0.8f},
+                    {.shape = ColliderPart::Shape::Sphere, .role = HitRole::Hull, .offset = {-2.5f, 4.0f, 0.0f}, .radius = 3.5f},
+                };
                 break;
             case BossBehaviorType::HomingAttack:
             default: /* Default to HomingAttack behavior if unknown */
@@ -137,32 +379,75 @@ static void boss_spawn_system(r::ecs::Commands &commands, r::ecs::ResMut<r::Mesh
                     .radius = 2.0f,
                     .offset = {0.0f, 0.0f, 0.0f},
                 };
+                hit_zones.parts = {
+                    {.shape = ColliderPart::Shape::Sphere, .role = HitRole::Hull, .offset = {0.0f, 0.0f, 0.0f}, .radius = 2.0f},
+                };
                 break;
         }
 
-        /* Spawn the boss with the right components */
-        auto boss_cmds = commands.spawn(Boss{}, BossShootTimer{}, ScoreValue{boss_data.score_value},
-            Health{
-                boss_data.max_health,
-                boss_data.max_health,
-            },
-            initial_transform, initial_velocity, initial_collider,
-            r::Mesh3d{
-                .id = boss_mesh_handle,
-                .color = r::Color{255, 255, 255, 255},
-                .rotation_offset = {0.0f, -(static_cast<float>(M_PI) / 2.0f), 0.0f},
-            });
+        /* Shielded bosses start tinted: boss_shield_color_system only runs once a Health changes */
+        const bool shielded = current_level.ptr->index == SHIELDED_BOSS_LEVEL_INDEX;
+        if (shielded) {
+            /* Shield children are only tested after a bound hit, so the bound has to reach them */
+            initial_collider = {
+                .radius = SHIELDED_BOSS_BOUND_RADIUS,
+                .offset = {-4.0f, 0.0f, 0.0f},
+            };
+        }
+
+        /* Spawn the boss with the right components, behavior tag included so it never migrates after spawn */
+        const auto spawn_boss = [&](auto behavior) {
+            return commands.spawn(Boss{}, BossShootTimer{}, BossPhase{}, ScoreValue{boss_data.score_value},
+                Health{
+                    boss_data.max_health,
+                    boss_data.max_health,
+                },
+                initial_transform, initial_velocity, initial_collider, hit_zones,
+                r::Mesh3d{
+                    .id = boss_mesh_handle,
+                    .color = shielded ? BOSS_SHIELDED_TINT : BOSS_BASE_COLOR,
+                    .rotation_offset = {0.0f, -(static_cast<float>(M_PI) / 2.0f), 0.0f},
+                },
+                behavior);
+        };
+        auto boss_cmds = [&] {
+            switch (boss_data.behavior) {
+                case BossBehaviorType::VerticalPatrol:
+                    return spawn_boss(VerticalPatrolBoss{});
+                case BossBehaviorType::Turret:
+                    return spawn_boss(TurretBoss{});
+                case BossBehaviorType::HomingAttack:
+                    return spawn_boss(HomingAttackBoss{});
+                default:
+                    r::Logger::warn("Unknown or unsupported boss behavior type, defaulting to HomingAttack.");
+                    return spawn_boss(HomingAttackBoss{});
+            }
+        }();
+
+        /* Shields are children of the boss: they are released together with it. */
+        const r::ecs::Entity boss = boss_cmds.id();
+        arena.ptr->track(boss);
+
+        /* Scripts are cancelled by GameplayPlugin when their boss dies */
+        if (boss_data.behavior != BossBehaviorType::VerticalPatrol && boss_data.behavior != BossBehaviorType::Turret) {
+            const float entry_seconds = (initial_transform.position.x - HOMING_BOSS_BATTLE_X) / BOSS_HOMING_MOVE_SPEED;
+            scripts.ptr->scheduler.start(homing_attack_boss_script(scripts.ptr->world, boss, entry_seconds), boss);
+            if (shielded) {
+                scripts.ptr->scheduler.start(boss_shields_down_script(scripts.ptr->world, boss), boss);
+            }
+        }
 
         /* If this is Level 2 (index == 1), spawn the shield as a small, destructible unit in front of the boss */
-        if (current_level.ptr->index == 1) {
-        r::MeshHandle shield_handle = meshes.ptr->add("assets/models/Shield.glb");
-            if (shield_handle != r::MeshInvalidHandle) {
+        if (shielded) {
+        r::MeshHandle shield_handle = r::MeshInvalidHandle;
+            if (queue_mesh(meshes.ptr, "assets/models/Shield.glb", shield_handle)) {
                 /* Spawn as a child so it follows the boss, but place it in front and much smaller.
-                   Make it an Enemy with its own Health/Collider so the player must destroy it first. */
+                   Shields have their own Health/Collider so the player must destroy them first. They are not
+                   Enemies: combat only tests them once a projectile is inside the boss's bounding sphere. */
                 boss_cmds.with_children([&](r::ecs::ChildBuilder &child) {
                     /* Center/front shield */
                     child.spawn(
-                        Enemy{}, Shield{}, /* treat shield as an enemy unit to be targetable */
+                        Shield{},
                         Health{350, 350},
                         ScoreValue{100},
                         r::Transform3d{
@@ -175,7 +460,7 @@ static void boss_spawn_system(r::ecs::Commands &commands, r::ecs::ResMut<r::Mesh
 
                     /* Top/front shield */
                     child.spawn(
-                        Enemy{}, Shield{},
+                        Shield{},
                         Health{350, 350},
                         ScoreValue{100},
                         r::Transform3d{
@@ -187,7 +472,7 @@ static void boss_spawn_system(r::ecs::Commands &commands, r::ecs::ResMut<r::Mesh
 
                     /* Bottom/front shield */
                     child.spawn(
-                        Enemy{}, Shield{},
+                        Shield{},
                         Health{350, 350},
                         ScoreValue{100},
                         r::Transform3d{
@@ -201,24 +486,6 @@ static void boss_spawn_system(r::ecs::Commands &commands, r::ecs::ResMut<r::Mesh
                 r::Logger::error("Failed to queue shield model for loading: assets/models/Shield.glb");
             }
         }
-
-        /* Add the behavior "tag" component after spawning */
-        switch (boss_data.behavior) {
-            case BossBehaviorType::VerticalPatrol:
-                boss_cmds.insert(VerticalPatrolBoss{});
-                break;
-            case BossBehaviorType::HomingAttack:
-                boss_cmds.insert(HomingAttackBoss{});
-                break;
-            case BossBehaviorType::Turret:
-                boss_cmds.insert(TurretBoss{});
-                break;
-            default:
-                r::Logger::warn("Unknown or unsupported boss behavior type, defaulting to HomingAttack.");
-                boss_cmds.insert(HomingAttackBoss{});
-                break;
-        }
-
     } else {
         r::Logger::error("Failed to queue boss model for loading: " + boss_data.model_path);
     }
@@ -228,53 +495,192 @@ static void boss_spawn_system(r::ecs::Commands &commands, r::ecs::ResMut<r::Mesh
 /* Enemy Behavior Systems */
 /* ================================================================================= */
 
-static void enemy_movement_sine_wave_system(r::ecs::Res<r::core::FrameTime> time,
-    r::ecs::Query<r::ecs::Mut<Velocity>, r::ecs::Mut<SineWaveEnemy>> query)
+static void steer_sine_wave(Velocity &velocity, SineWaveEnemy &sine_wave, float dt)
 {
+    /* Update the angle for the sine calculation */
+    sine_wave.angle += sine_wave.frequency * dt;
+
+    /* The horizontal speed is constant (set at spawn), we only modify the vertical speed */
+    float base_horizontal_speed = velocity.value.x;
+    velocity.value.y = std::sin(sine_wave.angle) * sine_wave.amplitude;
+
+    /* Ensure horizontal speed is maintained */
+    velocity.value.x = base_horizontal_speed;
+}
+
+static void enemy_movement_sine_wave_system(r::ecs::Res<r::core::FrameTime> time, r::ecs::Res<JobPool> jobs,
+    r::ecs::ResMut<FrameMemory> memory, r::ecs::Query<r::ecs::Mut<Velocity>, r::ecs::Mut<SineWaveEnemy>> query)
+{
+    const float dt = time.ptr->delta_time;
+
+    if (query.size() < PARALLEL_FOR_THRESHOLD) {
+        for (auto [velocity, sine_wave] : query) {
+            steer_sine_wave(*velocity.ptr, *sine_wave.ptr, dt);
+        }
+        return;
+    }
+
+    std::pmr::vector<std::pair<Velocity *, SineWaveEnemy *>> waves{memory.ptr->resource()};
+    waves.reserve(query.size());
     for (auto [velocity, sine_wave] : query) {
-        /* Update the angle for the sine calculation */
-        sine_wave.ptr->angle += sine_wave.ptr->frequency * time.ptr->delta_time;
+        waves.emplace_back(velocity.ptr, sine_wave.ptr);
+    }
+    jobs.ptr->parallel_for(waves.size(), [&waves, dt](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            steer_sine_wave(*waves[i].first, *waves[i].second, dt);
+        }
+    });
+}
+
+/**
+ * @brief Returns the player `homing` should chase, picking the nearest one when due.
+ * @details The choice is only re-evaluated every RETARGET_INTERVAL_TICKS, on a tick derived from
+ * the entity id so that homers spread their re-targeting evenly across ticks. Between two
+ * re-evaluations the followed player's current position is still used; a target that died is
+ * replaced right away.
+ */
+static const TargetIndex::Target *select_target(HomingEnemy &homing, r::ecs::Entity self, const r::Vec3f &position,
+    const PlayerTargets &targets, std::uint64_t tick)
+{
+    const TargetIndex::Target *target = targets.find(homing.target);
+    if (!target || (tick + static_cast<std::uint64_t>(self)) % RETARGET_INTERVAL_TICKS == 0) {
+        target = targets.nearest(position);
+        homing.target = target ? target->entity : r::ecs::NULL_ENTITY;
+    }
+    return target;
+}
 
-        /* The horizontal speed is constant (set at spawn), we only modify the vertical speed */
-        float base_horizontal_speed = velocity.ptr->value.x;
-        velocity.ptr->value.y = std::sin(sine_wave.ptr->angle) * sine_wave.ptr->amplitude;
+static void steer_homing(Velocity &velocity, const r::Vec3f &position, const HomingEnemy &homing, const r::Vec3f &target, float dt)
+{
+    /* Calculate direction towards the player */
+    r::Vec3f direction_to_player = (target - position);
+    if (direction_to_player.length_sq() > 0) {
+        direction_to_player = direction_to_player.normalize();
+    }
 
-        /* Ensure horizontal speed is maintained */
-        velocity.ptr->value.x = base_horizontal_speed;
+    /* Get the current velocity's direction and speed */
+    float current_speed = velocity.value.length();
+    r::Vec3f current_direction = {0, 0, 0};
+    if (current_speed > 0) {
+        current_direction = velocity.value / current_speed;
     }
+
+    /* Interpolate towards the target direction to create a turning effect */
+    r::Vec3f new_direction = current_direction.lerp(direction_to_player, dt * homing.turn_speed);
+    if (new_direction.length_sq() > 0) {
+        new_direction = new_direction.normalize();
+    }
+
+    /* Apply the new direction, maintaining the original speed */
+    velocity.value = new_direction * current_speed;
 }
 
-static void enemy_movement_homing_system(r::ecs::Res<r::core::FrameTime> time,
-    r::ecs::Query<r::ecs::Mut<Velocity>, r::ecs::Ref<r::Transform3d>, r::ecs::Ref<HomingEnemy>> enemy_query,
-    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::With<Player>> player_query)
+static void enemy_movement_homing_system(r::ecs::Res<r::core::FrameTime> time, r::ecs::Res<JobPool> jobs,
+    r::ecs::Res<PlayerTargets> targets, r::ecs::Res<SimulationTick> tick, r::ecs::ResMut<FrameMemory> memory,
+    r::ecs::Query<r::ecs::Mut<Velocity>, r::ecs::Ref<r::Transform3d>, r::ecs::Mut<HomingEnemy>> enemy_query)
 {
-    if (player_query.size() == 0) {
+    if (targets.ptr->empty()) {
         return; /* No player to home in on */
     }
-    auto [player_transform, _p] = *player_query.begin();
-
-    for (auto [velocity, enemy_transform, homing] : enemy_query) {
-        /* Calculate direction towards the player */
-        r::Vec3f direction_to_player = (player_transform.ptr->position - enemy_transform.ptr->position);
-        if (direction_to_player.length_sq() > 0) {
-            direction_to_player = direction_to_player.normalize();
+    const PlayerTargets &index = *targets.ptr;
+    const std::uint64_t now = tick.ptr->value;
+    const float dt = time.ptr->delta_time;
+
+    if (enemy_query.size() < PARALLEL_FOR_THRESHOLD) {
+        for (auto it = enemy_query.begin(); it != enemy_query.end(); ++it) {
+            auto [velocity, enemy_transform, homing] = *it;
+            const TargetIndex::Target *target = select_target(*homing.ptr, it.entity(), enemy_transform.ptr->position, index, now);
+            steer_homing(*velocity.ptr, enemy_transform.ptr->position, *homing.ptr, target->position, dt);
         }
+        return;
+    }
 
-        /* Get the current velocity's direction and speed */
-        float current_speed = velocity.ptr->value.length();
-        r::Vec3f current_direction = {0, 0, 0};
-        if (current_speed > 0) {
-            current_direction = velocity.ptr->value / current_speed;
+    struct Homer {
+            r::ecs::Entity entity;
+            Velocity *velocity;
+            const r::Transform3d *transform;
+            HomingEnemy *homing;
+    };
+    std::pmr::vector<Homer> homers{memory.ptr->resource()};
+    homers.reserve(enemy_query.size());
+    for (auto it = enemy_query.begin(); it != enemy_query.end(); ++it) {
+        auto [velocity, enemy_transform, homing] = *it;
+        homers.push_back({it.entity(), velocity.ptr, enemy_transform.ptr, homing.ptr});
+    }
+    /* The index is only read here, each homer writes its own HomingEnemy */
+    jobs.ptr->parallel_for(homers.size(), [&homers, &index, now, dt](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            Homer &homer = homers[i];
+            const TargetIndex::Target *target = select_target(*homer.homing, homer.entity, homer.transform->position, index, now);
+            steer_homing(*homer.velocity, homer.transform->position, *homer.homing, target->position, dt);
         }
+    });
+}
+
+/**
+ * @brief Bakes the level's flight paths into arc-length tables once, when the level starts, and drops
+ * the formation members still queued from the previous one.
+ */
+static void bake_level_paths_system(r::ecs::Res<CurrentLevel> current_level, r::ecs::Res<GameLevels> game_levels,
+    r::ecs::ResMut<LevelPaths> paths, r::ecs::ResMut<FormationQueue> formations)
+{
+    const auto &level_data = game_levels.ptr->levels[static_cast<size_t>(current_level.ptr->index)];
+    formations.ptr->pending.clear();
+    paths.ptr->paths.clear();
+    for (const auto &path : level_data.paths) {
+        paths.ptr->paths.push_back(SplinePath::bake(path.control_points));
+    }
+}
 
-        /* Interpolate towards the target direction to create a turning effect */
-        r::Vec3f new_direction = current_direction.lerp(direction_to_player, time.ptr->delta_time * homing.ptr->turn_speed);
-        if (new_direction.length_sq() > 0) {
-            new_direction = new_direction.normalize();
+/**
+ * @brief Moves every PathFollower along its path.
+ * @details Followers are bucketed per path and sampled in one batch per path. Members that
+ * reach the end of their path leave the battle (no score, no death event).
+ */
+static void enemy_path_follow_system(r::ecs::Commands &commands, r::ecs::Res<r::core::FrameTime> time, r::ecs::Res<LevelPaths> paths,
+    r::ecs::ResMut<BattleArena> arena, r::ecs::ResMut<FrameMemory> memory,
+    r::ecs::Query<r::ecs::Mut<r::Transform3d>, r::ecs::Mut<PathFollower>> query)
+{
+    struct Bucket {
+            std::pmr::vector<r::Transform3d *> transforms;
+            std::pmr::vector<float> distances;
+    };
+    std::pmr::memory_resource *scratch = memory.ptr->resource();
+    const auto &baked = paths.ptr->paths;
+    const float dt = time.ptr->delta_time;
+
+    std::pmr::vector<Bucket> buckets{scratch};
+    buckets.reserve(baked.size());
+    for (std::size_t path = 0; path < baked.size(); ++path) {
+        buckets.push_back({std::pmr::vector<r::Transform3d *>{scratch}, std::pmr::vector<float>{scratch}});
+    }
+    std::pmr::vector<float> xs{scratch}, ys{scratch}, zs{scratch};
+
+    for (auto it = query.begin(); it != query.end(); ++it) {
+        auto [transform, follower] = *it;
+        if (follower.ptr->path >= baked.size()) {
+            continue;
+        }
+        follower.ptr->distance += follower.ptr->speed * dt;
+        if (follower.ptr->distance >= baked[follower.ptr->path].length()) {
+            arena.ptr->release(it.entity());
+            commands.despawn(it.entity());
+            continue;
         }
+        buckets[follower.ptr->path].transforms.push_back(transform.ptr);
+        buckets[follower.ptr->path].distances.push_back(follower.ptr->distance);
+    }
 
-        /* Apply the new direction, maintaining the original speed */
-        velocity.ptr->value = new_direction * current_speed;
+    for (std::size_t path = 0; path < buckets.size(); ++path) {
+        const Bucket &bucket = buckets[path];
+        const std::size_t count = bucket.distances.size();
+        xs.resize(count);
+        ys.resize(count);
+        zs.resize(count);
+        baked[path].sample(bucket.distances.data(), count, xs.data(), ys.data(), zs.data());
+        for (std::size_t i = 0; i < count; ++i) {
+            bucket.transforms[i]->position = {xs[i], ys[i], zs[i]};
+        }
     }
 }
 
@@ -282,6 +688,9 @@ static void enemy_movement_homing_system(r::ecs::Res<r::core::FrameTime> time,
 /* Boss Behavior Systems */
 /* ================================================================================= */
 
+/**
+ * @brief Tints bosses while any shield is alive. Runs only on frames with a HealthChangedEvent.
+ */
 static void boss_shield_color_system(
     r::ecs::Query<r::ecs::Mut<r::Mesh3d>, r::ecs::With<Boss>> boss_query,
     r::ecs::Query<r::ecs::Ref<Health>, r::ecs::With<Shield>> shield_query)
@@ -295,16 +704,27 @@ static void boss_shield_color_system(
     }
 
     for (auto [mesh, _b] : boss_query) {
-        if (shields_alive) {
-            /* Tint the boss while shields are up (light blue tint) */
-            mesh.ptr->color = r::Color{100, 180, 255, 255};
-        } else {
-            /* Restore base color */
-            mesh.ptr->color = r::Color{255, 255, 255, 255};
-        }
+        mesh.ptr->color = shields_alive ? BOSS_SHIELDED_TINT : BOSS_BASE_COLOR;
     }
 }
 
+/**
+ * @brief Refreshes BossPhase for bosses whose Health changed this frame.
+ */
+static void boss_phase_system(r::ecs::EventReader<HealthChangedEvent> reader,
+    r::ecs::Query<r::ecs::Ref<Health>, r::ecs::Mut<BossPhase>> boss_query)
+{
+    for (const auto &event : reader) {
+        for (auto it = boss_query.begin(); it != boss_query.end(); ++it) {
+            if (it.entity() != event.entity) {
+                continue;
+            }
+            auto [health, phase] = *it;
+            phase.ptr->enraged = health.ptr->current <= health.ptr->max / 2;
+            break;
+        }
+    }
+}
 
 static void boss_movement_vertical_patrol_system(
     r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Mut<Velocity>, r::ecs::With<VerticalPatrolBoss>> query)
@@ -319,16 +739,16 @@ static void boss_movement_vertical_patrol_system(
 }
 
 static void boss_shooting_vertical_patrol_system(r::ecs::Commands &commands, r::ecs::Res<r::core::FrameTime> time,
-    r::ecs::Res<BossBulletAssets> bullet_assets,
-    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Mut<BossShootTimer>, r::ecs::Ref<Health>, r::ecs::With<VerticalPatrolBoss>> query)
+    r::ecs::Res<BossBulletAssets> bullet_assets, r::ecs::ResMut<BattleArena> arena,
+    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Mut<BossShootTimer>, r::ecs::Ref<BossPhase>, r::ecs::With<VerticalPatrolBoss>> query)
 {
-    for (auto [transform, timer, health, _] : query) {
+    for (auto [transform, timer, phase, _] : query) {
         timer.ptr->time_left -= time.ptr->delta_time;
 
         if (timer.ptr->time_left <= 0.0f) {
             timer.ptr->time_left = BossShootTimer::FIRE_RATE;
 
-            commands.spawn(EnemyBullet{},
+            auto small_missile = commands.spawn(EnemyBullet{},
                 r::Transform3d{
                     .position = transform.ptr->position - r::Vec3f{1.6f, 0.0f, 0.0f},
                     .rotation = {-(static_cast<float>(M_PI) / 2.0f), 0.0f, static_cast<float>(M_PI) / 2.0f},
@@ -346,124 +766,28 @@ static void boss_shooting_vertical_patrol_system(r::ecs::Commands &commands, r::
                     .color = r::Color{255, 255, 255, 255},
                     .rotation_offset = {-(static_cast<float>(M_PI) / 2.0f), 0.0f, -static_cast<float>(M_PI) / 2.0f},
                 });
-            if (health.ptr->current <= health.ptr->max / 2) {
-                commands
-                    .spawn(EnemyBullet{},
-                        r::Transform3d{
-                            .position = transform.ptr->position + r::Vec3f{0.0f, 5.5f, 0.0f},
-                            .rotation = {-(static_cast<float>(M_PI) / 2.0f), 0.0f, static_cast<float>(M_PI) / 2.0f},
-                            .scale = {0.5f, 0.5f, 0.5f},
-                        },
-                        Velocity{
-                            {-BULLET_SPEED, 0.0f, 0.0f},
-                        },
-                        Collider{
-                            .radius = 0.8f,
-                        },
-                        r::Mesh3d{
-                            .id = bullet_assets.ptr->big_missile,
-                            .color = r::Color{255, 255, 255, 255},
-                            .rotation_offset = {-(static_cast<float>(M_PI) / 2.0f), 0.0f, -static_cast<float>(M_PI) / 2.0f},
-                        })
-                    .insert(Unblockable{});
-            }
-        }
-    }
-}
-
-static void boss_movement_homing_attack_system(r::ecs::Res<r::core::FrameTime> time,
-    r::ecs::Query<r::ecs::Mut<r::Transform3d>, r::ecs::Mut<Velocity>, r::ecs::Mut<HomingAttackBoss>> query)
-{
-    const float BATTLE_POSITION_X = 8.0f;
-    const float VERTICAL_BOUND = 4.0f;
-
-    for (auto [transform, velocity, behavior] : query) {
-        behavior.ptr->state_timer -= time.ptr->delta_time;
-
-        switch (behavior.ptr->current_state) {
-            case HomingAttackBoss::State::Entering: {
-                if (transform.ptr->position.x <= BATTLE_POSITION_X) {
-                    transform.ptr->position.x = BATTLE_POSITION_X;
-                    velocity.ptr->value = {0.0f, 0.0f, 0.0f};
-                    behavior.ptr->current_state = HomingAttackBoss::State::Repositioning;
-                    behavior.ptr->state_timer = 0.0f;///< Immediately reposition
-                }
-                break;
-            }
-            case HomingAttackBoss::State::Repositioning: {
-                /* First, check if we need to select a new target position.
-                -> This happens if the timer has expired (or was set to 0 on purpose). */
-                if (behavior.ptr->state_timer <= 0.0f) {
-                    float target_y = (static_cast<float>(rand()) / static_cast<float>(RAND_MAX)) * (VERTICAL_BOUND * 2.0f) - VERTICAL_BOUND;
-                    behavior.ptr->target_position = {BATTLE_POSITION_X, target_y, 0.0f};
-                    behavior.ptr->state_timer = 3.0f;///< Give it 3 seconds to reach the destination
-                }
-
-                /* Then, handle the movement towards the target */
-                r::Vec3f direction = behavior.ptr->target_position - transform.ptr->position;
-                float distance = direction.length();
-
-                if (distance < 0.1f) {
-                    velocity.ptr->value = {0.0f, 0.0f, 0.0f};
-                    behavior.ptr->current_state = HomingAttackBoss::State::Attacking;
-                    behavior.ptr->state_timer = 4.0f;///< Attack for 4 seconds
-                } else {
-                    velocity.ptr->value = direction.normalize() * BOSS_HOMING_MOVE_SPEED;
-                }
-                break;
-            }
-            case HomingAttackBoss::State::Attacking: {
-                velocity.ptr->value = {0.0f, 0.0f, 0.0f};
-                if (behavior.ptr->state_timer <= 0.0f) {
-                    behavior.ptr->current_state = HomingAttackBoss::State::Repositioning;
-                    /* Set timer to 0 to force an immediate new target selection in the Repositioning state. */
-                    behavior.ptr->state_timer = 0.0f;
-                }
-                break;
-            }
-            default: {
-                break;
-            }
-        }
-    }
-}
-
-static void boss_shooting_homing_attack_system(r::ecs::Commands &commands, r::ecs::Res<r::core::FrameTime> time,
-    r::ecs::Res<BossBulletAssets> bullet_assets,
-    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Mut<BossShootTimer>, r::ecs::Ref<HomingAttackBoss>, r::ecs::Ref<Health>> query)
-{
-    for (auto [transform, timer, behavior, health] : query) {
-        if (behavior.ptr->current_state != HomingAttackBoss::State::Attacking) {
-            continue;
-        }
-
-        timer.ptr->time_left -= time.ptr->delta_time;
+            arena.ptr->track(small_missile.id());
 
-        if (timer.ptr->time_left <= 0.0f) {
-            float fire_rate = 1.5f;
-            /* Enraged state: fire faster when health is low */
-            if (health.ptr->current <= health.ptr->max / 2) {
-                fire_rate = 0.8f;
+            if (phase.ptr->enraged) {
+                auto big_missile = commands.spawn(EnemyBullet{}, Unblockable{},
+                    r::Transform3d{
+                        .position = transform.ptr->position + r::Vec3f{0.0f, 5.5f, 0.0f},
+                        .rotation = {-(static_cast<float>(M_PI) / 2.0f), 0.0f, static_cast<float>(M_PI) / 2.0f},
+                        .scale = {0.5f, 0.5f, 0.5f},
+                    },
+                    Velocity{
+                        {-BULLET_SPEED, 0.0f, 0.0f},
+                    },
+                    Collider{
+                        .radius = 0.8f,
+                    },
+                    r::Mesh3d{
+                        .id = bullet_assets.ptr->big_missile,
+                        .color = r::Color{255, 255, 255, 255},
+                        .rotation_offset = {-(static_cast<float>(M_PI) / 2.0f), 0.0f, -static_cast<float>(M_PI) / 2.0f},
+                    });
+                arena.ptr->track(big_missile.id());
             }
-            timer.ptr->time_left = fire_rate;
-
-            /* Spawn a homing missile */
-            commands.spawn(EnemyBullet{}, HomingEnemy{1.8f}, TimedDespawn{4.0f},
-                r::Transform3d{
-                    .position = transform.ptr->position,
-                    .scale = {0.7f, 0.7f, 0.7f},
-                },
-                Velocity{
-                    {-HOMING_MISSILE_SPEED, 0.0f, 0.0f},
-                },
-                Collider{
-                    .radius = 0.5f,
-                },
-                r::Mesh3d{
-                    .id = bullet_assets.ptr->small_missile,
-                    .color = r::Color{255, 255, 255, 255},
-                    .rotation_offset = {(static_cast<float>(M_PI) / 2.0f), 0.0f, -static_cast<float>(M_PI) / 2.0f},
-                });
         }
     }
 }
@@ -475,28 +799,29 @@ static void boss_movement_turret_system([[maybe_unused]] r::ecs::Query<r::ecs::W
 
 void EnemyPlugin::build(r::Application &app)
 {
-    app.add_systems<enemy_spawner_system>(r::Schedule::UPDATE)
-        .run_if<r::run_conditions::in_state<GameState::EnemiesBattle>>()
+    app.insert_resource(LevelPaths{})
+        .insert_resource(FormationQueue{})
+        .add_systems<enemy_spawner_system>(r::Schedule::UPDATE)
+        .run_if<r::run_conditions::on_event<EnemySpawnRequestEvent>>()
 
-        .add_systems<enemy_movement_homing_system, enemy_movement_sine_wave_system>(r::Schedule::UPDATE)
-        .run_if<r::run_conditions::in_state<GameState::EnemiesBattle>>()
-        .run_or<r::run_conditions::in_state<GameState::BossBattle>>()
+        .add_systems<bake_level_paths_system>(r::OnEnter{GameState::EnemiesBattle})
+        .run_unless<run_conditions::is_resuming_from_pause>()
+
+        .add_systems<enemy_movement_homing_system, enemy_movement_sine_wave_system, formation_release_system, enemy_path_follow_system>(
+            r::Schedule::UPDATE)
+        .run_if<run_conditions::in_scope<GameScope::Battle>>()
 
         .add_systems<boss_spawn_system>(r::OnEnter(GameState::BossBattle))
         .run_unless<run_conditions::is_resuming_from_pause>()
 
-        /* Systems for the Level 1 Boss */
-        .add_systems<boss_movement_vertical_patrol_system, boss_shooting_vertical_patrol_system>(r::Schedule::UPDATE)
-        .run_if<r::run_conditions::in_state<GameState::BossBattle>>()
-
-        /* Systems for the Level 2 Boss (Homing Attack) */
-        .add_systems<boss_movement_homing_attack_system, boss_shooting_homing_attack_system>(r::Schedule::UPDATE)
-        .run_if<r::run_conditions::in_state<GameState::BossBattle>>()
+        /* Systems for the Level 1 (vertical patrol) and turret Bosses */
+        .add_systems<boss_movement_vertical_patrol_system, boss_shooting_vertical_patrol_system, boss_movement_turret_system>(
+            r::Schedule::UPDATE)
+        .run_if<run_conditions::in_scope<GameScope::Boss>>()
 
-    .add_systems<boss_movement_turret_system>(r::Schedule::UPDATE)
-    .run_if<r::run_conditions::in_state<GameState::BossBattle>>()
+        /* The Level 2 Boss (Homing Attack) is driven by homing_attack_boss_script */
 
-    /* Tint boss while shields are alive */
-    .add_systems<boss_shield_color_system>(r::Schedule::UPDATE)
-    .run_if<r::run_conditions::in_state<GameState::BossBattle>>();
+    /* Health-dependent boss state, only evaluated when some Health changed */
+    .add_systems<boss_shield_color_system, boss_phase_system>(r::Schedule::UPDATE)
+    .run_if<r::run_conditions::on_event<HealthChangedEvent>>();
 }
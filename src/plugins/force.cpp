@@ -13,7 +13,10 @@
 #include <components/player.hpp>
 #include <components/projectiles.hpp>
 #include <resources/assets.hpp>
+#include <resources/level_arena.hpp>
+#include <resources/targeting.hpp>
 #include <state/game_state.hpp>
+#include <state/run_conditions.hpp>
 
 // clang-format off
 
@@ -25,7 +28,7 @@ static constexpr float FORCE_LAUNCH_SPEED = 8.0f;
 static constexpr float FORCE_RECALL_SPEED = 15.0f;
 static constexpr float FORCE_REATTACH_DISTANCE = 0.5f;
 static constexpr float FORCE_ACTION_COOLDOWN = 0.5f;
-static constexpr float FORCE_FRONT_OFFSET_X = 1.75f;
+static constexpr float FORCE_FRONT_OFFSET_X = 1.75f; /* In owner-scale units, as when the Force was a child */
 static constexpr float FORCE_FIRE_RATE = 0.25f;
 static constexpr float FORCE_BULLET_SPEED = 10.0f;
 
@@ -37,13 +40,12 @@ static constexpr float FORCE_TARGET_X_OFFSET = 4.0f; /* Horizontal distance from
 /* Force Systems */
 /* ================================================================================= */
 
-static void force_control_system(r::ecs::Commands &commands, r::ecs::Res<r::UserInput> user_input, r::ecs::Res<r::InputMap> input_map,
+static void force_control_system(r::ecs::Res<r::UserInput> user_input, r::ecs::Res<r::InputMap> input_map,
     r::ecs::Res<r::core::FrameTime> time, r::ecs::Query<r::ecs::Mut<Player>> player_query,
-    r::ecs::Query<r::ecs::Mut<Force>, r::ecs::Mut<r::Transform3d>, r::ecs::Ref<r::GlobalTransform3d>,
-        r::ecs::Optional<r::ecs::Ref<r::ecs::Parent>>>
-        force_query)
+    r::ecs::Query<r::ecs::Mut<Force>, r::ecs::Mut<Velocity>> force_query)
 {
-    bool is_force_pressed = input_map.ptr->isActionPressed("Force", *user_input.ptr);
+    /* The dedicated server has no local input */
+    const bool is_force_pressed = user_input.ptr && input_map.ptr && input_map.ptr->isActionPressed("Force", *user_input.ptr);
 
     for (auto it = player_query.begin(); it != player_query.end(); ++it) {
         auto [player] = *it;
@@ -70,30 +72,18 @@ static void force_control_system(r::ecs::Commands &commands, r::ecs::Res<r::User
                 continue;
 
             action_taken = true;
-            auto [force, transform, global_transform, parent] = *force_it;
-
-            if (force.ptr->is_attached) {
-                if (!parent.ptr) {
-                    r::Logger::error("force_control_system: Force is 'attached' but has no Parent component!");
-                }
-                player.ptr->force_cooldown = FORCE_ACTION_COOLDOWN;
-                force.ptr->is_attached = false;
-
-                transform.ptr->position = global_transform.ptr->position;
-                transform.ptr->rotation = global_transform.ptr->rotation;
-
-                commands.entity(force_it.entity()).remove<r::ecs::Parent>();
-                commands.entity(force_it.entity()).insert(Velocity{{FORCE_LAUNCH_SPEED, 0.0f, 0.0f}});
-                break;
-                break;
-            }
+            auto [force, velocity] = *force_it;
+            player.ptr->force_cooldown = FORCE_ACTION_COOLDOWN;
 
-            if (!force.ptr->is_attached) {
-                player.ptr->force_cooldown = FORCE_ACTION_COOLDOWN;
-                force.ptr->is_attached = true;
-                commands.entity(force_it.entity()).remove<Velocity>();
-                break;
+            /* Launching used to remove Parent + insert Velocity, recalling removed Velocity */
+            if (force.ptr->state == Force::State::Launched) {
+                force.ptr->state = Force::State::Recalling;
+                velocity.ptr->value = {0.0f, 0.0f, 0.0f};
+            } else {
+                force.ptr->state = Force::State::Launched;
+                velocity.ptr->value = {FORCE_LAUNCH_SPEED, 0.0f, 0.0f};
             }
+            break;
         }
         if (is_force_pressed && !action_taken) {
             r::Logger::error("force_control_system: Force button was pressed, but the player's force_entity "
@@ -102,55 +92,83 @@ static void force_control_system(r::ecs::Commands &commands, r::ecs::Res<r::User
     }
 }
 
-static void force_recall_system(r::ecs::Commands &commands, r::ecs::Res<r::core::FrameTime> time,
-    r::ecs::Query<r::ecs::Mut<r::Transform3d>, r::ecs::Ref<Force>, r::ecs::Without<r::ecs::Parent>> force_query,
-    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::With<Player>> player_query)
+/**
+ * @brief Keeps attached Forces glued in front of their owner.
+ * @details The Force shares its owner's velocity so both move by the same step in movement_system,
+ * whichever order the two systems run in.
+ */
+static void force_follow_owner_system(
+    r::ecs::Query<r::ecs::Mut<r::Transform3d>, r::ecs::Mut<Velocity>, r::ecs::Ref<Force>> force_query,
+    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Velocity>, r::ecs::With<Player>> player_query)
 {
-    if (player_query.size() == 0)
-        return;
-    auto [player_transform, _p] = *player_query.begin();
-
-    for (auto force_it = force_query.begin(); force_it != force_query.end(); ++force_it) {
-        auto [transform, force, __] = *force_it;
-
-        if (force.ptr->is_attached) {
-            r::Vec3f direction = player_transform.ptr->position - transform.ptr->position;
-            float distance = direction.length();
+    for (auto [transform, velocity, force] : force_query) {
+        if (force.ptr->state != Force::State::Attached)
+            continue;
 
-            if (distance > FORCE_REATTACH_DISTANCE) {
-                transform.ptr->position += direction.normalize() * FORCE_RECALL_SPEED * time.ptr->delta_time;
-            } else {
-                commands.entity(force_it.entity()).insert(r::ecs::Parent{force.ptr->owner});
+        for (auto player_it = player_query.begin(); player_it != player_query.end(); ++player_it) {
+            if (player_it.entity() != force.ptr->owner)
+                continue;
 
-                /* Reset its local position relative to the player */
-                transform.ptr->position = {FORCE_FRONT_OFFSET_X, 0.0f, 0.0f};
-                transform.ptr->rotation = {0.f, 0.f, 0.f};
-            }
+            auto [player_transform, player_velocity, _p] = *player_it;
+            const float side = force.ptr->is_front_attachment ? 1.0f : -1.0f;
+            transform.ptr->position = player_transform.ptr->position
+                + r::Vec3f{side * FORCE_FRONT_OFFSET_X * player_transform.ptr->scale.x, 0.0f, 0.0f};
+            transform.ptr->rotation = {0.f, 0.f, 0.f};
+            velocity.ptr->value = player_velocity.ptr->value;
+            break;
         }
     }
 }
 
-static void force_autonomous_movement_system(
-    r::ecs::Res<r::core::FrameTime> time,
-    r::ecs::Query<r::ecs::Mut<Velocity>, r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Force>, r::ecs::Without<r::ecs::Parent>> force_query,
-    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::With<Player>> player_query)
+static void force_recall_system(r::ecs::Res<r::core::FrameTime> time, r::ecs::Res<PlayerTargets> targets,
+    r::ecs::Query<r::ecs::Mut<r::Transform3d>, r::ecs::Mut<Force>> force_query)
 {
-    if (player_query.size() == 0 || force_query.size() == 0) {
-        return;
-    }
+    for (auto [transform, force] : force_query) {
+        if (force.ptr->state != Force::State::Recalling)
+            continue;
+
+        const TargetIndex::Target *owner = targets.ptr->find(force.ptr->owner);
+        if (!owner)
+            continue;
+
+        r::Vec3f direction = owner->position - transform.ptr->position;
+        float distance = direction.length();
 
-    auto [player_transform, _p] = *player_query.begin();
+        if (distance > FORCE_REATTACH_DISTANCE) {
+            transform.ptr->position += direction.normalize() * FORCE_RECALL_SPEED * time.ptr->delta_time;
+        } else {
+            /* force_follow_owner_system snaps it into place from now on (used to insert Parent) */
+            force.ptr->state = Force::State::Attached;
+        }
+    }
+}
 
-    for (auto [velocity, transform, force, __] : force_query) {
+/**
+ * @brief Keeps a launched Force hovering on the opposite half of the screen from its owner.
+ * @details Each Force follows its own owner, looked up in PlayerTargets, so several players can
+ * fly their Force independently.
+ */
+static void force_autonomous_movement_system(r::ecs::Res<r::core::FrameTime> time, r::ecs::Res<PlayerTargets> targets,
+    r::ecs::Query<r::ecs::Mut<Velocity>, r::ecs::Ref<r::Transform3d>, r::ecs::Ref<Force>> force_query)
+{
+    for (auto [velocity, transform, force] : force_query) {
+        if (force.ptr->state == Force::State::Attached) {
+            continue;
+        }
         /* When recalling, stop all autonomous movement */
-        if (force.ptr->is_attached) {
+        if (force.ptr->state == Force::State::Recalling) {
             velocity.ptr->value = {0.f, 0.f, 0.f};
             continue;
         }
 
-        float y_target = player_transform.ptr->position.y;
+        const TargetIndex::Target *owner = targets.ptr->find(force.ptr->owner);
+        if (!owner) {
+            continue;
+        }
+
+        float y_target = owner->position.y;
 
-        float x_target = (player_transform.ptr->position.x < 0) ? FORCE_TARGET_X_OFFSET : -FORCE_TARGET_X_OFFSET;
+        float x_target = (owner->position.x < 0) ? FORCE_TARGET_X_OFFSET : -FORCE_TARGET_X_OFFSET;
 
         r::Vec3f target_pos = {x_target, y_target, 0.0f};
         r::Vec3f current_pos = transform.ptr->position;
@@ -165,18 +183,19 @@ static void force_autonomous_movement_system(
 }
 
 static void force_shooting_system(r::ecs::Commands &commands, r::ecs::Res<PlayerBulletAssets> bullet_assets, r::ecs::Res<r::core::FrameTime> time,
-    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Mut<FireCooldown>, r::ecs::Ref<Force>, r::ecs::Without<r::ecs::Parent>> query)
+    r::ecs::ResMut<BattleArena> arena,
+    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Mut<FireCooldown>, r::ecs::Ref<Force>> query)
 {
-    for (auto [transform, cooldown, force, _] : query) {
+    for (auto [transform, cooldown, force] : query) {
         /* Don't shoot when attached or being recalled. */
-        if (force.ptr->is_attached) {
+        if (force.ptr->state != Force::State::Launched) {
             continue;
         }
 
         cooldown.ptr->timer -= time.ptr->delta_time;
         if (cooldown.ptr->timer <= 0.0f) {
             cooldown.ptr->timer = FORCE_FIRE_RATE;
-            commands.spawn(PlayerBullet{},
+            auto bullet = commands.spawn(PlayerBullet{},
                 r::Transform3d{
                     .position = transform.ptr->position,/* Spawn at the Force's current world position */
                     .scale = {1.5f, 1.5f, 1.5f}},
@@ -187,14 +206,15 @@ static void force_shooting_system(r::ecs::Commands &commands, r::ecs::Res<Player
                     .color = r::Color{255, 255, 255, 255}, /* Teal color for Force bullets */
                     .rotation_offset = {-(static_cast<float>(M_PI) / 2.0f), 0.0f, -static_cast<float>(M_PI) / 2.0f}
                 });
+            arena.ptr->track(bullet.id());
         }
     }
 }
 
 void ForcePlugin::build(r::Application &app)
 {
-    app.add_systems<force_control_system, force_recall_system, force_autonomous_movement_system, force_shooting_system>(r::Schedule::UPDATE)
-        .run_if<r::run_conditions::in_state<GameState::EnemiesBattle>>()
-        .run_or<r::run_conditions::in_state<GameState::BossBattle>>();
+    app.add_systems<force_control_system, force_follow_owner_system, force_recall_system, force_autonomous_movement_system, force_shooting_system>(
+            r::Schedule::UPDATE)
+        .run_if<run_conditions::in_scope<GameScope::Battle>>();
 }
 // clang-format on
@@ -0,0 +1,187 @@
+#include "plugins/game_setup.hpp"
+#include <R-Engine/Application.hpp>
+#include <R-Engine/Core/Logger.hpp>
+#include <R-Engine/ECS/Command.hpp>
+#include <R-Engine/ECS/Event.hpp>
+#include <fstream>
+#include <string>
+
+#include <events/debug.hpp>
+#include <events/game_events.hpp>
+#include <resources/level.hpp>
+
+/**
+ * @brief (STARTUP) Inserts the level table and starts at the first level.
+ */
+static void setup_levels_system(r::ecs::Commands &commands)
+{
+    GameLevels game_levels;
+    game_levels.levels = {
+        {
+            .id = 1,
+            .enemy_spawn_interval = 0.75f,
+            .boss_spawn_time = 10.0f,
+            .background_texture_path = "assets/textures/background.png",
+            .scenery_model_path = "assets/models/BlackBuilding.glb",
+            .enemy_types =
+                {
+                    {
+                        "assets/models/enemy.glb",
+                        1,
+                        2.0f,
+                        EnemyBehaviorType::Straight,
+                        100,
+                    },
+                    {
+                        "assets/models/enemy.glb",
+                        2,
+                        1.5f,
+                        EnemyBehaviorType::Straight,
+                        150,
+                    },
+                },
+            .boss_data =
+                {
+                    .model_path = "assets/models/Boss.glb",
+                    .max_health = 500,
+                    .behavior = BossBehaviorType::VerticalPatrol,
+                    .score_value = 5000,
+                },
+            .capacity =
+                {
+                    .battle_entities = 256,
+                    .scenery_entities = 32,
+                },
+        },
+        {
+            .id = 2,
+            .enemy_spawn_interval = 0.5f,
+            .boss_spawn_time = 15.0f,
+            .background_texture_path = "assets/textures/background_level2.png",
+            .scenery_model_path = "assets/models/Asteroid.glb",
+            .enemy_types =
+                {
+                    {
+                        "assets/models/enemy_2.glb",
+                        2,
+                        3.0f,
+                        EnemyBehaviorType::SineWave,
+                        200,
+                    },
+                },
+            .boss_data =
+                {
+                    .model_path = "assets/models/boss_2.glb",
+                    .max_health = 750,
+                    .behavior = BossBehaviorType::HomingAttack,
+                    .score_value = 7500,
+                },
+            .capacity =
+                {
+                    .battle_entities = 384,
+                    .scenery_entities = 32,
+                },
+        },
+        {
+            .id = 3,
+            .enemy_spawn_interval = 0.3f,
+            .boss_spawn_time = 20.0f,
+            .background_texture_path = "assets/textures/background_level3.png",
+            .scenery_model_path = "assets/models/FortressWall.glb",
+            .enemy_types =
+                {
+                    {
+                        "assets/models/enemy.glb",
+                        3,
+                        2.0f,
+                        EnemyBehaviorType::Homing,
+                        300,
+                    },
+                    {
+                        "assets/models/enemy.glb",
+                        1,
+                        4.0f,
+                        EnemyBehaviorType::Straight,
+                        100,
+                    },
+                    {
+                        "assets/models/enemy.glb",
+                        1,
+                        5.0f,
+                        EnemyBehaviorType::SplinePath,
+                        150,
+                        0,
+                        5,
+                        0.3f,
+                    },
+                },
+            .boss_data =
+                {
+                    .model_path = "assets/models/Boss.glb",
+                    .max_health = 1000,
+                    .behavior = BossBehaviorType::Turret,
+                    .score_value = 10000,
+                },
+            .capacity =
+                {
+                    .battle_entities = 512,
+                    .scenery_entities = 32,
+                },
+            .paths =
+                {
+                    /* Dive from the top right, loop through the middle and leave low on the left */
+                    {{{15.0f, 6.0f, 0.0f}, {8.0f, 2.0f, 0.0f}, {3.0f, -3.0f, 0.0f}, {-2.0f, 0.0f, 0.0f}, {2.0f, 3.0f, 0.0f}, {-6.0f, -2.0f, 0.0f},
+                        {-20.0f, -5.0f, 0.0f}}},
+                },
+        },
+    };
+    commands.insert_resource(game_levels);
+    commands.insert_resource(CurrentLevel{0}); /* Start at level 0 */
+}
+
+NetworkConfig load_network_config(const std::string &filename)
+{
+    NetworkConfig config;
+    std::ifstream config_file(filename);
+
+    if (config_file.is_open()) {
+        std::string line;
+        while (std::getline(config_file, line)) {
+            std::string key;
+            std::string value;
+            size_t separator_pos = line.find('=');
+            if (separator_pos != std::string::npos) {
+                key = line.substr(0, separator_pos);
+                value = line.substr(separator_pos + 1);
+
+                if (key == "address") {
+                    config.server_address = value;
+                } else if (key == "port") {
+                    try {
+                        config.server_port = static_cast<unsigned short>(std::stoi(value));
+                    } catch (...) {
+                        /* Keep default port if parsing fails */
+                    }
+                }
+            }
+        }
+        r::Logger::info("Loaded network config from " + filename);
+    } else {
+        // File doesn't exist, create it with defaults
+        std::ofstream new_config_file(filename);
+        if (new_config_file.is_open()) {
+            new_config_file << "address=" << config.server_address << std::endl;
+            new_config_file << "port=" << config.server_port << std::endl;
+            r::Logger::info(filename + " not found. Created with default settings.");
+        }
+    }
+    return config;
+}
+
+void GameSetupPlugin::build(r::Application &app)
+{
+    /* Register all custom game events */
+    app.add_events<PlayerDiedEvent, BossTimeReachedEvent, BossDefeatedEvent, EntityDiedEvent, DebugSwitchLevelEvent, HealthChangedEvent,
+           PlayerStatsChangedEvent, EnemySpawnRequestEvent>()
+        .add_systems<setup_levels_system>(r::Schedule::STARTUP);
+}
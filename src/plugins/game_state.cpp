@@ -1,25 +1,33 @@
 #include "plugins/game_state.hpp"
 #include <R-Engine/Application.hpp>
 #include <R-Engine/Core/Logger.hpp>
+#include <R-Engine/Core/States.hpp>
 #include <R-Engine/ECS/Event.hpp>
 #include <R-Engine/ECS/RunConditions.hpp>
+#include <cstdint>
 #include <string>
 
 #include <components/player.hpp>
 #include <events/debug.hpp>
 #include <events/game_events.hpp>
+#include <resources/game_scope.hpp>
 #include <resources/game_state.hpp>
 #include <resources/level.hpp>
 #include <state/game_state.hpp>
 
 static void handle_player_death_system(r::ecs::ResMut<r::NextState<GameState>> next_state, r::ecs::ResMut<PlayerLives> lives,
-    r::ecs::Commands &commands, r::ecs::Query<r::ecs::With<Player>> player_query)
+    r::ecs::EventWriter<PlayerStatsChangedEvent> stats_writer, r::ecs::Commands &commands, r::ecs::Query<r::ecs::Ref<Player>> player_query)
 {
     lives.ptr->count--;
+    stats_writer.send({});
     r::Logger::info("Player died. Lives remaining: " + std::to_string(lives.ptr->count));
 
-    /* Despawn the player entity. Its children (like the Force) will be despawned automatically. */
+    /* Despawn the player entity and its Force, which is not parented to it. */
     for (auto it = player_query.begin(); it != player_query.end(); ++it) {
+        auto [player] = *it;
+        if (player.ptr->force_entity != r::ecs::NULL_ENTITY) {
+            commands.despawn(player.ptr->force_entity);
+        }
         commands.despawn(it.entity());
     }
 
@@ -68,32 +76,77 @@ static void handle_debug_level_switch(r::ecs::EventReader<DebugSwitchLevelEvent>
     }
 }
 
-static void reset_player_lives_system(r::ecs::ResMut<PlayerLives> lives)
+static void reset_player_lives_system(r::ecs::ResMut<PlayerLives> lives, r::ecs::EventWriter<PlayerStatsChangedEvent> stats_writer)
 {
     lives.ptr->count = 3;
+    stats_writer.send({});
 }
 
-static void reset_player_score_system(r::ecs::ResMut<PlayerScore> score)
+static void reset_player_score_system(r::ecs::ResMut<PlayerScore> score, r::ecs::EventWriter<PlayerStatsChangedEvent> stats_writer)
 {
     score.ptr->value = 0;
     score.ptr->next_life_threshold = 20000;
+    stats_writer.send({});
 }
 
-static void extra_life_system(r::ecs::ResMut<PlayerScore> score, r::ecs::ResMut<PlayerLives> lives)
+/**
+ * @brief Awards a life when the score crosses the next threshold. Only runs on frames where the stats changed.
+ */
+static void extra_life_system(r::ecs::ResMut<PlayerScore> score, r::ecs::ResMut<PlayerLives> lives,
+    r::ecs::EventWriter<PlayerStatsChangedEvent> stats_writer)
 {
     if (score.ptr->value >= score.ptr->next_life_threshold) {
         lives.ptr->count++;
+        stats_writer.send({});
         score.ptr->next_life_threshold += 50000; /* Next life at a higher score */
         r::Logger::info("Extra life awarded! Lives: " + std::to_string(lives.ptr->count)
             + " Next life at: " + std::to_string(score.ptr->next_life_threshold));
     }
 }
 
+static std::uint8_t scopes_of(GameState state)
+{
+    switch (state) {
+        case GameState::MainMenu:
+            return static_cast<std::uint8_t>(GameScope::Menu);
+        case GameState::EnemiesBattle:
+            return static_cast<std::uint8_t>(GameScope::Battle);
+        case GameState::BossBattle:
+            return static_cast<std::uint8_t>(GameScope::Battle) | static_cast<std::uint8_t>(GameScope::Boss);
+        case GameState::Paused:
+            return static_cast<std::uint8_t>(GameScope::Paused);
+        case GameState::OnlineMenu:
+        case GameState::SettingsMenu:
+        case GameState::GameOver:
+        case GameState::YouWin:
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Recomputes ActiveScopes once per state change, so scope conditions never look at the state itself.
+ */
+static void update_active_scopes_system(r::ecs::Res<r::State<GameState>> state, r::ecs::ResMut<ActiveScopes> scopes)
+{
+    scopes.ptr->mask = scopes_of(state.ptr->current());
+}
+
 void GameStatePlugin::build(r::Application &app)
 {
     app.init_state(GameState::MainMenu)
         .insert_resource(PlayerLives{})
         .insert_resource(PlayerScore{})
+        .insert_resource(ActiveScopes{})
+
+        .add_systems<update_active_scopes_system>(r::OnEnter{GameState::MainMenu})
+        .add_systems<update_active_scopes_system>(r::OnEnter{GameState::OnlineMenu})
+        .add_systems<update_active_scopes_system>(r::OnEnter{GameState::SettingsMenu})
+        .add_systems<update_active_scopes_system>(r::OnEnter{GameState::Paused})
+        .add_systems<update_active_scopes_system>(r::OnEnter{GameState::GameOver})
+        .add_systems<update_active_scopes_system>(r::OnEnter{GameState::YouWin})
+        .add_systems<update_active_scopes_system>(r::OnEnter{GameState::EnemiesBattle})
+        .add_systems<update_active_scopes_system>(r::OnEnter{GameState::BossBattle})
 
         .add_systems<reset_player_lives_system>(r::OnTransition{GameState::MainMenu, GameState::EnemiesBattle})
         .add_systems<reset_player_lives_system>(r::OnTransition{GameState::GameOver, GameState::EnemiesBattle})
@@ -115,6 +168,5 @@ void GameStatePlugin::build(r::Application &app)
         .run_if<r::run_conditions::on_event<DebugSwitchLevelEvent>>()
 
         .add_systems<extra_life_system>(r::Schedule::UPDATE)
-        .run_if<r::run_conditions::in_state<GameState::EnemiesBattle>>()
-        .run_or<r::run_conditions::in_state<GameState::BossBattle>>();
+        .run_if<r::run_conditions::on_event<PlayerStatsChangedEvent>>();
 }
@@ -10,13 +10,25 @@
 #include <R-Engine/Plugins/MeshPlugin.hpp>
 #include <R-Engine/Plugins/AudioPlugin.hpp>
 #include <R-Engine/Core/Filepath.hpp>
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
 #include <string>
+#include <vector>
 
 #include <components/common.hpp>
+#include <components/enemy.hpp>
+#include <core/job_pool.hpp>
+#include <core/simd_integrate.hpp>
 #include <events/game_events.hpp>
 #include <resources/assets.hpp>
+#include <resources/frame_memory.hpp>
 #include <resources/game_state.hpp>
 #include <resources/level.hpp>
+#include <resources/level_arena.hpp>
+#include <resources/scripts.hpp>
+#include <resources/targeting.hpp>
+#include <resources/update_tiers.hpp>
 #include <state/game_state.hpp>
 #include <state/run_conditions.hpp>
 
@@ -24,62 +36,69 @@
 /* Gameplay Systems */
 /* ================================================================================= */
 
-static void scoring_system(r::ecs::EventReader<EntityDiedEvent> reader, r::ecs::Query<r::ecs::Ref<ScoreValue>> query,
-    r::ecs::ResMut<PlayerScore> score)
+static void scoring_system(r::ecs::EventReader<EntityDiedEvent> reader, r::ecs::EventWriter<PlayerStatsChangedEvent> stats_writer,
+    r::ecs::Query<r::ecs::Ref<ScoreValue>> query, r::ecs::ResMut<PlayerScore> score)
 {
+    bool scored = false;
     for (const auto &event : reader) {
         for (auto it = query.begin(); it != query.end(); ++it) {
             if (it.entity() == event.entity) {
                 auto [score_value] = *it;
                 score.ptr->value += score_value.ptr->points;
-                r::Logger::info("Score: " + std::to_string(score.ptr->value));
+                scored = true;
                 break;
             }
         }
     }
-}
-
-static void setup_level_timers_system(r::ecs::Res<CurrentLevel> current_level, r::ecs::Res<GameLevels> game_levels,
-    r::ecs::ResMut<EnemySpawnTimer> enemy_timer, r::ecs::ResMut<BossSpawnTimer> boss_timer)
-{
-    const auto &level_data = game_levels.ptr->levels[static_cast<size_t>(current_level.ptr->index)];
-    enemy_timer.ptr->time_left = level_data.enemy_spawn_interval;
-    boss_timer.ptr->time_left = level_data.boss_spawn_time;
-    boss_timer.ptr->spawned = false;
-    r::Logger::info("Setting up timers for level " + std::to_string(level_data.id));
-}
-
-static void setup_boss_fight_system(r::ecs::EventWriter<BossTimeReachedEvent> writer, r::ecs::Res<r::core::FrameTime> time,
-    r::ecs::ResMut<BossSpawnTimer> spawn_timer)
-{
-    if (spawn_timer.ptr->spawned) {
-        return;
-    }
-    spawn_timer.ptr->time_left -= time.ptr->delta_time;
-    if (spawn_timer.ptr->time_left <= 0.0f) {
-        spawn_timer.ptr->spawned = true;
-        writer.send({});
+    if (scored) {
+        stats_writer.send({});
     }
 }
 
-static void movement_system(r::ecs::Res<r::core::FrameTime> time, r::ecs::Query<r::ecs::Mut<r::Transform3d>, r::ecs::Ref<Velocity>> query)
+/**
+ * @brief Integrates every moving entity through the SIMD kernel.
+ * @details Positions and velocities are gathered into packed xyz arrays, integrated in bulk
+ * (in parallel chunks above PARALLEL_FOR_THRESHOLD) and scattered back.
+ */
+static void movement_system(r::ecs::Res<r::core::FrameTime> time, r::ecs::Res<JobPool> jobs, r::ecs::ResMut<FrameMemory> memory,
+    r::ecs::Query<r::ecs::Mut<r::Transform3d>, r::ecs::Ref<Velocity>> query)
 {
+    std::pmr::vector<r::Transform3d *> transforms{memory.ptr->resource()};
+    std::pmr::vector<float> positions{memory.ptr->resource()};
+    std::pmr::vector<float> velocities{memory.ptr->resource()};
+    transforms.reserve(query.size());
+    positions.reserve(query.size() * 3);
+    velocities.reserve(query.size() * 3);
     for (auto [transform, velocity] : query) {
-        transform.ptr->position = transform.ptr->position + velocity.ptr->value * time.ptr->delta_time;
+        transforms.push_back(transform.ptr);
+        positions.insert(positions.end(), {transform.ptr->position.x, transform.ptr->position.y, transform.ptr->position.z});
+        velocities.insert(velocities.end(), {velocity.ptr->value.x, velocity.ptr->value.y, velocity.ptr->value.z});
     }
+
+    const float dt = time.ptr->delta_time;
+    const auto integrate = [&transforms, &positions, &velocities, dt](std::size_t begin, std::size_t end) {
+        integrate_positions(positions.data() + begin * 3, velocities.data() + begin * 3, (end - begin) * 3, dt);
+        for (std::size_t i = begin; i < end; ++i) {
+            transforms[i]->position = {positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]};
+        }
+    };
+
+    if (transforms.size() < PARALLEL_FOR_THRESHOLD) {
+        integrate(0, transforms.size());
+        return;
+    }
+    jobs.ptr->parallel_for(transforms.size(), integrate);
 }
 
 static void setup_missile_assets_system(r::ecs::Commands &commands, r::ecs::ResMut<r::Meshes> meshes)
 {
     BossBulletAssets bullet_assets;
 
-    bullet_assets.big_missile = meshes.ptr->add("assets/models/BigMissiles.glb");
-    if (bullet_assets.big_missile == r::MeshInvalidHandle) {
+    if (!queue_mesh(meshes.ptr, "assets/models/BigMissiles.glb", bullet_assets.big_missile)) {
         r::Logger::error("Failed to queue big missile model !");
     }
 
-    bullet_assets.small_missile = meshes.ptr->add("assets/models/BossRegularMissile.glb");
-    if (bullet_assets.small_missile == r::MeshInvalidHandle) {
+    if (!queue_mesh(meshes.ptr, "assets/models/BossRegularMissile.glb", bullet_assets.small_missile)) {
         r::Logger::error("Failed to queue regular boss missile model !");
     }
 
@@ -92,6 +111,11 @@ struct BackgroundMusicTag {};
 static void setup_background_music_system(r::ecs::Commands &commands, r::ecs::ResMut<r::AudioManager> audio,
     r::ecs::Query<r::ecs::With<BackgroundMusicTag>> existing)
 {
+    /* No audio device on the dedicated server */
+    if (!audio.ptr) {
+        return;
+    }
+
     /* If a background music entity already exists, don't spawn another one. */
     for (auto it = existing.begin(); it != existing.end(); ++it) {
         return;
@@ -127,14 +151,142 @@ static void resume_background_music_system(r::ecs::Query<r::ecs::Mut<r::AudioSin
     }
 }
 
+/* ================================================================================= */
+/* Gameplay Scripts */
+/* ================================================================================= */
+
+SCRIPTS_BEGIN
+
+/**
+ * @brief Level flow: one enemy every `spawn_interval` seconds, then the boss at `boss_time`.
+ */
+static Script level_timeline_script(std::shared_ptr<ScriptWorld> world, float spawn_interval, float boss_time)
+{
+    float elapsed = 0.0f;
+    while (spawn_interval > 0.0f && elapsed + spawn_interval < boss_time) {
+        co_await WaitSeconds{spawn_interval};
+        elapsed += spawn_interval;
+        world->enemy_spawns->send({});
+    }
+    co_await WaitSeconds{boss_time - elapsed};
+    world->boss_time->send({});
+}
+
+SCRIPTS_END
+
+/**
+ * @brief Drops the previous level's scripts and starts the timeline of the current one.
+ */
+static void start_level_timeline_system(r::ecs::Res<CurrentLevel> current_level, r::ecs::Res<GameLevels> game_levels,
+    r::ecs::ResMut<ScriptRunner> scripts)
+{
+    const auto &level_data = game_levels.ptr->levels[static_cast<size_t>(current_level.ptr->index)];
+    scripts.ptr->scheduler.clear();
+    scripts.ptr->scheduler.start(level_timeline_script(scripts.ptr->world, level_data.enemy_spawn_interval, level_data.boss_spawn_time));
+    r::Logger::info("Starting timeline for level " + std::to_string(level_data.id));
+}
+
+/**
+ * @brief Resumes the scripts that are due this tick.
+ * @details The world pointers are only set for the duration of advance(); idle scripts are never touched.
+ */
+static void script_runner_system(r::ecs::Commands &commands, r::ecs::Res<r::core::FrameTime> time, r::ecs::ResMut<ScriptRunner> scripts,
+    r::ecs::ResMut<BattleArena> arena, r::ecs::Res<BossBulletAssets> boss_bullets, r::ecs::EventWriter<EnemySpawnRequestEvent> enemy_spawns,
+    r::ecs::EventWriter<BossTimeReachedEvent> boss_time, BossScriptQuery bosses)
+{
+    ScriptWorld &world = *scripts.ptr->world;
+    world = ScriptWorld{
+        .commands = &commands,
+        .arena = arena.ptr,
+        .boss_bullets = boss_bullets.ptr,
+        .enemy_spawns = &enemy_spawns,
+        .boss_time = &boss_time,
+        .bosses = &bosses,
+    };
+    scripts.ptr->scheduler.advance(time.ptr->delta_time);
+    world = ScriptWorld{};
+}
+
+/**
+ * @brief Turns deaths into script signals and cancels the scripts of dead entities.
+ */
+static void script_signal_system(r::ecs::EventReader<EntityDiedEvent> reader, r::ecs::ResMut<ScriptRunner> scripts,
+    r::ecs::Query<r::ecs::Ref<Health>, r::ecs::With<Shield>> shield_query)
+{
+    bool shield_died = false;
+    for (const auto &event : reader) {
+        scripts.ptr->scheduler.cancel_owner(event.entity);
+        for (auto it = shield_query.begin(); it != shield_query.end(); ++it) {
+            shield_died = shield_died || it.entity() == event.entity;
+        }
+    }
+    if (!shield_died) {
+        return;
+    }
+    for (auto [health, _] : shield_query) {
+        if (health.ptr->current > 0) {
+            return;
+        }
+    }
+    scripts.ptr->scheduler.raise(SIGNAL_SHIELDS_DOWN);
+}
+
+/**
+ * @brief Advances SimulationTick once per battle update (paused and menu frames do not count).
+ */
+static void simulation_tick_system(r::ecs::ResMut<SimulationTick> tick)
+{
+    tick.ptr->value += 1;
+}
+
+/**
+ * @brief Hands the frame scratch memory back, once per frame.
+ * @details Where it runs in UPDATE does not matter: systems only hold arena memory during their own run.
+ */
+static void frame_memory_reset_system(r::ecs::ResMut<FrameMemory> memory)
+{
+    memory.ptr->reset();
+}
+
+/**
+ * @brief Advances the clock of the reduced-rate systems, on every frame of every state.
+ */
+static void update_tiers_system(r::ecs::Res<r::core::FrameTime> time, r::ecs::ResMut<UpdateTiers> tiers)
+{
+    tiers.ptr->advance(time.ptr->delta_time);
+}
+
+/**
+ * @brief Blends every TierInterpolated transform towards the pose its reduced-rate system last computed.
+ */
+static void tier_interpolation_system(r::ecs::Res<r::core::FrameTime> time,
+    r::ecs::Query<r::ecs::Mut<r::Transform3d>, r::ecs::Mut<TierInterpolated>> query)
+{
+    const float dt = time.ptr->delta_time;
+    for (auto [transform, interpolated] : query) {
+        TierInterpolated &blend = *interpolated.ptr;
+        blend.elapsed += dt;
+        const float t = blend.duration > 0.0f ? std::min(blend.elapsed / blend.duration, 1.0f) : 1.0f;
+        transform.ptr->position = blend.from_position + (blend.target_position - blend.from_position) * t;
+        transform.ptr->rotation = blend.from_rotation + (blend.target_rotation - blend.from_rotation) * t;
+    }
+}
+
 void GameplayPlugin::build(r::Application &app)
 {
-    app.insert_resource(EnemySpawnTimer{})
-        .insert_resource(BossSpawnTimer{})
+    app.insert_resource(JobPool{})
+        .insert_resource(SimulationTick{})
+        .insert_resource(ScriptRunner{})
+        .insert_resource(UpdateTiers{})
+        .insert_resource(FrameMemory{})
+
+        .add_systems<frame_memory_reset_system, update_tiers_system>(r::Schedule::UPDATE)
+        .add_systems<tier_interpolation_system>(r::Schedule::UPDATE)
+        .run_if<run_conditions::in_scope<GameScope::Menu, GameScope::Battle>>()
 
-        .add_systems<movement_system>(r::Schedule::UPDATE)
-        .run_if<r::run_conditions::in_state<GameState::EnemiesBattle>>()
-        .run_or<r::run_conditions::in_state<GameState::BossBattle>>()
+        /* The simulation, scripts included, only advances during battle, so paused time never counts */
+        .add_systems<simulation_tick_system, movement_system, script_runner_system>(r::Schedule::UPDATE)
+        .run_if<run_conditions::in_scope<GameScope::Battle>>()
     .add_systems<setup_missile_assets_system>(r::OnEnter{GameState::EnemiesBattle})
     .run_unless<run_conditions::is_resuming_from_pause>()
 
@@ -147,11 +299,11 @@ void GameplayPlugin::build(r::Application &app)
     .add_systems<pause_background_music_system>(r::OnEnter{GameState::MainMenu})
     .add_systems<pause_background_music_system>(r::OnEnter{GameState::SettingsMenu})
 
-        .add_systems<setup_level_timers_system>(r::OnEnter{GameState::EnemiesBattle})
+        .add_systems<start_level_timeline_system>(r::OnEnter{GameState::EnemiesBattle})
         .run_unless<run_conditions::is_resuming_from_pause>()
 
-        .add_systems<setup_boss_fight_system>(r::Schedule::UPDATE)
-        .run_if<r::run_conditions::in_state<GameState::EnemiesBattle>>()
+        .add_systems<script_signal_system>(r::Schedule::UPDATE)
+        .run_if<r::run_conditions::on_event<EntityDiedEvent>>()
 
         .add_systems<scoring_system>(r::Schedule::UPDATE)
         .run_if<r::run_conditions::on_event<EntityDiedEvent>>();
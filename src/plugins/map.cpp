@@ -9,13 +9,25 @@
 #include <R-Engine/Plugins/MeshPlugin.hpp>
 #include <R-Engine/Plugins/RenderPlugin.hpp>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <memory_resource>
+#include <utility>
+#include <vector>
 
+#include <components/common.hpp>
 #include <components/map.hpp>
+#include <core/job_pool.hpp>
+#include <resources/frame_memory.hpp>
 #include <resources/level.hpp>
+#include <resources/level_arena.hpp>
+#include <resources/update_tiers.hpp>
 #include <state/game_state.hpp>
 #include <state/run_conditions.hpp>
 
+static constexpr std::uint32_t ASTEROID_SLICES = 4;
+static constexpr std::uint32_t SCENERY_PERIOD = 2;
+
 static float random_float(float min, float max)
 {
     if (min > max)
@@ -23,8 +35,68 @@ static float random_float(float min, float max)
     return min + static_cast<float>(rand()) / static_cast<float>(RAND_MAX) * (max - min);
 }
 
-static void asteroid_field_system(r::ecs::Res<r::core::FrameTime> time, r::ecs::Res<r::Camera3d> camera,
-    r::ecs::Query<r::ecs::Mut<r::Transform3d>, r::ecs::Ref<Asteroid>> query)
+/**
+ * @brief Screen-space bounds asteroids wrap around, computed once per frame.
+ */
+struct AsteroidBounds {
+        float left;
+        float right;
+        float top;
+        float bottom;
+};
+
+/**
+ * @brief Moves and spins one asteroid. Returns true when it left the field on the left and must
+ * be re-rolled: randomization stays on the calling thread so rand() keeps its serial order.
+ */
+static bool drift_asteroid(r::Transform3d &transform, const Asteroid &asteroid, const AsteroidBounds &bounds, float dt)
+{
+    transform.position += asteroid.velocity * dt;
+
+    transform.rotation.x += asteroid.rotation_speed.x * dt;
+    transform.rotation.y += asteroid.rotation_speed.y * dt;
+    transform.rotation.z += asteroid.rotation_speed.z * dt;
+
+    if (transform.position.x < bounds.left) {
+        transform.position.x = bounds.right;
+        return true;
+    }
+
+    if (transform.position.y > bounds.top) {
+        transform.position.y = bounds.bottom;
+    } else if (transform.position.y < bounds.bottom) {
+        transform.position.y = bounds.top;
+    }
+    return false;
+}
+
+static void respawn_asteroid(r::Transform3d &transform, const AsteroidBounds &bounds)
+{
+    transform.position.y = random_float(bounds.bottom, bounds.top);
+    transform.position.z = random_float(-18.0f, -5.0f);
+}
+
+/**
+ * @brief Hands `target` to the interpolation, starting from the pose on screen. A wrapped entity
+ * jumps straight to its new place instead of sliding across the screen.
+ */
+static void retarget(TierInterpolated &interpolated, const r::Transform3d &shown, const r::Transform3d &target, float duration,
+    bool wrapped)
+{
+    interpolated.from_position = wrapped ? target.position : shown.position;
+    interpolated.from_rotation = wrapped ? target.rotation : shown.rotation;
+    interpolated.target_position = target.position;
+    interpolated.target_rotation = target.rotation;
+    interpolated.elapsed = 0.0f;
+    interpolated.duration = duration;
+}
+
+/**
+ * @brief Drifts the asteroids, time-sliced: each frame only moves 1/ASTEROID_SLICES of them, by
+ * the time their slice was skipped. TierInterpolated keeps them moving on the frames in between.
+ */
+static void asteroid_field_system(r::ecs::Res<UpdateTiers> tiers, r::ecs::Res<r::Camera3d> camera, r::ecs::Res<JobPool> jobs,
+    r::ecs::ResMut<FrameMemory> memory, r::ecs::Query<r::ecs::Mut<r::Transform3d>, r::ecs::Ref<Asteroid>, r::ecs::Mut<TierInterpolated>> query)
 {
     if (query.size() == 0)
         return;
@@ -37,34 +109,59 @@ static void asteroid_field_system(r::ecs::Res<r::core::FrameTime> time, r::ecs::
     const float scroll_area_width = view_width * SCROLL_BUFFER_FACTOR;
     const float scroll_area_height = view_height * SCROLL_BUFFER_FACTOR;
 
-    const float offscreen_limit_left = camera.ptr->position.x - (scroll_area_width / 2.0f);
-    const float offscreen_limit_right = camera.ptr->position.x + (scroll_area_width / 2.0f);
-    const float offscreen_limit_top = camera.ptr->position.y + (scroll_area_height / 2.0f);
-    const float offscreen_limit_bottom = camera.ptr->position.y - (scroll_area_height / 2.0f);
-
-    for (auto [transform, asteroid] : query) {
-        transform.ptr->position += asteroid.ptr->velocity * time.ptr->delta_time;
-
-        transform.ptr->rotation.x += asteroid.ptr->rotation_speed.x * time.ptr->delta_time;
-        transform.ptr->rotation.y += asteroid.ptr->rotation_speed.y * time.ptr->delta_time;
-        transform.ptr->rotation.z += asteroid.ptr->rotation_speed.z * time.ptr->delta_time;
+    const AsteroidBounds bounds = {
+        .left = camera.ptr->position.x - (scroll_area_width / 2.0f),
+        .right = camera.ptr->position.x + (scroll_area_width / 2.0f),
+        .top = camera.ptr->position.y + (scroll_area_height / 2.0f),
+        .bottom = camera.ptr->position.y - (scroll_area_height / 2.0f),
+    };
+    const float dt = tiers.ptr->elapsed(ASTEROID_SLICES);
+    const std::uint32_t slice = tiers.ptr->slice(ASTEROID_SLICES);
+
+    /* Slices follow the query order, which only changes when asteroids are spawned or despawned */
+    const std::size_t expected = query.size() / ASTEROID_SLICES + 1;
+    std::pmr::vector<std::pair<r::Transform3d *, TierInterpolated *>> shown{memory.ptr->resource()};
+    std::pmr::vector<r::Transform3d> targets{memory.ptr->resource()};
+    std::pmr::vector<const Asteroid *> asteroids{memory.ptr->resource()};
+    std::pmr::vector<std::uint8_t> wrapped{memory.ptr->resource()};
+    shown.reserve(expected);
+    targets.reserve(expected);
+    asteroids.reserve(expected);
+    std::uint32_t index = 0;
+    for (auto [transform, asteroid, interpolated] : query) {
+        if (index++ % ASTEROID_SLICES != slice) {
+            continue;
+        }
+        r::Transform3d target = *transform.ptr;
+        target.position = interpolated.ptr->target_position;
+        target.rotation = interpolated.ptr->target_rotation;
+        shown.emplace_back(transform.ptr, interpolated.ptr);
+        targets.push_back(target);
+        asteroids.push_back(asteroid.ptr);
+    }
+    wrapped.assign(targets.size(), 0);
 
-        if (transform.ptr->position.x < offscreen_limit_left) {
-            transform.ptr->position.x = offscreen_limit_right;
-            transform.ptr->position.y = random_float(offscreen_limit_bottom, offscreen_limit_top);
-            transform.ptr->position.z = random_float(-18.0f, -5.0f);
+    const auto drift = [&targets, &asteroids, &wrapped, &bounds, dt](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            wrapped[i] = drift_asteroid(targets[i], *asteroids[i], bounds, dt) ? 1 : 0;
         }
+    };
+    if (targets.size() < PARALLEL_FOR_THRESHOLD) {
+        drift(0, targets.size());
+    } else {
+        jobs.ptr->parallel_for(targets.size(), drift);
+    }
 
-        if (transform.ptr->position.y > offscreen_limit_top) {
-            transform.ptr->position.y = offscreen_limit_bottom;
-        } else if (transform.ptr->position.y < offscreen_limit_bottom) {
-            transform.ptr->position.y = offscreen_limit_top;
+    for (std::size_t i = 0; i < targets.size(); ++i) {
+        if (wrapped[i]) {
+            respawn_asteroid(targets[i], bounds);
         }
+        retarget(*shown[i].second, *shown[i].first, targets[i], dt, wrapped[i] != 0);
     }
 }
 
 static void spawn_scenery_system(r::ecs::Commands &commands, r::ecs::ResMut<r::Meshes> meshes, r::ecs::Res<r::Camera3d> camera,
-    r::ecs::Res<CurrentLevel> current_level, r::ecs::Res<GameLevels> game_levels)
+    r::ecs::Res<CurrentLevel> current_level, r::ecs::Res<GameLevels> game_levels, r::ecs::ResMut<SceneryArena> arena)
 {
     const auto &level_data = game_levels.ptr->levels[static_cast<size_t>(current_level.ptr->index)];
 
@@ -94,21 +191,24 @@ static void spawn_scenery_system(r::ecs::Commands &commands, r::ecs::ResMut<r::M
             float scroll_speed = base_speed - (speed_factor * 4.0f);
             float y_velocity = random_float(-0.5f, 0.5f);
 
-            commands.spawn(
-                Asteroid{
-                    .velocity = {scroll_speed, y_velocity, 0.0f},
-                    .rotation_speed = {random_float(-1.f, 1.f), random_float(-1.f, 1.f), random_float(-1.f, 1.f)},
-                },
-                r::Transform3d{
-                    .position = {x, y, z},
-                    .rotation = {random_float(0.f, 2.f * r::R_PI), random_float(0.f, 2.f * r::R_PI), random_float(0.f, 2.f * r::R_PI)},
-                    .scale = {scale, scale, scale},
-                },
+            const Asteroid drift{
+                .velocity = {scroll_speed, y_velocity, 0.0f},
+                .rotation_speed = {random_float(-1.f, 1.f), random_float(-1.f, 1.f), random_float(-1.f, 1.f)},
+            };
+            const r::Transform3d transform{
+                .position = {x, y, z},
+                .rotation = {random_float(0.f, 2.f * r::R_PI), random_float(0.f, 2.f * r::R_PI), random_float(0.f, 2.f * r::R_PI)},
+                .scale = {scale, scale, scale},
+            };
+
+            auto asteroid = commands.spawn(drift, transform,
+                TierInterpolated{transform.position, transform.rotation, transform.position, transform.rotation},
                 r::Mesh3d{
                     .id = scenery_handle,
                     .color = r::Color{255, 255, 255, 255},
                     .rotation_offset = {0.0f, static_cast<float>(M_PI) / 2.0f, 0.0f},
                 });
+            arena.ptr->track(asteroid.id());
         }
     } else {
         const float building_width = 2.0f;
@@ -124,10 +224,14 @@ static void spawn_scenery_system(r::ecs::Commands &commands, r::ecs::ResMut<r::M
                 const float Y_VARIATION = 3.0f;
                 float random_y = MIN_BUILDING_Y - Y_VARIATION * (static_cast<float>(rand()) / static_cast<float>(RAND_MAX));
 
-                commands.spawn(ScrollingScenery{}, r::Transform3d{.position = {current_x, random_y, -10.0f}, .scale = {2.0f, 2.0f, 2.0f}},
+                const r::Transform3d transform{.position = {current_x, random_y, -10.0f}, .scale = {2.0f, 2.0f, 2.0f}};
+
+                auto building = commands.spawn(ScrollingScenery{}, transform,
+                    TierInterpolated{transform.position, transform.rotation, transform.position, transform.rotation},
                     r::Mesh3d{.id = scenery_handle,
                         .color = r::Color{255, 255, 255, 255},
                         .rotation_offset = {0.0f, static_cast<float>(M_PI) / 2.0f, 0.0f}});
+                arena.ptr->track(building.id());
                 buildings_in_a_row++;
             } else {
                 gap_size--;
@@ -142,7 +246,7 @@ static void spawn_scenery_system(r::ecs::Commands &commands, r::ecs::ResMut<r::M
 }
 
 static void spawn_background_system(r::ecs::Commands &commands, r::ecs::ResMut<r::Meshes> meshes, r::ecs::Res<r::Camera3d> camera,
-    r::ecs::Res<CurrentLevel> current_level, r::ecs::Res<GameLevels> game_levels)
+    r::ecs::Res<CurrentLevel> current_level, r::ecs::Res<GameLevels> game_levels, r::ecs::ResMut<SceneryArena> arena)
 {
     r::Logger::info("spawn_background_system: Running.");
     const auto &level_data = game_levels.ptr->levels[static_cast<size_t>(current_level.ptr->index)];
@@ -162,8 +266,10 @@ static void spawn_background_system(r::ecs::Commands &commands, r::ecs::ResMut<r
         return;
     }
 
-    commands.spawn(Background{}, r::Transform3d{.position = {0.0f, 0.0f, BACKGROUND_Z_DEPTH}, .rotation = {r::R_PI / 2.0f, 0.0f, 0.0f}},
+    auto background = commands.spawn(Background{},
+        r::Transform3d{.position = {0.0f, 0.0f, BACKGROUND_Z_DEPTH}, .rotation = {r::R_PI / 2.0f, 0.0f, 0.0f}},
         r::Mesh3d{.id = background_mesh_handle, .color = r::Color{255, 255, 255, 255}});
+    arena.ptr->track(background.id());
 }
 
 static void follow_camera_background_system(r::ecs::Res<r::Camera3d> camera,
@@ -178,8 +284,31 @@ static void follow_camera_background_system(r::ecs::Res<r::Camera3d> camera,
     }
 }
 
-static void scroll_scenery_system(r::ecs::Res<r::core::FrameTime> time, r::ecs::Res<r::Camera3d> camera,
-    r::ecs::Query<r::ecs::Mut<r::Transform3d>, r::ecs::Ref<ScrollingScenery>> query)
+static bool scroll_building(r::Transform3d &transform, const ScrollingScenery &scenery, float offscreen_limit, float scroll_area_width,
+    float dt)
+{
+    transform.position.x -= scenery.scroll_speed * dt;
+
+    if (transform.position.x < offscreen_limit) {
+        transform.position.x += scroll_area_width;
+        return true;
+    }
+    return false;
+}
+
+static void reroll_building_height(r::Transform3d &transform)
+{
+    const float MIN_BUILDING_Y = -25.0f;
+    const float Y_VARIATION = 3.0f;
+    transform.position.y = MIN_BUILDING_Y - Y_VARIATION * (static_cast<float>(rand()) / static_cast<float>(RAND_MAX));
+}
+
+/**
+ * @brief Scrolls the buildings every SCENERY_PERIOD frames, TierInterpolated fills the frames in between.
+ */
+static void scroll_scenery_system(r::ecs::Res<UpdateTiers> tiers, r::ecs::Res<r::Camera3d> camera, r::ecs::Res<JobPool> jobs,
+    r::ecs::ResMut<FrameMemory> memory,
+    r::ecs::Query<r::ecs::Mut<r::Transform3d>, r::ecs::Ref<ScrollingScenery>, r::ecs::Mut<TierInterpolated>> query)
 {
     if (query.size() == 0)
         return;
@@ -192,46 +321,77 @@ static void scroll_scenery_system(r::ecs::Res<r::core::FrameTime> time, r::ecs::
     const float scroll_area_width = view_width * SCROLL_BUFFER_FACTOR;
 
     const float offscreen_limit = camera.ptr->position.x - (scroll_area_width / 2.0f);
+    const float dt = tiers.ptr->elapsed(SCENERY_PERIOD);
+
+    std::pmr::vector<std::pair<r::Transform3d *, TierInterpolated *>> shown{memory.ptr->resource()};
+    std::pmr::vector<r::Transform3d> targets{memory.ptr->resource()};
+    std::pmr::vector<const ScrollingScenery *> buildings{memory.ptr->resource()};
+    std::pmr::vector<std::uint8_t> wrapped{memory.ptr->resource()};
+    shown.reserve(query.size());
+    targets.reserve(query.size());
+    buildings.reserve(query.size());
+    for (auto [transform, scenery, interpolated] : query) {
+        r::Transform3d target = *transform.ptr;
+        target.position = interpolated.ptr->target_position;
+        target.rotation = interpolated.ptr->target_rotation;
+        shown.emplace_back(transform.ptr, interpolated.ptr);
+        targets.push_back(target);
+        buildings.push_back(scenery.ptr);
+    }
+    wrapped.assign(targets.size(), 0);
 
-    for (auto [transform, scenery] : query) {
-        transform.ptr->position.x -= scenery.ptr->scroll_speed * time.ptr->delta_time;
+    const auto scroll = [&targets, &buildings, &wrapped, offscreen_limit, scroll_area_width, dt](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            wrapped[i] = scroll_building(targets[i], *buildings[i], offscreen_limit, scroll_area_width, dt) ? 1 : 0;
+        }
+    };
+    if (targets.size() < PARALLEL_FOR_THRESHOLD) {
+        scroll(0, targets.size());
+    } else {
+        jobs.ptr->parallel_for(targets.size(), scroll);
+    }
 
-        if (transform.ptr->position.x < offscreen_limit) {
-            transform.ptr->position.x += scroll_area_width;
-            const float MIN_BUILDING_Y = -25.0f;
-            const float Y_VARIATION = 3.0f;
-            transform.ptr->position.y = MIN_BUILDING_Y - Y_VARIATION * (static_cast<float>(rand()) / static_cast<float>(RAND_MAX));
+    for (std::size_t i = 0; i < targets.size(); ++i) {
+        if (wrapped[i]) {
+            reroll_building_height(targets[i]);
         }
+        retarget(*shown[i].second, *shown[i].first, targets[i], dt, wrapped[i] != 0);
     }
 }
 
-static void cleanup_map_system(r::ecs::Commands &commands, r::ecs::Query<r::ecs::With<Background>> background_query,
-    r::ecs::Query<r::ecs::With<ScrollingScenery>> scenery_query, r::ecs::Query<r::ecs::With<Asteroid>> asteroid_query)
+/**
+ * @brief Releases the previous scenery in one pass over the SceneryArena, then reserves room for the next one.
+ * @details Registered before the spawn systems on the same OnEnter so freshly spawned scenery is never released.
+ */
+static void cleanup_map_system(r::ecs::Commands &commands, r::ecs::ResMut<SceneryArena> arena, r::ecs::Res<CurrentLevel> current_level,
+    r::ecs::Res<GameLevels> game_levels)
 {
-    for (auto it = background_query.begin(); it != background_query.end(); ++it) {
-        commands.despawn(it.entity());
-    }
-    for (auto it = scenery_query.begin(); it != scenery_query.end(); ++it) {
-        commands.despawn(it.entity());
-    }
-    for (auto it = asteroid_query.begin(); it != asteroid_query.end(); ++it) {
-        commands.despawn(it.entity());
+    for (const r::ecs::Entity entity : *arena.ptr) {
+        commands.despawn(entity);
     }
+    arena.ptr->clear();
+
+    const auto &level_data = game_levels.ptr->levels[static_cast<size_t>(current_level.ptr->index)];
+    arena.ptr->reserve(level_data.capacity.scenery_entities);
 }
 
 void MapPlugin::build(r::Application &app)
 {
-    app.add_systems<cleanup_map_system>(r::OnEnter{GameState::MainMenu})
+    app.insert_resource(SceneryArena{})
+
+        .add_systems<cleanup_map_system>(r::OnEnter{GameState::MainMenu})
         .add_systems<cleanup_map_system>(r::OnEnter{GameState::EnemiesBattle})
         .run_unless<run_conditions::is_resuming_from_pause>()
 
         .add_systems<spawn_scenery_system>(r::OnEnter{GameState::MainMenu})
         .add_systems<spawn_background_system>(r::OnEnter{GameState::MainMenu})
 
-        .add_systems<follow_camera_background_system, scroll_scenery_system, asteroid_field_system>(r::Schedule::UPDATE)
-        .run_if<r::run_conditions::in_state<GameState::MainMenu>>()
-        .run_or<r::run_conditions::in_state<GameState::EnemiesBattle>>()
-        .run_or<r::run_conditions::in_state<GameState::BossBattle>>()
+        /* Cosmetic only. The scenery scrolls at a reduced rate; the background stays glued to the camera, so it follows every frame */
+        .add_systems<asteroid_field_system, follow_camera_background_system>(r::Schedule::UPDATE)
+        .run_if<run_conditions::in_scope<GameScope::Menu, GameScope::Battle>>()
+        .add_systems<scroll_scenery_system>(r::Schedule::UPDATE)
+        .run_if<run_conditions::in_scope<GameScope::Menu, GameScope::Battle>>()
+        .run_and<run_conditions::every_n_frames<SCENERY_PERIOD>>()
 
         .add_systems<spawn_scenery_system>(r::OnEnter{GameState::EnemiesBattle})
         .run_unless<run_conditions::is_resuming_from_pause>()
@@ -16,13 +16,19 @@
 #include <R-Engine/UI/InputState.hpp>
 #include <R-Engine/UI/Text.hpp>
 #include <R-Engine/UI/Theme.hpp>
+#include <array>
+#include <charconv>
+#include <string>
+#include <string_view>
 
 #include <components/player.hpp>
 #include <components/ui.hpp>
+#include <events/game_events.hpp>
 #include <resources/game_mode.hpp>
 #include <resources/game_state.hpp>
 #include <resources/ui_state.hpp>
 #include <state/game_state.hpp>
+#include <state/run_conditions.hpp>
 
 /* ================================================================================= */
 /* Menu Systems :: Helpers */
@@ -66,7 +72,7 @@ static void create_menu_button(r::ecs::ChildBuilder &parent, MenuButton::Action
 /* HUD Systems */
 /* ================================================================================= */
 
-static void build_game_hud(r::ecs::Commands &cmds)
+static void build_game_hud(r::ecs::Commands &cmds, r::ecs::Res<PlayerScore> score, r::ecs::Res<PlayerLives> lives)
 {
     cmds.spawn(HudRoot{}, r::UiNode{},
             r::Style{
@@ -84,7 +90,7 @@ static void build_game_hud(r::ecs::Commands &cmds)
         .with_children([&](r::ecs::ChildBuilder &parent) {
             parent.spawn(r::UiNode{}, ScoreText{},
                 r::UiText{
-                    .content = "Score: 0",
+                    .content = "Score: " + std::to_string(score.ptr->value),
                     .font_size = 20,
                     .color = {255, 255, 255, 255},
                     .font_path = {},
@@ -96,7 +102,7 @@ static void build_game_hud(r::ecs::Commands &cmds)
                 r::ComputedLayout{}, r::Visibility::Visible);
             parent.spawn(r::UiNode{}, LivesText{},
                 r::UiText{
-                    .content = "Lives: 3",
+                    .content = "Lives: " + std::to_string(lives.ptr->count),
                     .font_size = 20,
                     .color = {255, 255, 255, 255},
                     .font_path = {},
@@ -110,15 +116,32 @@ static void build_game_hud(r::ecs::Commands &cmds)
         });
 }
 
+/**
+ * @brief Overwrites `text` with `label` followed by `value`.
+ * @details Formats on the stack and assigns in place, so the string keeps its capacity and a HUD
+ * refresh does not allocate once the texts have grown to their final length.
+ */
+template<typename T>
+static void write_counter(std::string &text, std::string_view label, T value)
+{
+    std::array<char, 32> digits{}; /* Fits any integer, to_chars cannot run out of room */
+    const char *end = std::to_chars(digits.data(), digits.data() + digits.size(), value).ptr;
+    text.assign(label);
+    text.append(digits.data(), end);
+}
+
+/**
+ * @brief Rewrites the HUD texts. Only runs on frames carrying a PlayerStatsChangedEvent.
+ */
 static void update_game_hud(r::ecs::Res<PlayerScore> score, r::ecs::Res<PlayerLives> lives,
     r::ecs::Query<r::ecs::Mut<r::UiText>, r::ecs::With<ScoreText>> score_query,
     r::ecs::Query<r::ecs::Mut<r::UiText>, r::ecs::With<LivesText>> lives_query)
 {
     for (auto [text, _] : score_query) {
-        text.ptr->content = "Score: " + std::to_string(score.ptr->value);
+        write_counter(text.ptr->content, "Score: ", score.ptr->value);
     }
     for (auto [text, _] : lives_query) {
-        text.ptr->content = "Lives: " + std::to_string(lives.ptr->count);
+        write_counter(text.ptr->content, "Lives: ", lives.ptr->count);
     }
 }
 
@@ -654,8 +677,7 @@ void MenuPlugin::build(r::Application &app)
         .add_systems<build_game_hud>(r::OnEnter{GameState::EnemiesBattle})
         .add_systems<build_game_hud>(r::OnEnter{GameState::BossBattle})
         .add_systems<update_game_hud>(r::Schedule::UPDATE)
-        .run_if<r::run_conditions::in_state<GameState::EnemiesBattle>>()
-        .run_or<r::run_conditions::in_state<GameState::BossBattle>>()
+        .run_if<r::run_conditions::on_event<PlayerStatsChangedEvent>>()
         .add_systems<cleanup_game_hud>(r::OnExit{GameState::EnemiesBattle})
         .add_systems<cleanup_game_hud>(r::OnExit{GameState::BossBattle})
 
@@ -672,5 +694,5 @@ void MenuPlugin::build(r::Application &app)
         .run_if<r::run_conditions::in_state<GameState::YouWin>>()
 
         .add_systems<camera_follow_player_system>(r::Schedule::UPDATE)
-        .run_if<r::run_conditions::in_state<GameState::MainMenu>>();
+        .run_if<run_conditions::in_scope<GameScope::Menu>>();
 }
@@ -0,0 +1,267 @@
+#include "plugins/particles.hpp"
+#include "R-Engine/Components/Transform3d.hpp"
+#include <R-Engine/Application.hpp>
+#include <R-Engine/Core/Backend.hpp>
+#include <R-Engine/Core/FrameTime.hpp>
+#include <R-Engine/Core/Logger.hpp>
+#include <R-Engine/Core/States.hpp>
+#include <R-Engine/ECS/Event.hpp>
+#include <R-Engine/ECS/Query.hpp>
+#include <R-Engine/ECS/RunConditions.hpp>
+#include <algorithm>
+#include <array>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
+
+#include <components/common.hpp>
+#include <components/enemy.hpp>
+#include <components/projectiles.hpp>
+#include <core/job_pool.hpp>
+#include <events/game_events.hpp>
+#include <resources/frame_memory.hpp>
+#include <resources/particles.hpp>
+#include <state/game_state.hpp>
+#include <state/run_conditions.hpp>
+
+static constexpr float PARTICLE_DAMPING = 0.15f; /* Fraction of its velocity a particle keeps after one second */
+
+static constexpr std::uint8_t kind_index(ParticleKind kind)
+{
+    return static_cast<std::uint8_t>(kind);
+}
+
+/* ================================================================================= */
+/* Emitters */
+/* ================================================================================= */
+
+/**
+ * @brief Bursts embers where an Enemy, Boss or Shield died. Runs before the despawn is applied, like the explosion sound.
+ */
+static void explosion_particles_system(r::ecs::EventReader<EntityDiedEvent> reader, r::ecs::ResMut<FrameMemory> memory,
+    r::ecs::ResMut<Particles> particles,
+    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::With<Enemy>> enemy_query,
+    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::With<Boss>> boss_query,
+    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::With<Shield>> shield_query)
+{
+    std::pmr::vector<r::ecs::Entity> dead{memory.ptr->resource()};
+    for (const auto &event : reader) {
+        dead.push_back(event.entity);
+    }
+
+    ParticlePool &pool = particles.ptr->edit();
+    const auto burst_at = [&](const r::Vec3f &position, std::size_t count, float speed) {
+        pool.emit({position, count, speed * 0.25f, speed, 0.9f, 0.12f, 0xFF9A2EFFu, kind_index(ParticleKind::Ember)});
+        pool.emit({position, count / 2, speed * 0.5f, speed * 1.5f, 0.4f, 0.06f, 0xFFF2B0FFu, kind_index(ParticleKind::Spark)});
+    };
+
+    for (auto it = enemy_query.begin(); it != enemy_query.end(); ++it) {
+        if (std::ranges::find(dead, it.entity()) != dead.end()) {
+            auto [transform, _e] = *it;
+            burst_at(transform.ptr->position, 96, 6.0f);
+        }
+    }
+    for (auto it = boss_query.begin(); it != boss_query.end(); ++it) {
+        if (std::ranges::find(dead, it.entity()) != dead.end()) {
+            auto [transform, _b] = *it;
+            burst_at(transform.ptr->position, 2048, 12.0f);
+        }
+    }
+    for (auto it = shield_query.begin(); it != shield_query.end(); ++it) {
+        if (std::ranges::find(dead, it.entity()) != dead.end()) {
+            auto [transform, _s] = *it;
+            burst_at(transform.ptr->position, 256, 8.0f);
+        }
+    }
+}
+
+/**
+ * @brief A few sparks on every entity that took damage.
+ */
+static void hit_sparks_system(r::ecs::EventReader<HealthChangedEvent> reader, r::ecs::ResMut<FrameMemory> memory,
+    r::ecs::ResMut<Particles> particles,
+    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::With<Health>> query)
+{
+    std::pmr::vector<r::ecs::Entity> hit{memory.ptr->resource()};
+    for (const auto &event : reader) {
+        hit.push_back(event.entity);
+    }
+
+    ParticlePool &pool = particles.ptr->edit();
+    for (auto it = query.begin(); it != query.end(); ++it) {
+        /* Several hits on the same tick make a bigger shower */
+        const auto hits = static_cast<std::size_t>(std::ranges::count(hit, it.entity()));
+        if (hits > 0) {
+            auto [transform, _h] = *it;
+            pool.emit({transform.ptr->position, 16 * hits, 3.0f, 9.0f, 0.25f, 0.05f, 0xFFE680FFu,
+                kind_index(ParticleKind::Spark)});
+        }
+    }
+}
+
+/**
+ * @brief Leaves a short-lived trail behind every wave cannon beam, denser for charged shots.
+ */
+static void beam_trail_system(r::ecs::ResMut<Particles> particles,
+    r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Ref<WaveCannonBeam>> query)
+{
+    ParticlePool &pool = particles.ptr->edit();
+    for (auto [transform, beam] : query) {
+        const auto count = static_cast<std::size_t>(4.0f + 12.0f * beam.ptr->charge_level);
+        pool.emit({transform.ptr->position, count, 0.0f, 1.5f, 0.3f, 0.08f, 0x66CCFFFFu, kind_index(ParticleKind::Trail)});
+    }
+}
+
+/* ================================================================================= */
+/* Simulation */
+/* ================================================================================= */
+
+/**
+ * @brief Body of the simulation job: steps the pool and exports the next render snapshot.
+ */
+static void simulate_particles(void *context)
+{
+    auto &particles = *static_cast<Particles *>(context);
+    particles.pool.update(particles.step, PARTICLE_DAMPING, particles.jobs);
+    particles.pool.build_instances(particles.instances.back());
+}
+
+/**
+ * @brief Joins the simulation job launched last frame and publishes its snapshot. First particle system of the frame.
+ */
+static void particle_sync_system(r::ecs::ResMut<Particles> particles)
+{
+    particles.ptr->simulation.wait();
+    particles.ptr->instances.publish();
+}
+
+/**
+ * @brief Starts stepping the particles for the next frame, overlapping with this frame's rendering.
+ * @details Registered after the emitters so it sees every particle emitted this frame.
+ */
+static void particle_launch_system(r::ecs::Res<r::core::FrameTime> time, r::ecs::Res<JobPool> jobs, r::ecs::ResMut<Particles> particles)
+{
+    particles.ptr->step = time.ptr->delta_time;
+    particles.ptr->jobs = jobs.ptr;
+    particles.ptr->simulation.launch(simulate_particles, particles.ptr);
+}
+
+static void clear_particles_system(r::ecs::ResMut<Particles> particles)
+{
+    particles.ptr->edit().clear();
+    /* Empty both snapshots, the next sync would otherwise bring the old front back */
+    for (int i = 0; i < 2; ++i) {
+        particles.ptr->instances.back().assign(static_cast<std::size_t>(ParticleKind::Count), {});
+        particles.ptr->instances.publish();
+    }
+}
+
+/* ================================================================================= */
+/* Rendering */
+/* ================================================================================= */
+
+/* The pool exports raylib matrices, so its lists go to DrawMeshInstanced as they are; raylib still copies each one through MatrixToFloatV */
+static_assert(sizeof(ParticlePool::Instance) == sizeof(::Matrix) && std::is_standard_layout_v<ParticlePool::Instance>);
+
+/* The default raylib shader has no instance attribute: this one takes the model matrix per instance, and the colour out of its bottom row */
+static constexpr const char *PARTICLE_VERTEX_SHADER = R"(#version 330
+in vec3 vertexPosition;
+in mat4 instanceTransform;
+uniform mat4 mvp;
+out vec4 fragColor;
+void main()
+{
+    mat4 model = instanceTransform;
+    fragColor = vec4(model[0][3], model[1][3], model[2][3], model[3][3]);
+    model[0][3] = 0.0;
+    model[1][3] = 0.0;
+    model[2][3] = 0.0;
+    model[3][3] = 1.0;
+    gl_Position = mvp * model * vec4(vertexPosition, 1.0);
+}
+)";
+
+static constexpr const char *PARTICLE_FRAGMENT_SHADER = R"(#version 330
+in vec4 fragColor;
+out vec4 finalColor;
+void main()
+{
+    finalColor = fragColor;
+}
+)";
+
+/**
+ * @brief GPU side of the particles: one unit mesh per kind and the instancing material drawing them.
+ * @details Loaded by the first draw, once the window and its GL context exist.
+ */
+struct ParticleMeshes {
+        std::array<::Mesh, static_cast<std::size_t>(ParticleKind::Count)> meshes{};
+        ::Material material{};
+        bool loaded = false;
+        bool usable = false;
+};
+
+static void load_particle_meshes(ParticleMeshes &gpu)
+{
+    gpu.loaded = true;
+    ::Shader shader = LoadShaderFromMemory(PARTICLE_VERTEX_SHADER, PARTICLE_FRAGMENT_SHADER);
+    const int instance_location = GetShaderLocationAttrib(shader, "instanceTransform");
+    if (instance_location < 0) {
+        r::Logger::error("Particle instancing shader failed to load, particles will not be drawn");
+        return;
+    }
+    shader.locs[SHADER_LOC_MATRIX_MVP] = GetShaderLocation(shader, "mvp");
+    shader.locs[SHADER_LOC_MATRIX_MODEL] = instance_location;
+
+    /* Unit meshes, scaled by each particle's size: edge for cubes, radius for spheres */
+    gpu.meshes[kind_index(ParticleKind::Spark)] = GenMeshCube(1.0f, 1.0f, 1.0f);
+    gpu.meshes[kind_index(ParticleKind::Trail)] = GenMeshCube(1.0f, 1.0f, 1.0f);
+    gpu.meshes[kind_index(ParticleKind::Ember)] = GenMeshSphere(1.0f, 3, 4);
+    gpu.material = LoadMaterialDefault();
+    gpu.material.shader = shader;
+    gpu.usable = true;
+}
+
+/**
+ * @brief Draws the published snapshot: one DrawMeshInstanced call per kind, whatever the number of particles.
+ */
+static void particle_render_system(r::ecs::Res<Particles> particles, r::ecs::ResMut<ParticleMeshes> gpu)
+{
+    if (!gpu.ptr->loaded) {
+        load_particle_meshes(*gpu.ptr);
+    }
+    if (!gpu.ptr->usable) {
+        return;
+    }
+    const ParticlePool::InstanceLists &lists = particles.ptr->instances.front();
+    for (std::size_t kind = 0; kind < lists.size(); ++kind) {
+        const std::vector<ParticlePool::Instance> &list = lists[kind];
+        if (!list.empty()) {
+            DrawMeshInstanced(gpu.ptr->meshes[kind], gpu.ptr->material, reinterpret_cast<const ::Matrix *>(list.data()),
+                static_cast<int>(list.size()));
+        }
+    }
+}
+
+void ParticlesPlugin::build(r::Application &app)
+{
+    app.insert_resource(Particles{})
+        .insert_resource(ParticleMeshes{})
+
+        .add_systems<clear_particles_system>(r::OnEnter{GameState::EnemiesBattle})
+        .run_unless<run_conditions::is_resuming_from_pause>()
+
+        .add_systems<particle_sync_system>(r::Schedule::UPDATE)
+        .run_if<run_conditions::in_scope<GameScope::Battle>>()
+
+        .add_systems<explosion_particles_system>(r::Schedule::UPDATE)
+        .run_if<r::run_conditions::on_event<EntityDiedEvent>>()
+        .add_systems<hit_sparks_system>(r::Schedule::UPDATE)
+        .run_if<r::run_conditions::on_event<HealthChangedEvent>>()
+
+        .add_systems<beam_trail_system, particle_launch_system>(r::Schedule::UPDATE)
+        .run_if<run_conditions::in_scope<GameScope::Battle>>()
+
+        .add_systems<particle_render_system>(r::Schedule::RENDER_3D)
+        .run_if<run_conditions::in_scope<GameScope::Battle>>();
+}
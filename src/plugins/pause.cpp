@@ -15,6 +15,7 @@
 #include <components/ui.hpp>
 #include <resources/ui_state.hpp>
 #include <state/game_state.hpp>
+#include <state/run_conditions.hpp>
 #include <string>
 
 static void build_pause_menu(r::ecs::Commands &cmds)
@@ -113,9 +114,8 @@ void PausePlugin::build(r::Application &app)
         .add_systems<build_pause_menu>(r::OnEnter{GameState::Paused})
         .add_systems<cleanup_pause_menu>(r::OnExit{GameState::Paused})
         .add_systems<pause_menu_button_handler>(r::Schedule::UPDATE)
-        .run_if<r::run_conditions::in_state<GameState::Paused>>()
+        .run_if<run_conditions::in_scope<GameScope::Paused>>()
         .run_if<r::run_conditions::on_event<r::UiClick>>()
         .add_systems<check_for_pause_system>(r::Schedule::UPDATE)
-        .run_if<r::run_conditions::in_state<GameState::EnemiesBattle>>()
-        .run_or<r::run_conditions::in_state<GameState::BossBattle>>();
+        .run_if<run_conditions::in_scope<GameScope::Battle>>();
 }
@@ -15,13 +15,17 @@
 #include <R-Engine/Core/Filepath.hpp>
 #include <algorithm>
 #include <cmath>
+#include <utility>
 
 #include <components/common.hpp>
 #include <components/player.hpp>
 #include <components/projectiles.hpp>
+#include <core/messages.hpp>
 #include <plugins/rtype_protocol_plugin.hpp>
 #include <resources/assets.hpp>
 #include <resources/game_mode.hpp>
+#include <resources/level_arena.hpp>
+#include <resources/targeting.hpp>
 #include <state/game_state.hpp>
 #include <state/run_conditions.hpp>
 #include <plugins/ui_sfx.hpp>
@@ -43,6 +47,7 @@ static constexpr float PLAYER_FIRE_RATE = 0.45f;
 static constexpr float PLAYER_BOUNDS_PADDING = 0.5f;
 static constexpr float WAVE_CANNON_CHARGE_START_DELAY = 0.2f;
 static constexpr float FORCE_FRONT_OFFSET_X = 1.75f;
+static constexpr float FORCE_SCALE = 0.3f; /* Relative to the owner's scale */
 
 namespace {
 enum PlayerInput : uint8_t {
@@ -57,20 +62,27 @@ enum PlayerInput : uint8_t {
 /* Player Systems :: Helpers */
 /* ================================================================================= */
 
-static void spawn_player_force(r::ecs::ChildBuilder &parent, r::ecs::ResMut<r::Meshes> &meshes, r::ecs::Entity owner_id)
+/**
+ * @brief Spawns the Force as a top-level entity in front of its owner.
+ * @details It is not parented to the player: ForcePlugin moves it according to Force::state, so
+ * launching and recalling never add or remove components.
+ */
+static void spawn_player_force(r::ecs::Commands &commands, r::ecs::ResMut<r::Meshes> &meshes, r::ecs::Entity owner_id,
+    const r::Transform3d &owner_transform)
 {
-    r::MeshHandle force_mesh_handle = meshes.ptr->add("assets/models/force.glb");
-    if (force_mesh_handle != r::MeshInvalidHandle) {
-        parent.spawn(
+    r::MeshHandle force_mesh_handle = r::MeshInvalidHandle;
+    if (queue_mesh(meshes.ptr, "assets/models/force.glb", force_mesh_handle)) {
+        commands.spawn(
             Force{
-                .is_attached = true,
+                .state = Force::State::Attached,
                 .is_front_attachment = true,
                 .owner = owner_id,
             },
             FireCooldown{},
+            Velocity{{0.0f, 0.0f, 0.0f}},
             r::Transform3d{
-                .position = {FORCE_FRONT_OFFSET_X, 0.0f, 0.0f},
-                .scale = {0.3f, 0.3f, 0.3f},
+                .position = owner_transform.position + r::Vec3f{FORCE_FRONT_OFFSET_X * owner_transform.scale.x, 0.0f, 0.0f},
+                .scale = owner_transform.scale * FORCE_SCALE,
             },
             Collider{
                 .radius = 1.0f,
@@ -86,10 +98,11 @@ static void spawn_player_force(r::ecs::ChildBuilder &parent, r::ecs::ResMut<r::M
 }
 
 static void fire_standard_shot(r::ecs::Commands &commands, r::ecs::ResMut<PlayerBulletAssets> &bullet_assets,
-    r::ecs::Ref<r::Transform3d> transform, r::ecs::Res<PlayerSfxHandles> sfx, r::ecs::Res<UiSfxCounter> counter)
+    r::ecs::ResMut<BattleArena> &arena, r::ecs::Ref<r::Transform3d> transform, r::ecs::Res<PlayerSfxHandles> sfx,
+    r::ecs::Res<UiSfxCounter> counter)
 {
     /* --- Firing --- */
-    commands.spawn(PlayerBullet{},
+    auto bullet = commands.spawn(PlayerBullet{},
         r::Transform3d{
             .position = transform.ptr->position + r::Vec3f{0.6f, 0.0f, 0.0f},
             .scale = {0.2f, 0.2f, 0.2f},
@@ -100,6 +113,7 @@ static void fire_standard_shot(r::ecs::Commands &commands, r::ecs::ResMut<Player
             .color = r::Color{255, 255, 255, 255}, /* Yellow color for bullets */
             .rotation_offset = {-(static_cast<float>(M_PI) / 2.0f), 0.0f, -static_cast<float>(M_PI) / 2.0f},
         });
+    arena.ptr->track(bullet.id());
 
         /* Play launch SFX when a standard missile is spawned */
         if (sfx.ptr && sfx.ptr->launch != r::AudioInvalidHandle) {
@@ -110,8 +124,8 @@ static void fire_standard_shot(r::ecs::Commands &commands, r::ecs::ResMut<Player
 }
 
 
-static void fire_wave_cannon(r::ecs::Commands &commands, r::ecs::ResMut<r::Meshes> &meshes, r::ecs::Ref<r::Transform3d> transform,
-    float charge_timer, r::ecs::Res<PlayerSfxHandles> sfx, r::ecs::Res<UiSfxCounter> counter)
+static void fire_wave_cannon(r::ecs::Commands &commands, r::ecs::ResMut<r::Meshes> &meshes, r::ecs::ResMut<BattleArena> &arena,
+    r::ecs::Ref<r::Transform3d> transform, float charge_timer, r::ecs::Res<PlayerSfxHandles> sfx, r::ecs::Res<UiSfxCounter> counter)
 {
     float charge_duration = charge_timer - WAVE_CANNON_CHARGE_START_DELAY;
     charge_duration = std::min(charge_duration, 2.0f); /* Max charge of 2s */
@@ -123,7 +137,7 @@ static void fire_wave_cannon(r::ecs::Commands &commands, r::ecs::ResMut<r::Meshe
     if (beam_mesh_data.vertexCount > 0) {
         r::MeshHandle beam_mesh_handle = meshes.ptr->add(std::move(beam_mesh_data));
         if (beam_mesh_handle != r::MeshInvalidHandle) {
-            commands.spawn(
+            auto beam = commands.spawn(
                 WaveCannonBeam{
                     .charge_level = charge_duration,
                     .damage = damage,
@@ -136,10 +150,15 @@ static void fire_wave_cannon(r::ecs::Commands &commands, r::ecs::ResMut<r::Meshe
                 Collider{
                     .radius = 0.2f * size_multiplier,
                 },
+                /* Matches the 2.5 x 0.4 cube: a 0.2 radius capsule spanning its length */
+                CapsuleCollider{
+                    .half_axis = {(1.25f - 0.2f) * size_multiplier, 0.0f, 0.0f},
+                },
                 r::Mesh3d{
                     .id = beam_mesh_handle,
                     .color = r::Color{98, 221, 255, 255}, /* R-Type cyan */
                 });
+            arena.ptr->track(beam.id());
             /* Play laser SFX at the same moment the beam is spawned (on release). */
             if (sfx.ptr && sfx.ptr->laser != r::AudioInvalidHandle) {
                 commands.spawn(UiSfxTag{}, UiSfxBorn{counter.ptr->frame}, r::AudioPlayer{sfx.ptr->laser}, r::AudioSink{});
@@ -173,7 +192,8 @@ static void handle_player_movement(r::ecs::Mut<Velocity> &velocity, r::ecs::Res<
 
 static void handle_player_firing(r::ecs::Commands &commands, r::ecs::ResMut<r::Meshes> &meshes, r::ecs::Res<r::core::FrameTime> const &time,
     r::ecs::Ref<r::Transform3d> transform, r::ecs::Mut<FireCooldown> cooldown, r::ecs::Mut<Player> player,
-    r::ecs::ResMut<PlayerBulletAssets> &bullet_assets, bool is_fire_pressed, r::ecs::Res<PlayerSfxHandles> sfx, r::ecs::Res<UiSfxCounter> counter)
+    r::ecs::ResMut<PlayerBulletAssets> &bullet_assets, r::ecs::ResMut<BattleArena> &arena, bool is_fire_pressed,
+    r::ecs::Res<PlayerSfxHandles> sfx, r::ecs::Res<UiSfxCounter> counter)
 {
     if (cooldown.ptr->timer > 0.0f) {
         cooldown.ptr->timer -= time.ptr->delta_time;
@@ -184,11 +204,11 @@ static void handle_player_firing(r::ecs::Commands &commands, r::ecs::ResMut<r::M
 
             if (player.ptr->wave_cannon_charge_timer < WAVE_CANNON_CHARGE_START_DELAY && cooldown.ptr->timer <= 0.0f) {
             cooldown.ptr->timer = PLAYER_FIRE_RATE;
-            fire_standard_shot(commands, bullet_assets, transform, sfx, counter);
+            fire_standard_shot(commands, bullet_assets, arena, transform, sfx, counter);
         }
     } else { /* Fire button was released */
         if (player.ptr->wave_cannon_charge_timer >= WAVE_CANNON_CHARGE_START_DELAY) {
-            fire_wave_cannon(commands, meshes, transform, player.ptr->wave_cannon_charge_timer, sfx, counter);
+            fire_wave_cannon(commands, meshes, arena, transform, player.ptr->wave_cannon_charge_timer, sfx, counter);
         }
         player.ptr->wave_cannon_charge_timer = 0.0f; /* Reset timer on release */
     }
@@ -208,9 +228,10 @@ static void connect_to_server_on_join_system(r::ecs::EventWriter<r::net::Network
 
 static void spawn_player_system(r::ecs::Commands &commands, r::ecs::ResMut<r::Meshes> meshes)
 {
-    r::MeshHandle player_mesh_handle = meshes.ptr->add("assets/models/R-9.glb");
-    if (player_mesh_handle != r::MeshInvalidHandle) {
-        auto player_cmds = commands.spawn(Player{}, r::Transform3d{.position = {-5.0f, 0.0f, 0.0f}, .scale = {3.0f, 3.0f, 3.0f}},
+    r::MeshHandle player_mesh_handle = r::MeshInvalidHandle;
+    if (queue_mesh(meshes.ptr, "assets/models/R-9.glb", player_mesh_handle)) {
+        const r::Transform3d player_transform = {.position = {-5.0f, 0.0f, 0.0f}, .scale = {3.0f, 3.0f, 3.0f}};
+        auto player_cmds = commands.spawn(Player{}, player_transform,
             Velocity{{0.0f, 0.0f, 0.0f}},
             Collider{
                 .radius = 0.8f,
@@ -222,39 +243,26 @@ static void spawn_player_system(r::ecs::Commands &commands, r::ecs::ResMut<r::Me
                 .color = r::Color{255, 255, 255, 255},
                 .rotation_offset = {0.0f, static_cast<float>(M_PI) / 2.0f, 0.0f},
             });
-        player_cmds.with_children([&](r::ecs::ChildBuilder &parent) { spawn_player_force(parent, meshes, player_cmds.id()); });
+        spawn_player_force(commands, meshes, player_cmds.id(), player_transform);
     } else {
         r::Logger::error("Failed to queue player model for loading: assets/models/R-9.glb");
     }
 }
 
-static r::ecs::Entity find_force_entity_in_children(const r::ecs::Children &children, r::ecs::Query<r::ecs::With<Force>> &is_force_query)
+static void link_force_to_player_system(r::ecs::Query<r::ecs::Mut<Player>> player_query, r::ecs::Query<r::ecs::Ref<Force>> force_query)
 {
-    for (const auto child_entity : children.entities) {
-        for (auto force_it = is_force_query.begin(); force_it != is_force_query.end(); ++force_it) {
-            if (force_it.entity() == child_entity) {
-                return child_entity;
-            }
-        }
-    }
-    return r::ecs::NULL_ENTITY;
-}
-
-static void link_force_to_player_system(r::ecs::Query<r::ecs::Mut<Player>, r::ecs::Ref<r::ecs::Children>> player_query,
-    r::ecs::Query<r::ecs::With<Force>> is_force_query)
-{
-    for (auto [player, children] : player_query) {
+    for (auto player_it = player_query.begin(); player_it != player_query.end(); ++player_it) {
+        auto [player] = *player_it;
         if (player.ptr->force_entity != r::ecs::NULL_ENTITY) {
             continue; /* Already linked, skip. */
         }
 
-        if (children.ptr->entities.empty()) {
-            continue;
-        }
-
-        r::ecs::Entity force_entity = find_force_entity_in_children(*children.ptr, is_force_query);
-        if (force_entity != r::ecs::NULL_ENTITY) {
-            player.ptr->force_entity = force_entity;
+        for (auto force_it = force_query.begin(); force_it != force_query.end(); ++force_it) {
+            auto [force] = *force_it;
+            if (force.ptr->owner == player_it.entity()) {
+                player.ptr->force_entity = force_it.entity();
+                break;
+            }
         }
     }
 }
@@ -264,18 +272,21 @@ static void setup_bullet_assets_system(r::ecs::Commands &commands, r::ecs::ResMu
 {
     PlayerBulletAssets bullet_assets;
 
-    bullet_assets.laser_beam_handle = meshes.ptr->add("assets/models/PlayerMissile.glb");
-    if (bullet_assets.laser_beam_handle == r::MeshInvalidHandle) {
+    if (!queue_mesh(meshes.ptr, "assets/models/PlayerMissile.glb", bullet_assets.laser_beam_handle)) {
         r::Logger::error("Failed to queue player missile model !");
     }
 
-    bullet_assets.force_missile = meshes.ptr->add("assets/models/SmallMissile.glb");
-    if (bullet_assets.force_missile == r::MeshInvalidHandle) {
+    if (!queue_mesh(meshes.ptr, "assets/models/SmallMissile.glb", bullet_assets.force_missile)) {
         r::Logger::error("Failed to queue force small missile model !");
     }
 
     commands.insert_resource(bullet_assets);
 
+    /* No audio device on the dedicated server */
+    if (!audio.ptr) {
+        return;
+    }
+
     /* Load player SFX */
     PlayerSfxHandles sfx;
     sfx.laser = audio.ptr->load(r::path::get("assets/sounds/laser_beam.mp3"));
@@ -295,14 +306,19 @@ static void setup_bullet_assets_system(r::ecs::Commands &commands, r::ecs::ResMu
 
 static void player_input_system(r::ecs::Commands &commands, r::ecs::Res<r::UserInput> user_input, r::ecs::Res<r::InputMap> input_map,
     r::ecs::ResMut<PlayerBulletAssets> bullet_assets, r::ecs::Res<r::core::FrameTime> time, r::ecs::ResMut<r::Meshes> meshes,
-    r::ecs::Res<PlayerSfxHandles> sfx, r::ecs::Res<UiSfxCounter> counter,
+    r::ecs::Res<PlayerSfxHandles> sfx, r::ecs::Res<UiSfxCounter> counter, r::ecs::ResMut<BattleArena> arena,
     r::ecs::Query<r::ecs::Mut<Velocity>, r::ecs::Ref<r::Transform3d>, r::ecs::Mut<FireCooldown>, r::ecs::Mut<Player>> query)
 {
+    /* The dedicated server has no local input */
+    if (!user_input.ptr || !input_map.ptr) {
+        return;
+    }
+
     const bool is_fire_pressed = input_map.ptr->isActionPressed("Fire", *user_input.ptr);
 
     for (auto [velocity, transform, cooldown, player] : query) {
         handle_player_movement(velocity, input_map, user_input);
-        handle_player_firing(commands, meshes, time, transform, cooldown, player, bullet_assets, is_fire_pressed, sfx, counter);
+        handle_player_firing(commands, meshes, time, transform, cooldown, player, bullet_assets, arena, is_fire_pressed, sfx, counter);
     }
 }
 
@@ -327,18 +343,8 @@ static void send_player_input_system(r::ecs::Res<r::UserInput> user_input, r::ec
         input_mask |= PlayerInput::INPUT_RIGHT;
 
     if (input_mask != 0) {
-        rtype::protocol::RTypePacket packet;
-
-        /* Populate the header with necessary information for the server */
-        packet.header.magic = 0x4254;///< Standard R-Type magic number
-        packet.header.version = 1;
-        packet.header.id = 0;///< Client ID, should be assigned by server upon connection
-        packet.header.command = static_cast<uint8_t>(rtype::protocol::RTypeCommand::CMD_INPUT);
-
-        /* The payload for an input command is just the one-byte bitmask. */
-        packet.payload.push_back(input_mask);
-
-        rtype_packet_writer.send({packet});
+        /* The client ID of the header stays 0 until the server assigns one */
+        rtype_packet_writer.send({message::make(rtype::protocol::RTypeCommand::CMD_INPUT, message::Input{input_mask})});
     }
 }
 
@@ -367,6 +373,20 @@ static void screen_bounds_system(r::ecs::Query<r::ecs::Mut<r::Transform3d>, r::e
     }
 }
 
+/**
+ * @brief Rebuilds the PlayerTargets index from the (clamped) player positions.
+ * @details Enemies and Forces query it instead of walking the Player query themselves.
+ */
+static void player_targets_system(r::ecs::ResMut<PlayerTargets> targets,
+    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::With<Player>> query)
+{
+    targets.ptr->clear();
+    for (auto it = query.begin(); it != query.end(); ++it) {
+        auto [transform, _] = *it;
+        targets.ptr->insert(it.entity(), transform.ptr->position);
+    }
+}
+
 static void autoplay_player_system(r::ecs::Query<r::ecs::Mut<Velocity>, r::ecs::With<Player>> query)
 {
     for (auto [velocity, _] : query) {
@@ -374,25 +394,32 @@ static void autoplay_player_system(r::ecs::Query<r::ecs::Mut<Velocity>, r::ecs::
     }
 }
 
-static void cleanup_player_system(r::ecs::Commands &commands, r::ecs::Query<r::ecs::With<Player>> query)
+/**
+ * @brief Despawns the attract-mode player and its Force, which is a top-level entity outside BattleArena.
+ */
+static void cleanup_player_system(r::ecs::Commands &commands, r::ecs::Query<r::ecs::With<Player>> query,
+    r::ecs::Query<r::ecs::With<Force>> force_query)
 {
     for (auto it = query.begin(); it != query.end(); ++it) {
         commands.despawn(it.entity());
     }
+    for (auto it = force_query.begin(); it != force_query.end(); ++it) {
+        commands.despawn(it.entity());
+    }
 }
 
 void PlayerPlugin::build(r::Application &app)
 {
-    app.add_systems<spawn_player_system>(r::OnEnter{GameState::EnemiesBattle})
+    app.insert_resource(PlayerTargets{})
+        .add_systems<spawn_player_system>(r::OnEnter{GameState::EnemiesBattle})
         .run_unless<run_conditions::is_resuming_from_pause>()
 
         .add_systems<setup_bullet_assets_system>(r::OnEnter{GameState::EnemiesBattle})
         .run_unless<run_conditions::is_resuming_from_pause>()
 
         /* --- Gameplay Systems (Run in both Offline and Online mode) --- */
-        .add_systems<link_force_to_player_system, player_input_system, screen_bounds_system>(r::Schedule::UPDATE)
-        .run_if<r::run_conditions::in_state<GameState::EnemiesBattle>>()
-        .run_or<r::run_conditions::in_state<GameState::BossBattle>>()
+        .add_systems<link_force_to_player_system, player_input_system, screen_bounds_system, player_targets_system>(r::Schedule::UPDATE)
+        .run_if<run_conditions::in_scope<GameScope::Battle>>()
 
         /* --- Online-Only Systems --- */
         .add_systems<connect_to_server_on_join_system>(r::OnEnter{GameState::EnemiesBattle})
@@ -400,13 +427,12 @@ void PlayerPlugin::build(r::Application &app)
         .run_if<run_conditions::is_online_mode>()
 
         .add_systems<send_player_input_system>(r::Schedule::UPDATE)
-        .run_if<r::run_conditions::in_state<GameState::EnemiesBattle>>()
-        .run_or<r::run_conditions::in_state<GameState::BossBattle>>()
+        .run_if<run_conditions::in_scope<GameScope::Battle>>()
         .run_if<run_conditions::is_online_mode>()
 
         /* --- Main Menu Specific Systems --- */
         .add_systems<spawn_player_system>(r::OnEnter{GameState::MainMenu})
         .add_systems<autoplay_player_system>(r::Schedule::UPDATE)
-        .run_if<r::run_conditions::in_state<GameState::MainMenu>>()
+        .run_if<run_conditions::in_scope<GameScope::Menu>>()
         .add_systems<cleanup_player_system>(r::OnExit{GameState::MainMenu});
 }
@@ -1,6 +1,7 @@
 #include "plugins/rtype_protocol_plugin.hpp"
 #include "R-Engine/ECS/Event.hpp"
 #include "R-Engine/Plugins/NetworkPlugin.hpp"
+#include <utility>
 #include <vector>
 
 namespace rtype::protocol {
@@ -21,17 +22,24 @@ void send_rtype_packet_system(r::ecs::EventReader<SendRTypePacket> send_events,
     for (const auto &event : send_events) {
         r::net::Packet net_packet;
 
-        /* Map R-Type protocol concepts to the generic network packet fields */
-        net_packet.magic = event.packet.header.magic;
-        net_packet.version = event.packet.header.version;
-        net_packet.flags = event.packet.header.flags;
-        net_packet.channel = event.packet.header.channel;
-        net_packet.clientId = event.packet.header.id;
-        net_packet.command = event.packet.header.command;
-        net_packet.payload = event.packet.payload;
+        /* Every header field goes through, so a caller that sets the sequence or acks
+           (resends, acks of a reliable channel) keeps them; the NetworkPlugin fills in
+           the ones left to zero. The size always follows the payload. */
+        const RTypeHeader &header = event.packet.header;
+        net_packet.magic = header.magic;
+        net_packet.version = header.version;
+        net_packet.flags = header.flags;
+        net_packet.seq = header.seq;
+        net_packet.ackBase = header.ackBase;
+        net_packet.ackBits = header.ackBits;
+        net_packet.channel = header.channel;
+        net_packet.size = static_cast<uint16_t>(event.packet.payload.size());
+        net_packet.clientId = header.id;
+        net_packet.command = header.command;
+        /* The one copy of the send path: the engine packet owns a std::vector */
+        net_packet.payload.assign(event.packet.payload.begin(), event.packet.payload.end());
 
-        /* The NetworkPlugin will handle filling in the sequence and acknowledgment fields. */
-        network_send_events.send({net_packet});
+        network_send_events.send({std::move(net_packet)});
     }
 }
 
@@ -49,19 +57,15 @@ void receive_rtype_packet_system(r::ecs::EventReader<r::net::NetworkMessageEvent
     r::ecs::EventWriter<ReceivedRTypePacket> received_events)
 {
     for (const auto &event : network_message_events) {
-        RTypePacket rtype_packet;
+        RTypePacket rtype_packet{};
 
-        /* The NetworkMessageEvent provides the core information.
-           Other header fields (like flags, client ID) are not passed through
-           this specific event in the current NetworkPlugin implementation.
-           We reconstruct what we can. */
+        /* The NetworkPlugin consumes the header (sequence, acks, client id) and only
+           hands over the command and payload. The dedicated server reads its own
+           datagrams with wire::decode_datagram, which keeps every field. */
         rtype_packet.header.command = event.message_type;
-        rtype_packet.payload = event.payload;
+        rtype_packet.payload.assign(event.payload);
 
-        /* Note: For a full implementation, the NetworkMessageEvent might need
-           to be expanded to include more data like the sender's client ID.
-           For now, we work with what's available. */
-        received_events.send({rtype_packet});
+        received_events.send({std::move(rtype_packet)});
     }
 }
 
@@ -0,0 +1,11 @@
+#include <resources/assets.hpp>
+
+bool queue_mesh(r::Meshes *meshes, const std::string &path, r::MeshHandle &handle)
+{
+    handle = r::MeshInvalidHandle;
+    if (!meshes) {
+        return true;
+    }
+    handle = meshes->add(path);
+    return handle != r::MeshInvalidHandle;
+}
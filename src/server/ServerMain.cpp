@@ -0,0 +1,163 @@
+#include <plugins/combat.hpp>
+#include <plugins/enemy.hpp>
+#include <plugins/force.hpp>
+#include <plugins/game_setup.hpp>
+#include <plugins/game_state.hpp>
+#include <plugins/gameplay.hpp>
+#include <plugins/player.hpp>
+#include <plugins/rtype_protocol_plugin.hpp>
+#include <server/gateway_link.hpp>
+#include <server/gateway_registration.hpp>
+#include <server/headless_core_plugin.hpp>
+#include <server/process_memory.hpp>
+#include <server/server_plugin.hpp>
+#include <server/snapshot_plugin.hpp>
+
+#include <resources/server_transport.hpp>
+
+#include <R-Engine/Application.hpp>
+#include <R-Engine/Core/Logger.hpp>
+
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+/**
+ * @brief Command line overrides of the server. The port replaces the one of `network.cfg`.
+ */
+struct ServerArguments {
+        std::optional<std::uint16_t> port;
+        std::size_t memory_budget_mib = 0; ///< 0 = no cap
+        std::optional<std::string> gateway_address;
+        std::uint16_t gateway_port = 0;
+};
+
+template<typename T>
+static bool parse_number(std::string_view text, T &value)
+{
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    return error == std::errc{} && end == text.data() + text.size();
+}
+
+/**
+ * @brief `r-type-server [--port port] [--memory-budget MiB] [--gateway address:port]`: one match runs in this Application.
+ * @details The memory budget caps the heap of the process, so of its match: past it, the match fails
+ * with std::bad_alloc instead of starving the other servers of the box. With a gateway, the server
+ * registers with that r-type-gateway, which routes the players of one game at a time to it.
+ */
+static std::optional<ServerArguments> parse_arguments(int argc, char **argv)
+{
+    ServerArguments arguments;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view argument{argv[i]};
+        if (argument == "--port" && i + 1 < argc) {
+            std::uint16_t port = 0;
+            if (!parse_number(argv[++i], port)) {
+                return std::nullopt;
+            }
+            arguments.port = port;
+        } else if (argument == "--gateway" && i + 1 < argc) {
+            const std::string_view target{argv[++i]};
+            const std::size_t colon = target.rfind(':');
+            if (colon == std::string_view::npos || !parse_number(target.substr(colon + 1), arguments.gateway_port)) {
+                return std::nullopt;
+            }
+            arguments.gateway_address = std::string{target.substr(0, colon)};
+        } else if (argument == "--memory-budget" && i + 1 < argc) {
+            if (!parse_number(argv[++i], arguments.memory_budget_mib) || arguments.memory_budget_mib == 0) {
+                return std::nullopt;
+            }
+        } else {
+            return std::nullopt;
+        }
+    }
+    return arguments;
+}
+
+/**
+ * @brief Dedicated server: the battle simulation with no window, GPU, audio or UI. HeadlessCorePlugin
+ * stands in for the parts of DefaultPlugins the simulation needs.
+ * @details The socket is bound before the application is built, so a busy port fails the
+ * process right away instead of leaving a server that no client can reach.
+ */
+int main(int argc, char **argv)
+{
+    const auto started = std::chrono::steady_clock::now();
+    const std::optional<ServerArguments> arguments = parse_arguments(argc, argv);
+    if (!arguments) {
+        r::Logger::error("Usage: r-type-server [--port port] [--memory-budget MiB] [--gateway address:port]");
+        return EXIT_FAILURE;
+    }
+
+    /* Seed random for enemy spawn positions */
+    srand(static_cast<unsigned int>(time(nullptr)));
+
+    const std::size_t memory_budget = arguments->memory_budget_mib * 1024 * 1024;
+    if (memory_budget != 0 && !limit_process_memory(memory_budget)) {
+        r::Logger::error("Cannot cap the heap at " + std::to_string(arguments->memory_budget_mib) + " MiB: " + std::strerror(errno));
+        return EXIT_FAILURE;
+    }
+
+    NetworkConfig config = load_network_config("network.cfg");
+    if (arguments->port) {
+        config.server_port = *arguments->port;
+    }
+    ServerTransport transport;
+    if (!transport.socket.bind(config.server_address, config.server_port)) {
+        r::Logger::error("Cannot bind " + config.server_address + ":" + std::to_string(config.server_port) + ": "
+            + std::strerror(transport.socket.last_error()));
+        return EXIT_FAILURE;
+    }
+    r::Logger::info("Server listening on " + config.server_address + ":" + std::to_string(config.server_port));
+
+    /* Connected before the Application too: a server that cannot reach its gateway would never get a player */
+    ServerGateway gateway;
+    if (arguments->gateway_address) {
+        const std::string target = *arguments->gateway_address + ":" + std::to_string(arguments->gateway_port);
+        GatewayLink link;
+        if (!link.connect(*arguments->gateway_address, arguments->gateway_port)) {
+            r::Logger::error("Cannot reach the gateway at " + target + ": " + std::strerror(link.last_error()));
+            return EXIT_FAILURE;
+        }
+        gateway.registration = GatewayRegistration{link, config.server_port};
+        r::Logger::info("Registering with the gateway at " + target);
+    }
+
+    r::Application app;
+    if (arguments->gateway_address) {
+        app.insert_resource(gateway);
+    }
+    app.insert_resource(config)
+        .insert_resource(transport)
+
+        /* Frame time and transform propagation, ahead of everything that reads them */
+        .add_plugins(HeadlessCorePlugin{started})
+
+        /* Register the game events and the level table */
+        .add_plugins(GameSetupPlugin{})
+        .add_plugins(ServerPlugin{{.memory_budget = memory_budget, .gateway = arguments->gateway_address.has_value()}})
+        .add_plugins(rtype::protocol::RTypeProtocolPlugin{})
+
+        /* Simulation only: no Menu, Pause, Settings, Map, UiSfx or Particles */
+        .add_plugins(GameStatePlugin{})
+        .add_plugins(PlayerPlugin{})
+        .add_plugins(ForcePlugin{})
+        .add_plugins(EnemyPlugin{})
+        .add_plugins(GameplayPlugin{})
+        .add_plugins(CombatPlugin{})
+
+        /* Last, to snapshot the finished tick */
+        .add_plugins(ServerSnapshotPlugin{});
+    app.run();
+
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include <server/gateway_link.hpp>
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+struct GatewayLink::State {
+        int fd = -1;
+        int error = 0;
+        wire::FrameParser input;
+        std::vector<std::uint8_t> output;
+        std::size_t sent = 0;
+
+        ~State()
+        {
+            close();
+        }
+
+        void close() noexcept
+        {
+            if (fd >= 0) {
+                ::close(fd);
+                fd = -1;
+            }
+        }
+
+        bool flush();
+};
+
+/**
+ * @return false if the connection failed.
+ */
+bool GatewayLink::State::flush()
+{
+    while (sent < output.size()) {
+        const ssize_t length = ::send(fd, output.data() + sent, output.size() - sent, MSG_NOSIGNAL);
+        if (length < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return true;
+            }
+            error = errno;
+            return false;
+        }
+        sent += static_cast<std::size_t>(length);
+    }
+    output.clear();
+    sent = 0;
+    return true;
+}
+
+GatewayLink::GatewayLink() : _state(std::make_shared<State>())
+{
+}
+
+bool GatewayLink::connect(const std::string &address, std::uint16_t port)
+{
+    State &state = *_state;
+    sockaddr_in remote{};
+    remote.sin_family = AF_INET;
+    remote.sin_port = htons(port);
+    if (::inet_pton(AF_INET, address.c_str(), &remote.sin_addr) != 1) {
+        state.error = EINVAL;
+        return false;
+    }
+
+    const int fd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        state.error = errno;
+        return false;
+    }
+    if (::connect(fd, reinterpret_cast<const sockaddr *>(&remote), sizeof(remote)) != 0) {
+        state.error = errno;
+        ::close(fd);
+        return false;
+    }
+    /* Connected: from now on the link is drained from the tick, which must never block */
+    const int on = 1;
+    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+    state.close();
+    state.fd = fd;
+    state.error = 0;
+    return true;
+}
+
+void GatewayLink::send(rtype::protocol::RTypeTCPMessage type, std::span<const std::uint8_t> payload)
+{
+    if (_state->fd >= 0) {
+        wire::encode_frame(type, payload, _state->output);
+    }
+}
+
+bool GatewayLink::poll(const FrameFn &handle)
+{
+    State &state = *_state;
+    if (state.fd < 0) {
+        return false;
+    }
+    if (!state.flush()) {
+        state.close();
+        return false;
+    }
+
+    while (true) {
+        const std::span<std::uint8_t> space = state.input.prepare();
+        const ssize_t length = ::recv(state.fd, space.data(), space.size(), 0);
+        if (length < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        }
+        if (length < 0 && errno == EINTR) {
+            continue;
+        }
+        if (length <= 0) {
+            state.error = length == 0 ? ECONNRESET : errno;
+            state.close();
+            return false;
+        }
+        state.input.commit(static_cast<std::size_t>(length));
+
+        wire::TcpFrame frame{};
+        wire::FrameParser::Status status = wire::FrameParser::Status::NeedMore;
+        while ((status = state.input.next(frame)) == wire::FrameParser::Status::Frame) {
+            handle(frame);
+        }
+        if (status == wire::FrameParser::Status::Invalid) {
+            state.error = EPROTO;
+            state.close();
+            return false;
+        }
+    }
+    /* Replies queued by `handle` leave on this tick rather than the next */
+    if (!state.flush()) {
+        state.close();
+        return false;
+    }
+    return true;
+}
+
+bool GatewayLink::is_open() const noexcept
+{
+    return _state->fd >= 0;
+}
+
+int GatewayLink::last_error() const noexcept
+{
+    return _state->error;
+}
@@ -0,0 +1,96 @@
+#include <server/gateway_registration.hpp>
+
+#include <utility>
+#include <vector>
+
+using rtype::protocol::RTypeTCPMessage;
+
+GatewayRegistration::GatewayRegistration(GatewayLink link, std::uint16_t udp_port) : _link(std::move(link))
+{
+    std::vector<std::uint8_t> payload{static_cast<std::uint8_t>(rtype::protocol::RTypeGameType::G_RTYPE)};
+    wire::append_be(payload, 2, udp_port);
+    wire::append_be(payload, 4, 1);
+    _link.send(RTypeTCPMessage::GCMD_GS, payload);
+}
+
+GatewayRegistration::Update GatewayRegistration::update(bool players, std::chrono::steady_clock::time_point now)
+{
+    Update update;
+    if (!_link.is_open()) {
+        return update;
+    }
+    std::vector<std::uint8_t> reply;
+    const bool open = _link.poll([&](const wire::TcpFrame &frame) {
+        switch (frame.type) {
+            case RTypeTCPMessage::GCMD_GS_OK:
+                if (frame.payload.size() >= 4) {
+                    _server_id = wire::load_be(frame.payload, 0, 4);
+                    update.registered = true;
+                }
+                break;
+            case RTypeTCPMessage::GCMD_GS_KO:
+                update.refused = true;
+                break;
+            case RTypeTCPMessage::GCMD_CREATE:
+                if (frame.payload.size() < 4) {
+                    break;
+                }
+                reply.clear();
+                wire::append_be(reply, 4, wire::load_be(frame.payload, 0, 4));
+                if (_claimed) {
+                    _link.send(RTypeTCPMessage::GCMD_CREATE_KO, reply);
+                    break;
+                }
+                wire::append_be(reply, 4, ROOM);
+                _link.send(RTypeTCPMessage::GCMD_GID, reply);
+                _claimed = true;
+                _joined = false;
+                _claimed_at = now;
+                _next_report = now; /* Tell the gateway right away */
+                update.claimed = true;
+                break;
+            default:
+                break;
+        }
+    });
+    if (!open) {
+        update.lost = true;
+        return update;
+    }
+
+    if (_claimed) {
+        _joined = _joined || players;
+        if ((_joined && !players) || (!_joined && now - _claimed_at >= JOIN_GRACE)) {
+            reply.clear();
+            wire::append_be(reply, 4, ROOM);
+            _link.send(RTypeTCPMessage::GCMD_GAME_END, reply);
+            _claimed = false;
+            _next_report = now;
+            update.released = true;
+        }
+    }
+
+    if (now >= _next_report) {
+        _next_report = now + REPORT_PERIOD;
+        reply.clear();
+        wire::append_be(reply, 4, _claimed ? 1 : 0);
+        wire::append_be(reply, 4, _claimed && players ? 1 : 0);
+        _link.send(RTypeTCPMessage::GCMD_OCCUPANCY, reply);
+    }
+    return update;
+}
+
+bool GatewayRegistration::is_open() const noexcept
+{
+    return _link.is_open();
+}
+
+std::uint32_t GatewayRegistration::server_id() const noexcept
+{
+    return _server_id;
+}
+
+bool GatewayRegistration::claimed() const noexcept
+{
+    return _claimed;
+}
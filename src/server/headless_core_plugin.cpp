@@ -0,0 +1,110 @@
+#include "server/headless_core_plugin.hpp"
+#include <R-Engine/Application.hpp>
+#include <R-Engine/Components/Transform3d.hpp>
+#include <R-Engine/Core/FrameTime.hpp>
+#include <R-Engine/Core/Logger.hpp>
+#include <R-Engine/ECS/Query.hpp>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <sys/resource.h>
+#include <utility>
+#include <vector>
+
+#include <resources/server_transport.hpp>
+
+/* A stalled tick (debugger, suspended process) must not teleport everything by its whole length */
+static constexpr std::chrono::milliseconds MAX_FRAME_TIME{250};
+
+/* ================================================================================= */
+/* Time */
+/* ================================================================================= */
+
+static void log_startup(const HeadlessClock &clock, std::chrono::steady_clock::time_point now)
+{
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - clock.started);
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    r::Logger::info("Server ready in " + std::to_string(elapsed.count()) + " ms, peak RSS " + std::to_string(usage.ru_maxrss / 1024) +
+        " MiB");
+}
+
+/**
+ * @brief Measures the wall time since the previous tick into FrameTime. The first tick has a zero delta.
+ */
+static void headless_time_system(r::ecs::ResMut<HeadlessClock> clock, r::ecs::ResMut<r::core::FrameTime> time)
+{
+    const auto now = std::chrono::steady_clock::now();
+    float dt = 0.0f;
+    if (clock.ptr->ticked) {
+        dt = std::chrono::duration<float>(std::min<std::chrono::steady_clock::duration>(now - clock.ptr->last_tick, MAX_FRAME_TIME))
+                 .count();
+    } else {
+        log_startup(*clock.ptr, now);
+        clock.ptr->ticked = true;
+    }
+    clock.ptr->last_tick = now;
+    time.ptr->delta_time = dt;
+    time.ptr->global_time += dt;
+}
+
+/* ================================================================================= */
+/* Transform propagation */
+/* ================================================================================= */
+
+static r::GlobalTransform3d to_global(const r::Transform3d &local)
+{
+    return {.position = local.position, .rotation = local.rotation, .scale = local.scale};
+}
+
+/**
+ * @brief Roots: the global transform is the local one.
+ */
+static void headless_root_transform_system(
+    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Mut<r::GlobalTransform3d>, r::ecs::Without<r::ecs::Parent>> roots)
+{
+    for (auto [local, global, _] : roots) {
+        *global.ptr = to_global(*local.ptr);
+    }
+}
+
+/**
+ * @brief Children: the local transform, scaled and offset by the parent's global one.
+ * @details The simulation only nests one level (boss shields) and never rotates a parent, so the parent
+ * rotation is added up but not applied to the child's offset.
+ */
+static void headless_child_transform_system(r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::With<r::ecs::Children>> parents,
+    r::ecs::Query<r::ecs::Ref<r::Transform3d>, r::ecs::Ref<r::ecs::Parent>, r::ecs::Mut<r::GlobalTransform3d>> children)
+{
+    std::vector<std::pair<r::ecs::Entity, r::GlobalTransform3d>> globals;
+    globals.reserve(parents.size());
+    for (auto it = parents.begin(); it != parents.end(); ++it) {
+        auto [global, _] = *it;
+        globals.emplace_back(it.entity(), *global.ptr);
+    }
+    std::ranges::sort(globals, {}, &std::pair<r::ecs::Entity, r::GlobalTransform3d>::first);
+
+    for (auto [local, parent, global] : children) {
+        const auto found = std::ranges::lower_bound(globals, parent.ptr->entity, {}, &std::pair<r::ecs::Entity, r::GlobalTransform3d>::first);
+        if (found == globals.end() || found->first != parent.ptr->entity) {
+            *global.ptr = to_global(*local.ptr); /* Parent gone this tick: despawned with it next */
+            continue;
+        }
+        const r::GlobalTransform3d &of = found->second;
+        const r::Vec3f &offset = local.ptr->position;
+        global.ptr->position = of.position + r::Vec3f{offset.x * of.scale.x, offset.y * of.scale.y, offset.z * of.scale.z};
+        global.ptr->rotation = of.rotation + local.ptr->rotation;
+        global.ptr->scale = {of.scale.x * local.ptr->scale.x, of.scale.y * local.ptr->scale.y, of.scale.z * local.ptr->scale.z};
+    }
+}
+
+HeadlessCorePlugin::HeadlessCorePlugin(std::chrono::steady_clock::time_point started) noexcept : _started(started)
+{
+}
+
+void HeadlessCorePlugin::build(r::Application &app)
+{
+    app.insert_resource(HeadlessClock{.started = _started, .last_tick = {}, .ticked = false})
+        .insert_resource(r::core::FrameTime{})
+        .add_systems<headless_time_system, headless_root_transform_system, headless_child_transform_system>(r::Schedule::UPDATE);
+}
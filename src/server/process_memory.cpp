@@ -0,0 +1,56 @@
+#include <server/process_memory.hpp>
+
+#include <cstdio>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#if defined(__GLIBC__)
+    #include <malloc.h>
+#endif
+
+static std::size_t resident_bytes()
+{
+#if defined(__linux__)
+    std::FILE *statm = std::fopen("/proc/self/statm", "r");
+    if (!statm) {
+        return 0;
+    }
+    unsigned long size = 0;
+    unsigned long resident = 0;
+    const int read = std::fscanf(statm, "%lu %lu", &size, &resident);
+    std::fclose(statm);
+    return read == 2 ? static_cast<std::size_t>(resident) * static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)) : 0;
+#else
+    return 0;
+#endif
+}
+
+ProcessMemory read_process_memory()
+{
+    rusage usage{};
+    ::getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+    const std::size_t peak = static_cast<std::size_t>(usage.ru_maxrss); /* Bytes on macOS, KiB elsewhere */
+#else
+    const std::size_t peak = static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#endif
+    return {.resident_bytes = resident_bytes(), .peak_resident_bytes = peak};
+}
+
+bool limit_process_memory(std::size_t bytes)
+{
+    const rlimit limit{.rlim_cur = static_cast<rlim_t>(bytes), .rlim_max = static_cast<rlim_t>(bytes)};
+    return ::setrlimit(RLIMIT_DATA, &limit) == 0;
+}
+
+std::size_t compact_process_memory()
+{
+#if defined(__GLIBC__)
+    const std::size_t before = resident_bytes();
+    ::malloc_trim(0);
+    const std::size_t after = resident_bytes();
+    return before > after ? before - after : 0;
+#else
+    return 0;
+#endif
+}
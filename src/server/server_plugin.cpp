@@ -0,0 +1,219 @@
+#include "server/server_plugin.hpp"
+#include <R-Engine/Application.hpp>
+#include <R-Engine/Core/Logger.hpp>
+#include <R-Engine/Core/States.hpp>
+#include <R-Engine/ECS/Event.hpp>
+#include <R-Engine/Plugins/NetworkPlugin.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include <core/wire.hpp>
+#include <plugins/rtype_protocol_plugin.hpp>
+#include <resources/game_mode.hpp>
+#include <resources/game_scope.hpp>
+#include <resources/server_transport.hpp>
+#include <server/process_memory.hpp>
+#include <state/game_state.hpp>
+
+static constexpr std::chrono::nanoseconds SERVER_TICK{1'000'000'000 / 60};
+static constexpr std::size_t MAX_DATAGRAMS_PER_TICK = 256; /* Bounds the receive work of one tick under a flood */
+static constexpr std::chrono::milliseconds IDLE_WAKE{1000};
+static constexpr std::chrono::seconds IDLE_COMPACT_AFTER{30};
+static constexpr std::chrono::seconds MEMORY_REPORT_PERIOD{10};
+static constexpr std::size_t MEBIBYTE = 1024 * 1024;
+
+/* ================================================================================= */
+/* Systems */
+/* ================================================================================= */
+
+/**
+ * @brief Drains the socket into ReceivedRTypePacket events and remembers who sent them and the last snapshot they acknowledged.
+ */
+static void server_receive_system(r::ecs::ResMut<ServerTransport> transport, r::ecs::ResMut<ServerSnapshots> snapshots,
+    r::ecs::EventWriter<rtype::protocol::ReceivedRTypePacket> received)
+{
+    ServerTransport &server = *transport.ptr;
+    ServerSnapshots &acks = *snapshots.ptr;
+    UdpSocket::Endpoint from;
+
+    for (std::size_t n = 0; n < MAX_DATAGRAMS_PER_TICK; ++n) {
+        const std::optional<std::size_t> length = server.socket.receive(server.datagram, from);
+        if (!length) {
+            break;
+        }
+        wire::RTypePacketView packet{};
+        if (!wire::decode_datagram({server.datagram.data(), *length}, packet)) {
+            continue;
+        }
+
+        const auto peer = std::ranges::find(server.peers, from);
+        if (packet.header.command == static_cast<std::uint8_t>(rtype::protocol::RTypeCommand::CMD_LEAVE)) {
+            if (peer != server.peers.end()) {
+                server.peers.erase(peer);
+                acks.acked.erase(from);
+                r::Logger::info("Client left: " + UdpSocket::to_string(from));
+            }
+            received.send({wire::to_packet(packet)});
+            continue;
+        }
+        if (peer == server.peers.end()) {
+            server.peers.push_back(from);
+            r::Logger::info("Client joined: " + UdpSocket::to_string(from));
+        }
+        /* Datagrams arrive out of order: an older acknowledgement must not move the baseline back */
+        if (packet.header.flags & static_cast<std::uint8_t>(rtype::protocol::RTypeFlags::F_SNAPSHOTS)) {
+            std::uint32_t &acked = acks.acked[from];
+            if (sequence_newer(packet.header.ackBase, acked)) {
+                acked = packet.header.ackBase;
+            }
+        }
+        received.send({wire::to_packet(packet)});
+    }
+}
+
+/**
+ * @brief Sends every SendRTypePacket of the tick to each peer.
+ */
+static void server_send_system(r::ecs::EventReader<rtype::protocol::SendRTypePacket> send_events, r::ecs::ResMut<ServerTransport> transport)
+{
+    ServerTransport &server = *transport.ptr;
+
+    for (const auto &event : send_events) {
+        const std::size_t length = wire::encode_datagram(event.packet, server.datagram);
+        if (length == 0) {
+            r::Logger::warn("Dropping an oversized packet, command " + std::to_string(event.packet.header.command));
+            continue;
+        }
+        for (const UdpSocket::Endpoint &peer : server.peers) {
+            server.socket.send({server.datagram.data(), length}, peer);
+        }
+    }
+}
+
+/**
+ * @brief Drives the registration with r-type-gateway and logs what it saw.
+ * @details Losing the gateway does not stop the server: clients already routed keep playing over UDP.
+ */
+static void gateway_system(r::ecs::ResMut<ServerGateway> gateway, r::ecs::Res<ServerTransport> transport)
+{
+    GatewayRegistration &registration = gateway.ptr->registration;
+    if (!registration.is_open()) {
+        return;
+    }
+    const GatewayRegistration::Update update = registration.update(!transport.ptr->peers.empty(), std::chrono::steady_clock::now());
+    if (update.registered) {
+        r::Logger::info("Registered with the gateway as server " + std::to_string(registration.server_id()));
+    }
+    if (update.refused) {
+        r::Logger::error("The gateway refused this server");
+    }
+    if (update.claimed) {
+        r::Logger::info("Match claimed through the gateway");
+    }
+    if (update.released) {
+        r::Logger::info("Match released to the gateway");
+    }
+    if (update.lost) {
+        r::Logger::warn("Lost the gateway, no more players will be routed here");
+    }
+}
+
+/**
+ * @brief (STARTUP) There is no menu on the server: go straight to the battle.
+ */
+static void start_battle_system(r::ecs::ResMut<r::NextState<GameState>> next_state)
+{
+    next_state.ptr->set(GameState::EnemiesBattle);
+}
+
+/**
+ * @brief Sleeps until the next tick is due. Keeps the cadence when on time, restarts it after a late tick.
+ * @details Idle (no peer, or no battle: game over, paused), it waits for a datagram instead, up to
+ * IDLE_WAKE, and the wait does not count as simulated time.
+ */
+static void server_tick_pacing_system(r::ecs::ResMut<ServerClock> clock, r::ecs::ResMut<HeadlessClock> headless,
+    r::ecs::Res<ServerTransport> transport, r::ecs::Res<ActiveScopes> scopes)
+{
+    const bool battle = scopes.ptr && (scopes.ptr->mask & static_cast<std::uint8_t>(GameScope::Battle)) != 0;
+    if (transport.ptr->peers.empty() || !battle) {
+        if (!clock.ptr->idle) {
+            clock.ptr->idle = true;
+            clock.ptr->idle_since = std::chrono::steady_clock::now();
+            r::Logger::info("Match idle, ticking suspended");
+        }
+        transport.ptr->socket.wait_readable(IDLE_WAKE);
+        const auto now = std::chrono::steady_clock::now();
+        headless.ptr->last_tick = now;
+        clock.ptr->next_tick = now + SERVER_TICK;
+        return;
+    }
+    if (clock.ptr->idle) {
+        clock.ptr->idle = false;
+        r::Logger::info("Match resumed");
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (now < clock.ptr->next_tick) {
+        std::this_thread::sleep_until(clock.ptr->next_tick);
+        clock.ptr->next_tick += SERVER_TICK;
+    } else {
+        clock.ptr->next_tick = now + SERVER_TICK;
+    }
+}
+
+/**
+ * @brief Compacts the heap once per idle period, and logs the resident memory every MEMORY_REPORT_PERIOD.
+ */
+static void server_memory_system(r::ecs::ResMut<ServerMemory> memory, r::ecs::Res<ServerClock> clock)
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (!clock.ptr->idle) {
+        memory.ptr->compacted = false;
+    } else if (!memory.ptr->compacted && now - clock.ptr->idle_since >= IDLE_COMPACT_AFTER) {
+        memory.ptr->compacted = true;
+        r::Logger::info("Idle match compacted, " + std::to_string(compact_process_memory() / 1024) + " KiB released");
+    }
+
+    if (now < memory.ptr->next_report) {
+        return;
+    }
+    memory.ptr->next_report = now + MEMORY_REPORT_PERIOD;
+    const ProcessMemory usage = read_process_memory();
+    std::string report = "Memory: " + std::to_string(usage.resident_bytes / MEBIBYTE) + " MiB resident, peak "
+        + std::to_string(usage.peak_resident_bytes / MEBIBYTE) + " MiB";
+    if (memory.ptr->budget == 0) {
+        r::Logger::info(report);
+        return;
+    }
+    report += ", budget " + std::to_string(memory.ptr->budget / MEBIBYTE) + " MiB";
+    if (usage.resident_bytes > memory.ptr->budget / 10 * 9) {
+        r::Logger::warn(report + ": nearly exhausted");
+    } else {
+        r::Logger::info(report);
+    }
+}
+
+ServerPlugin::ServerPlugin(ServerPluginConfig config) noexcept : _config(config)
+{
+}
+
+void ServerPlugin::build(r::Application &app)
+{
+    /* RTypeProtocolPlugin bridges to the engine's client transport through these; the server does not use it,
+       but the events must exist for its systems to run */
+    app.add_events<r::net::NetworkSendEvent, r::net::NetworkMessageEvent>()
+        .insert_resource(ServerClock{})
+        .insert_resource(ServerMemory{.budget = _config.memory_budget, .compacted = false, .next_report = {}})
+        .insert_resource(ServerSnapshots{})
+        .add_systems<start_battle_system>(r::Schedule::STARTUP)
+        .add_systems<server_tick_pacing_system, server_receive_system, server_send_system, server_memory_system>(r::Schedule::UPDATE);
+
+    if (_config.gateway) {
+        app.add_systems<gateway_system>(r::Schedule::UPDATE);
+    }
+}
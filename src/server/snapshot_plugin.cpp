@@ -0,0 +1,156 @@
+#include "server/snapshot_plugin.hpp"
+#include <R-Engine/Application.hpp>
+#include <R-Engine/Components/Transform3d.hpp>
+#include <R-Engine/Core/FrameTime.hpp>
+#include <R-Engine/Core/Logger.hpp>
+#include <R-Engine/ECS/Query.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <components/common.hpp>
+#include <components/enemy.hpp>
+#include <components/player.hpp>
+#include <components/projectiles.hpp>
+#include <components/replication.hpp>
+#include <core/snapshot.hpp>
+#include <core/wire.hpp>
+#include <plugins/rtype_protocol_plugin.hpp>
+#include <resources/server_transport.hpp>
+
+/* ================================================================================= */
+/* Capture */
+/* ================================================================================= */
+
+/**
+ * @brief Every component a snapshot record carries (EntityState); the ones an entity lacks stay default.
+ */
+template<typename Tag>
+using ReplicatedQuery = r::ecs::Query<r::ecs::Ref<r::GlobalTransform3d>, r::ecs::Optional<r::ecs::Ref<Velocity>>,
+    r::ecs::Optional<r::ecs::Ref<Health>>, r::ecs::Optional<r::ecs::Ref<Force>>, r::ecs::Optional<r::ecs::Ref<HomingAttackBoss>>,
+    r::ecs::With<Tag>>;
+
+/**
+ * @brief Copies the whole component: what of it goes on the wire is decided by its net::Traits.
+ */
+template<typename Component>
+static void replicate(Component &into, const Component *component)
+{
+    if (component) {
+        into = *component;
+    }
+}
+
+template<typename Tag>
+static void capture(WorldSnapshot &snapshot, ReplicationRegistry &registry, NetKind kind, ReplicatedQuery<Tag> &query)
+{
+    for (auto it = query.begin(); it != query.end(); ++it) {
+        const NetId id = registry.replicate(it.entity());
+        if (!id) {
+            continue; /* Out of NetIds: left out until some are released */
+        }
+        auto [global, velocity, health, force, boss, _tag] = *it;
+        EntityState &state = snapshot.entities.emplace_back();
+        state.id = id;
+        state.kind = kind;
+        state.transform.position = global.ptr->position; /* Replicated in world space */
+        replicate(state.velocity, velocity.ptr);
+        replicate(state.health, health.ptr);
+        replicate(state.force, force.ptr);
+        replicate(state.boss, boss.ptr);
+    }
+}
+
+/**
+ * @brief Takes the snapshot of the tick and pushes it into the shared history.
+ * @details Every replicated entity gets its NetId from the registry; the ones no query returned
+ * anymore are released when the snapshot is complete.
+ */
+static void snapshot_capture_system(r::ecs::ResMut<ServerSnapshots> snapshots, r::ecs::Res<r::core::FrameTime> time,
+    ReplicatedQuery<Player> players, ReplicatedQuery<Force> forces, ReplicatedQuery<Enemy> enemies, ReplicatedQuery<Boss> bosses,
+    ReplicatedQuery<Shield> shields, ReplicatedQuery<PlayerBullet> player_bullets, ReplicatedQuery<EnemyBullet> enemy_bullets,
+    ReplicatedQuery<WaveCannonBeam> beams)
+{
+    ServerSnapshots &state = *snapshots.ptr;
+    if (++state.sequence == 0) {
+        state.sequence = 1; /* 0 means "nothing acknowledged" */
+    }
+
+    /* Clients extrapolate baselines over this time: it must be the one the simulation moved entities by */
+    state.time += static_cast<std::uint32_t>(std::lround(static_cast<double>(time.ptr->delta_time) * 1e6));
+
+    auto snapshot = std::make_shared<WorldSnapshot>();
+    snapshot->sequence = state.sequence;
+    snapshot->time = state.time;
+    ReplicationRegistry &registry = state.registry;
+    registry.begin_snapshot();
+    capture(*snapshot, registry, NetKind::Player, players);
+    capture(*snapshot, registry, NetKind::Force, forces);
+    capture(*snapshot, registry, NetKind::Enemy, enemies);
+    capture(*snapshot, registry, NetKind::Boss, bosses);
+    capture(*snapshot, registry, NetKind::Shield, shields);
+    capture(*snapshot, registry, NetKind::PlayerBullet, player_bullets);
+    capture(*snapshot, registry, NetKind::EnemyBullet, enemy_bullets);
+    capture(*snapshot, registry, NetKind::Beam, beams);
+    registry.end_snapshot();
+
+    /* An entity matched by two queries is sent once, with the kind of the first */
+    std::ranges::stable_sort(snapshot->entities, {}, &EntityState::id);
+    const auto duplicates = std::ranges::unique(snapshot->entities, {}, &EntityState::id);
+    snapshot->entities.erase(duplicates.begin(), duplicates.end());
+    state.history.push(std::move(snapshot));
+}
+
+/* ================================================================================= */
+/* Send */
+/* ================================================================================= */
+
+/**
+ * @brief Sends each snapshot-capable peer (ServerSnapshots::acked) the delta from its acknowledged snapshot to the one of this tick.
+ * @details Peers with the same baseline get the same bytes, so the payload is only re-encoded
+ * when the baseline changes from one peer to the next.
+ */
+static void snapshot_send_system(r::ecs::ResMut<ServerSnapshots> snapshots, r::ecs::ResMut<ServerTransport> transport)
+{
+    ServerSnapshots &state = *snapshots.ptr;
+    ServerTransport &server = *transport.ptr;
+    const std::shared_ptr<const WorldSnapshot> current = state.history.find(state.sequence);
+    if (!current) {
+        return;
+    }
+
+    rtype::protocol::RTypeHeader header{};
+    header.magic = wire::RTYPE_MAGIC;
+    header.version = 1;
+    header.seq = current->sequence;
+    header.command = static_cast<std::uint8_t>(rtype::protocol::RTypeCommand::CMD_SNAPSHOT);
+
+    const WorldSnapshot *encoded_against = nullptr;
+    std::size_t length = 0;
+    bool encoded = false;
+    for (const auto &[peer, acked] : state.acked) {
+        const std::shared_ptr<const WorldSnapshot> baseline = state.history.find(acked);
+        if (!encoded || baseline.get() != encoded_against) {
+            state.payload.clear();
+            encode_snapshot(baseline.get(), *current, state.payload);
+            length = wire::encode_datagram(header, state.payload, server.datagram);
+            encoded_against = baseline.get();
+            encoded = true;
+            if (length == 0) {
+                r::Logger::warn("Snapshot " + std::to_string(current->sequence) + " of " + std::to_string(state.payload.size()) +
+                    " bytes does not fit a datagram");
+            }
+        }
+        if (length != 0) {
+            server.socket.send({server.datagram.data(), length}, peer);
+        }
+    }
+}
+
+void ServerSnapshotPlugin::build(r::Application &app)
+{
+    app.add_systems<snapshot_capture_system, snapshot_send_system>(r::Schedule::UPDATE);
+}
@@ -0,0 +1,86 @@
+#include <server/tcp_frame.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace wire {
+
+std::span<std::uint8_t> FrameParser::prepare(std::size_t min_size)
+{
+    if (_buffer.size() - _end < min_size) {
+        /* Slide the unparsed tail to the front, and only grow when that is not enough */
+        if (_begin > 0) {
+            std::memmove(_buffer.data(), _buffer.data() + _begin, _end - _begin);
+            _end -= _begin;
+            _begin = 0;
+        }
+        if (_buffer.size() - _end < min_size) {
+            _buffer.resize(_end + min_size);
+        }
+    }
+    return {_buffer.data() + _end, _buffer.size() - _end};
+}
+
+void FrameParser::commit(std::size_t size) noexcept
+{
+    _end += size;
+}
+
+FrameParser::Status FrameParser::next(TcpFrame &frame) noexcept
+{
+    const std::span<const std::uint8_t> pending{_buffer.data() + _begin, _end - _begin};
+    if (pending.size() < TCP_HEADER_SIZE) {
+        return Status::NeedMore;
+    }
+    const std::size_t size = load_be(pending, 5, 2);
+    if (load_be(pending, 0, 2) != TCP_MAGIC || size > TCP_MAX_PAYLOAD) {
+        return Status::Invalid;
+    }
+    if (pending.size() < TCP_HEADER_SIZE + size) {
+        return Status::NeedMore;
+    }
+
+    frame.version = pending[2];
+    frame.flags = pending[3];
+    frame.type = static_cast<rtype::protocol::RTypeTCPMessage>(pending[4]);
+    frame.payload = pending.subspan(TCP_HEADER_SIZE, size);
+    _begin += TCP_HEADER_SIZE + size;
+    if (_begin == _end) {
+        /* Drained: restart at the front for free */
+        _begin = 0;
+        _end = 0;
+    }
+    return Status::Frame;
+}
+
+bool encode_frame(rtype::protocol::RTypeTCPMessage type, std::span<const std::uint8_t> payload, std::vector<std::uint8_t> &out)
+{
+    if (payload.size() > TCP_MAX_PAYLOAD) {
+        return false;
+    }
+    append_be(out, 2, TCP_MAGIC);
+    out.push_back(1);
+    out.push_back(0);
+    out.push_back(static_cast<std::uint8_t>(type));
+    append_be(out, 2, static_cast<std::uint32_t>(payload.size()));
+    out.insert(out.end(), payload.begin(), payload.end());
+    return true;
+}
+
+std::uint32_t load_be(std::span<const std::uint8_t> bytes, std::size_t offset, std::size_t width) noexcept
+{
+    std::uint32_t value = 0;
+    for (std::size_t i = 0; i < width; ++i) {
+        value = (value << 8) | bytes[offset + i];
+    }
+    return value;
+}
+
+void append_be(std::vector<std::uint8_t> &out, std::size_t width, std::uint32_t value)
+{
+    for (std::size_t i = width; i-- > 0;) {
+        out.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+}
+
+}// namespace wire
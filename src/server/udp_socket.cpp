@@ -0,0 +1,119 @@
+#include <server/udp_socket.hpp>
+
+#include <arpa/inet.h>
+#include <atomic>
+#include <cerrno>
+#include <functional>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+struct UdpSocket::State {
+        int fd = -1;
+        std::atomic<int> error{0};
+
+        ~State()
+        {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+};
+
+UdpSocket::UdpSocket() : _state(std::make_shared<State>())
+{
+}
+
+bool UdpSocket::bind(const std::string &address, std::uint16_t port)
+{
+    sockaddr_in local{};
+    local.sin_family = AF_INET;
+    local.sin_port = htons(port);
+    if (::inet_pton(AF_INET, address.c_str(), &local.sin_addr) != 1) {
+        _state->error = EINVAL;
+        return false;
+    }
+
+    const int fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        _state->error = errno;
+        return false;
+    }
+    if (::bind(fd, reinterpret_cast<const sockaddr *>(&local), sizeof(local)) != 0) {
+        _state->error = errno;
+        ::close(fd);
+        return false;
+    }
+    if (_state->fd >= 0) {
+        ::close(_state->fd);
+    }
+    _state->fd = fd;
+    _state->error = 0;
+    return true;
+}
+
+std::optional<std::size_t> UdpSocket::receive(std::span<std::uint8_t> buffer, Endpoint &from) const
+{
+    sockaddr_in remote{};
+    socklen_t remote_size = sizeof(remote);
+
+    /* EAGAIN means drained; other errors (e.g. a queued ICMP port unreachable) end this drain too */
+    const ssize_t length = ::recvfrom(_state->fd, buffer.data(), buffer.size(), 0, reinterpret_cast<sockaddr *>(&remote), &remote_size);
+    if (length < 0) {
+        _state->error = errno;
+        return std::nullopt;
+    }
+    from.address = remote.sin_addr.s_addr;
+    from.port = remote.sin_port;
+    return static_cast<std::size_t>(length);
+}
+
+bool UdpSocket::send(std::span<const std::uint8_t> datagram, const Endpoint &to) const
+{
+    sockaddr_in remote{};
+    remote.sin_family = AF_INET;
+    remote.sin_addr.s_addr = to.address;
+    remote.sin_port = to.port;
+
+    const ssize_t sent = ::sendto(_state->fd, datagram.data(), datagram.size(), 0, reinterpret_cast<const sockaddr *>(&remote), sizeof(remote));
+    if (sent < 0) {
+        _state->error = errno;
+        return false;
+    }
+    return true;
+}
+
+bool UdpSocket::wait_readable(std::chrono::milliseconds timeout) const
+{
+    pollfd readable{.fd = _state->fd, .events = POLLIN, .revents = 0};
+    const int ready = ::poll(&readable, 1, static_cast<int>(timeout.count()));
+    if (ready < 0) {
+        _state->error = errno;
+    }
+    return ready > 0;
+}
+
+std::size_t UdpSocket::EndpointHash::operator()(const Endpoint &endpoint) const noexcept
+{
+    return std::hash<std::uint64_t>{}((static_cast<std::uint64_t>(endpoint.address) << 16) | endpoint.port);
+}
+
+bool UdpSocket::is_open() const noexcept
+{
+    return _state->fd >= 0;
+}
+
+int UdpSocket::last_error() const noexcept
+{
+    return _state->error;
+}
+
+std::string UdpSocket::to_string(const Endpoint &endpoint)
+{
+    in_addr address{};
+    address.s_addr = endpoint.address;
+    char text[INET_ADDRSTRLEN] = {};
+    ::inet_ntop(AF_INET, &address, text, sizeof(text));
+    return std::string{text} + ":" + std::to_string(ntohs(endpoint.port));
+}
@@ -2,6 +2,10 @@
 
 #include <resources/game_mode.hpp>
 
+#if defined(R_TYPE_DEBUG)
+    #include <atomic>
+#endif
+
 namespace run_conditions {
 
 /**
@@ -12,6 +16,7 @@ namespace run_conditions {
  */
 bool is_resuming_from_pause(r::ecs::Res<r::State<GameState>> state)
 {
+    count_condition_evaluation();
     return state.ptr && state.ptr->previous().has_value() && state.ptr->previous().value() == GameState::Paused;
 }
 
@@ -21,7 +26,31 @@ bool is_resuming_from_pause(r::ecs::Res<r::State<GameState>> state)
  */
 bool is_online_mode(r::ecs::Res<GameMode> mode)
 {
+    count_condition_evaluation();
     return mode.ptr && *mode.ptr == GameMode::Online;
 }
 
+#if defined(R_TYPE_DEBUG)
+
+static std::atomic<std::uint64_t> condition_evaluation_count{0};
+
+void count_condition_evaluation() noexcept
+{
+    condition_evaluation_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::uint64_t condition_evaluations() noexcept
+{
+    return condition_evaluation_count.load(std::memory_order_relaxed);
+}
+
+#else
+
+std::uint64_t condition_evaluations() noexcept
+{
+    return 0;
+}
+
+#endif
+
 }// namespace run_conditions
@@ -0,0 +1,169 @@
+#include "test.hpp"
+
+#include <core/bit_stream.hpp>
+#include <components/replication.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+/* The snapshot ranges, and odd widths and bounds that do not divide evenly */
+const QuantizedRange RANGES[] = {
+    snapshot_quantization::X,
+    snapshot_quantization::Y,
+    snapshot_quantization::VELOCITY,
+    {-1.0f, 1.0f, 1},
+    {-0.5f, 3.3f, 7},
+    {0.0f, 1000.0f, 13},
+    {-12345.0f, 6789.0f, 23},
+};
+
+/**
+ * @brief Largest round-trip error over a sweep of `range`: both ends, every step boundary region and random values.
+ */
+double worst_error(const QuantizedRange &range)
+{
+    std::vector<float> values{range.min, range.max};
+    const double span = static_cast<double>(range.max) - static_cast<double>(range.min);
+    constexpr std::size_t SWEEP = 100'000;
+    for (std::size_t i = 0; i <= SWEEP; ++i) {
+        values.push_back(static_cast<float>(static_cast<double>(range.min) + span * static_cast<double>(i) / SWEEP));
+    }
+    std::mt19937 random{42};
+    std::uniform_real_distribution<float> inside{range.min, range.max};
+    for (std::size_t i = 0; i < SWEEP; ++i) {
+        values.push_back(inside(random));
+    }
+
+    double worst = 0.0;
+    for (const float value : values) {
+        const float back = range.dequantize(range.quantize(value));
+        /* The result is a float: rounding it, half an ulp, comes on top of the quantization error */
+        const double error = std::abs(static_cast<double>(back) - static_cast<double>(value))
+            - static_cast<double>(std::abs(back)) * static_cast<double>(std::numeric_limits<float>::epsilon()) / 2.0;
+        worst = error > worst ? error : worst;
+    }
+    return worst;
+}
+
+}// namespace
+
+TEST(quantized_range_error_is_within_half_a_step)
+{
+    for (const QuantizedRange &range : RANGES) {
+        const double half_step = (static_cast<double>(range.max) - static_cast<double>(range.min)) / range.steps() / 2.0;
+        CHECK(worst_error(range) <= half_step);
+    }
+}
+
+TEST(quantized_range_clamps_at_both_ends)
+{
+    constexpr float INF = std::numeric_limits<float>::infinity();
+    for (const QuantizedRange &range : RANGES) {
+        CHECK(range.quantize(range.min) == 0);
+        CHECK(range.quantize(range.max) == range.steps());
+        CHECK(range.quantize(range.min - 1.0f) == 0);
+        CHECK(range.quantize(range.max + 1.0f) == range.steps());
+        CHECK(range.quantize(-INF) == 0);
+        CHECK(range.quantize(INF) == range.steps());
+        CHECK(range.quantize(std::numeric_limits<float>::quiet_NaN()) == 0);
+
+        CHECK(range.dequantize(0) == range.min);
+        CHECK(range.dequantize(range.steps()) == range.max);
+        CHECK(range.dequantize(std::numeric_limits<std::uint32_t>::max()) == range.max);
+        CHECK(range.quantize(range.dequantize(range.steps() - 1)) == range.steps() - 1);
+    }
+}
+
+TEST(bit_reader_reads_back_odd_widths)
+{
+    struct Value {
+            std::uint32_t value;
+            unsigned bits;
+    };
+    std::vector<Value> written;
+    std::mt19937 random{7};
+    for (unsigned round = 0; round < 64; ++round) {
+        for (const unsigned bits : {1u, 3u, 5u, 7u, 0u, 9u, 11u, 13u, 17u, 23u, 31u, 32u, 2u}) {
+            const std::uint32_t mask = bits == 32 ? ~std::uint32_t{0} : (std::uint32_t{1} << bits) - 1;
+            written.push_back({static_cast<std::uint32_t>(random()) & mask, bits});
+        }
+    }
+
+    std::vector<std::uint8_t> bytes;
+    BitWriter writer{bytes};
+    std::size_t total = 0;
+    for (const Value &value : written) {
+        writer.write(value.value, value.bits);
+        total += value.bits;
+    }
+    CHECK(writer.bit_count() == total);
+    writer.flush();
+    CHECK(bytes.size() == (total + 7) / 8);
+
+    BitReader reader{bytes};
+    for (const Value &value : written) {
+        CHECK(reader.read(value.bits) == value.value);
+    }
+    CHECK(!reader.failed());
+    CHECK(reader.remaining_bits() < 8);
+}
+
+TEST(bit_writer_drops_bits_above_the_width)
+{
+    std::vector<std::uint8_t> bytes;
+    BitWriter writer{bytes};
+    writer.write(0xFFu, 3);
+    writer.write(0u, 5);
+    CHECK(bytes.size() == 1);
+    CHECK(bytes[0] == 0xE0);
+}
+
+TEST(bit_writer_appends_after_existing_bytes)
+{
+    std::vector<std::uint8_t> bytes{0xAB, 0xCD};
+    BitWriter writer{bytes};
+    writer.write(true);
+    writer.write(0x5u, 3);
+    writer.flush();
+    CHECK(bytes.size() == 3);
+    CHECK(bytes[0] == 0xAB && bytes[1] == 0xCD);
+    CHECK(bytes[2] == 0xD0);
+}
+
+TEST(bit_reader_fails_past_the_end)
+{
+    const std::vector<std::uint8_t> bytes{0xFF, 0x0F};
+    BitReader reader{bytes};
+    CHECK(reader.read(12) == 0xFF0);
+    CHECK(!reader.failed());
+    CHECK(reader.read(5) == 0);
+    CHECK(reader.failed());
+    CHECK(reader.remaining_bits() == 0);
+}
+
+TEST(quantized_floats_go_through_the_bit_stream)
+{
+    const QuantizedRange range{-3.0f, 5.0f, 11};
+    const float values[] = {-3.0f, -2.99f, 0.0f, 1.2345f, 4.999f, 5.0f, 100.0f};
+
+    std::vector<std::uint8_t> bytes;
+    BitWriter writer{bytes};
+    for (const float value : values) {
+        writer.write(value, range);
+        writer.write(true); /* Odd total width on purpose */
+    }
+    writer.flush();
+
+    BitReader reader{bytes};
+    for (const float value : values) {
+        CHECK(reader.read(range) == range.dequantize(range.quantize(value)));
+        CHECK(reader.read_bool());
+    }
+    CHECK(!reader.failed());
+}
@@ -0,0 +1,165 @@
+#include "test.hpp"
+
+#if defined(__linux__)
+
+    #include <gateway/gateway.hpp>
+    #include <server/gateway_link.hpp>
+    #include <server/gateway_registration.hpp>
+
+    #include <atomic>
+    #include <chrono>
+    #include <cstdint>
+    #include <functional>
+    #include <optional>
+    #include <thread>
+    #include <vector>
+
+using rtype::protocol::RTypeTCPMessage;
+
+namespace {
+
+constexpr std::uint32_t LOOPBACK = 0x7F000001;
+constexpr std::chrono::seconds PATIENCE{5};
+
+/**
+ * @brief What a client got back from the gateway, payload copied out of the link buffer.
+ */
+struct Reply {
+        RTypeTCPMessage type;
+        std::vector<std::uint8_t> payload;
+};
+
+/**
+ * @brief A game server of the test: its registration and whether players are connected to it.
+ */
+struct Server {
+        std::uint16_t udp_port;
+        GatewayRegistration registration;
+        bool players = false;
+};
+
+/**
+ * @brief Ticks both servers and reads the client until `done`, or PATIENCE runs out.
+ */
+std::optional<Reply> pump(std::vector<Server> &servers, GatewayLink &client, const std::function<bool()> &done = nullptr)
+{
+    std::optional<Reply> reply;
+    const auto deadline = std::chrono::steady_clock::now() + PATIENCE;
+    while (std::chrono::steady_clock::now() < deadline) {
+        for (Server &server : servers) {
+            server.registration.update(server.players, std::chrono::steady_clock::now());
+        }
+        client.poll([&](const wire::TcpFrame &frame) {
+            reply = Reply{frame.type, {frame.payload.begin(), frame.payload.end()}};
+        });
+        if (done ? done() : reply.has_value()) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    return reply;
+}
+
+/**
+ * @brief Keeps everything ticking for `duration`, for messages nobody answers to get through.
+ */
+void settle(std::vector<Server> &servers, GatewayLink &client, std::chrono::milliseconds duration)
+{
+    const auto until = std::chrono::steady_clock::now() + duration;
+    pump(servers, client, [&] { return std::chrono::steady_clock::now() >= until; });
+}
+
+std::optional<Reply> request(std::vector<Server> &servers, GatewayLink &client, RTypeTCPMessage type, std::vector<std::uint8_t> payload)
+{
+    client.send(type, payload);
+    return pump(servers, client);
+}
+
+std::vector<std::uint8_t> create_payload()
+{
+    return {static_cast<std::uint8_t>(rtype::protocol::RTypeGameType::G_RTYPE)};
+}
+
+std::vector<std::uint8_t> join_payload(std::uint32_t game)
+{
+    std::vector<std::uint8_t> payload;
+    wire::append_be(payload, 4, game);
+    return payload;
+}
+
+/**
+ * @brief Server of a GCMD_GID `game id u32, address u32, udp port u16, room id u32`.
+ */
+std::uint16_t port_of(const Reply &gid)
+{
+    return static_cast<std::uint16_t>(wire::load_be(gid.payload, 8, 2));
+}
+
+}// namespace
+
+/**
+ * @brief A gateway and two single-match servers on loopback: a client creates a game, is routed to a
+ * server, joins it again by id, and is refused once both matches are taken.
+ */
+TEST(gateway_routes_clients_to_registered_servers)
+{
+    Gateway gateway;
+    CHECK(gateway.listen("127.0.0.1", 0));
+    const std::uint16_t port = gateway.local_port();
+    CHECK(port != 0);
+    std::atomic<bool> stop{false};
+    std::thread loop([&] { gateway.run(stop); });
+
+    std::vector<Server> servers;
+    for (const std::uint16_t udp_port : {std::uint16_t{5101}, std::uint16_t{5102}}) {
+        GatewayLink link;
+        CHECK(link.connect("127.0.0.1", port));
+        servers.push_back({udp_port, GatewayRegistration{link, udp_port}, false});
+    }
+    GatewayLink client;
+    CHECK(client.connect("127.0.0.1", port));
+    pump(servers, client, [&] { return servers[0].registration.server_id() != 0 && servers[1].registration.server_id() != 0; });
+    CHECK(servers[0].registration.server_id() != servers[1].registration.server_id());
+
+    /* Created on one server, and the same game when joined by id */
+    const std::optional<Reply> created = request(servers, client, RTypeTCPMessage::GCMD_CREATE, create_payload());
+    CHECK(created && created->type == RTypeTCPMessage::GCMD_GID && created->payload.size() == 14);
+    if (!created || created->payload.size() != 14) {
+        stop = true;
+        loop.join();
+        return;
+    }
+    const std::uint32_t game = wire::load_be(created->payload, 0, 4);
+    CHECK(wire::load_be(created->payload, 4, 4) == LOOPBACK);
+    CHECK(wire::load_be(created->payload, 10, 4) == GatewayRegistration::ROOM);
+    Server &first = port_of(*created) == servers[0].udp_port ? servers[0] : servers[1];
+    Server &second = &first == &servers[0] ? servers[1] : servers[0];
+    CHECK(first.registration.claimed() && !second.registration.claimed());
+
+    const std::optional<Reply> joined = request(servers, client, RTypeTCPMessage::GCMD_JOIN, join_payload(game));
+    CHECK(joined && joined->type == RTypeTCPMessage::GCMD_GID && joined->payload == created->payload);
+
+    /* The next game goes to the other server, and a third finds both taken */
+    const std::optional<Reply> other = request(servers, client, RTypeTCPMessage::GCMD_CREATE, create_payload());
+    CHECK(other && other->type == RTypeTCPMessage::GCMD_GID && port_of(*other) == second.udp_port);
+    const std::optional<Reply> full = request(servers, client, RTypeTCPMessage::GCMD_CREATE, create_payload());
+    CHECK(full && full->type == RTypeTCPMessage::GCMD_CREATE_KO);
+
+    /* Players come and go: the match is released, its game forgotten, and the server offered again */
+    first.players = true;
+    settle(servers, client, std::chrono::milliseconds{20});
+    CHECK(first.registration.claimed());
+    first.players = false;
+    pump(servers, client, [&] { return !first.registration.claimed(); });
+    CHECK(!first.registration.claimed());
+    settle(servers, client, std::chrono::milliseconds{200});
+    const std::optional<Reply> gone = request(servers, client, RTypeTCPMessage::GCMD_JOIN, join_payload(game));
+    CHECK(gone && gone->type == RTypeTCPMessage::GCMD_JOIN_KO);
+    const std::optional<Reply> again = request(servers, client, RTypeTCPMessage::GCMD_CREATE, create_payload());
+    CHECK(again && again->type == RTypeTCPMessage::GCMD_GID && port_of(*again) == first.udp_port);
+
+    stop = true;
+    loop.join();
+}
+
+#endif
@@ -0,0 +1,60 @@
+#include "test.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+struct Registered {
+        const char *name;
+        test::TestFn fn;
+};
+
+std::vector<Registered> &registry()
+{
+    static std::vector<Registered> tests;
+    return tests;
+}
+
+std::size_t failed_checks = 0;
+
+}// namespace
+
+bool test::add(const char *name, TestFn fn) noexcept
+{
+    registry().push_back({name, fn});
+    return true;
+}
+
+void test::fail(const char *file, int line, const char *expression) noexcept
+{
+    std::fprintf(stderr, "  %s:%d: CHECK(%s) failed\n", file, line, expression);
+    ++failed_checks;
+}
+
+int main(int argc, char **argv)
+{
+    const std::string_view filter = argc > 1 ? argv[1] : "";
+    std::size_t run = 0;
+    std::size_t failed = 0;
+
+    for (const Registered &test : registry()) {
+        if (std::string_view{test.name}.find(filter) == std::string_view::npos) {
+            continue;
+        }
+        const std::size_t before = failed_checks;
+        test.fn();
+        ++run;
+        if (failed_checks != before) {
+            ++failed;
+            std::fprintf(stderr, "[FAILED] %s\n", test.name);
+        } else {
+            std::printf("[ok] %s\n", test.name);
+        }
+    }
+    std::printf("%zu/%zu tests passed\n", run - failed, run);
+    return failed == 0 && run != 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,94 @@
+#include "test.hpp"
+
+#include <core/particle_pool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace {
+
+constexpr std::uint8_t KINDS = 3;
+
+/**
+ * @brief X positions of every instance, all kinds together, sorted.
+ */
+std::vector<float> instance_xs(const ParticlePool &pool)
+{
+    ParticlePool::InstanceLists lists;
+    pool.build_instances(lists);
+    std::vector<float> xs;
+    for (const auto &list : lists) {
+        for (const ParticlePool::Instance &instance : list) {
+            xs.push_back(instance.rows[0][3]);
+        }
+    }
+    std::ranges::sort(xs);
+    return xs;
+}
+
+}// namespace
+
+TEST(particle_instances_are_gpu_ready_matrices)
+{
+    ParticlePool pool{4, KINDS};
+    CHECK(pool.emit({1.0f, 2.0f, 3.0f}, {}, 2.0f, 0.5f, 0xFF000080u, 2));
+    pool.update(1.0f, 1.0f);
+
+    ParticlePool::InstanceLists lists;
+    pool.build_instances(lists);
+    CHECK(lists.size() == KINDS && lists[0].empty() && lists[1].empty() && lists[2].size() == 1);
+
+    const auto &rows = lists[2][0].rows;
+    CHECK(rows[0][0] == 0.5f && rows[1][1] == 0.5f && rows[2][2] == 0.5f && rows[0][1] == 0.0f);
+    CHECK(rows[0][3] == 1.0f && rows[1][3] == 2.0f && rows[2][3] == 3.0f);
+    /* Colour in the bottom row, alpha faded by half the life spent */
+    CHECK(rows[3][0] == 1.0f && rows[3][1] == 0.0f && rows[3][2] == 0.0f);
+    const float alpha = static_cast<float>(0x80) / 255.0f * 0.5f;
+    CHECK(rows[3][3] > alpha - 0.001f && rows[3][3] < alpha + 0.001f);
+}
+
+TEST(particle_update_culls_the_dead_and_keeps_the_live_packed)
+{
+    ParticlePool pool{8, KINDS};
+    /* Dead ones first, last and in the middle, so the swap-remove moves live particles over them */
+    const float lives[] = {1.0f, 3.0f, 1.0f, 3.0f, 1.0f, 3.0f, 1.0f};
+    for (std::size_t i = 0; i < std::size(lives); ++i) {
+        CHECK(pool.emit({static_cast<float>(i), 0.0f, 0.0f}, {}, lives[i], 1.0f, 0xFFFFFFFFu, static_cast<std::uint8_t>(i % KINDS)));
+    }
+    pool.update(2.0f, 1.0f);
+    CHECK(pool.size() == 3);
+    CHECK(instance_xs(pool) == std::vector<float>({1.0f, 3.0f, 5.0f}));
+
+    /* Freed slots are reused, and the rest dies on time */
+    CHECK(pool.emit({10.0f, 0.0f, 0.0f}, {}, 3.0f, 1.0f, 0xFFFFFFFFu, 0));
+    pool.update(2.0f, 1.0f);
+    CHECK(instance_xs(pool) == std::vector<float>({10.0f}));
+    pool.update(2.0f, 1.0f);
+    CHECK(pool.size() == 0);
+}
+
+TEST(particle_emission_into_a_full_pool_is_dropped)
+{
+    ParticlePool pool{3, KINDS};
+    CHECK(pool.emit({}, {}, 1.0f, 1.0f, 0xFFFFFFFFu, 0));
+    const ParticlePool::Burst burst{.position = {}, .count = 10, .min_speed = 1.0f, .max_speed = 2.0f, .life = 1.0f, .size = 1.0f,
+        .rgba = 0xFFFFFFFFu, .kind = 1};
+    CHECK(pool.emit(burst) == 2);
+    CHECK(pool.size() == 3 && pool.capacity() == 3);
+    CHECK(!pool.emit({}, {}, 1.0f, 1.0f, 0xFFFFFFFFu, 0));
+    CHECK(pool.emit(burst) == 0);
+    CHECK(pool.size() == 3);
+}
+
+TEST(particle_emission_rejects_unknown_kinds_and_no_life)
+{
+    ParticlePool pool{4, KINDS};
+    CHECK(!pool.emit({}, {}, 1.0f, 1.0f, 0xFFFFFFFFu, KINDS));
+    CHECK(!pool.emit({}, {}, 1.0f, 1.0f, 0xFFFFFFFFu, 255));
+    CHECK(!pool.emit({}, {}, 0.0f, 1.0f, 0xFFFFFFFFu, 0));
+    CHECK(pool.size() == 0);
+    CHECK(pool.emit({}, {}, 1.0f, 1.0f, 0xFFFFFFFFu, KINDS - 1));
+}
@@ -0,0 +1,264 @@
+#include "test.hpp"
+
+#include <components/replication.hpp>
+#include <core/bit_stream.hpp>
+#include <core/net_traits.hpp>
+#include <core/snapshot.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief `value` after a full net::encode() and net::decode() into a default T.
+ */
+template<typename T>
+T round_trip(const T &value)
+{
+    std::vector<std::uint8_t> bytes;
+    BitWriter writer{bytes};
+    net::encode(value, writer);
+    CHECK(writer.bit_count() == net::max_bits<T>);
+    writer.flush();
+
+    T back{};
+    BitReader reader{bytes};
+    net::decode(back, reader);
+    CHECK(!reader.failed());
+    return back;
+}
+
+/**
+ * @brief `to` rebuilt from `from` and the net::encode_delta() between them, which must take `bits` bits.
+ */
+template<typename T>
+T delta_trip(const T &from, const T &to, std::size_t bits)
+{
+    std::vector<std::uint8_t> bytes;
+    BitWriter writer{bytes};
+    net::encode_delta(from, to, writer, net::diff(from, to));
+    CHECK(writer.bit_count() == bits);
+    writer.flush();
+
+    T back = from;
+    BitReader reader{bytes};
+    net::decode_delta(back, reader);
+    CHECK(!reader.failed());
+    CHECK(reader.remaining_bits() < 8);
+    return back;
+}
+
+/**
+ * @brief A new entity with every replicated component set away from its default.
+ */
+EntityState make_boss(std::uint16_t index)
+{
+    EntityState entity{};
+    entity.id = NetId::make(index, 1);
+    entity.kind = NetKind::Boss;
+    entity.transform.position = {12.5f, -3.25f, 0.0f};
+    entity.velocity.value = {-2.0f, 1.5f, 0.0f};
+    entity.health = {640, 1000};
+    entity.force = {.state = Force::State::Recalling, .is_front_attachment = false, .owner = {}};
+    entity.boss = {.current_state = HomingAttackBoss::State::Attacking, .exposed = true};
+    return entity;
+}
+
+bool same(const EntityState &a, const EntityState &b)
+{
+    return a.id == b.id && net::diff(a, b) == 0;
+}
+
+bool same(const WorldSnapshot &a, const WorldSnapshot &b)
+{
+    if (a.sequence != b.sequence || a.entities.size() != b.entities.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.entities.size(); ++i) {
+        if (!same(a.entities[i], b.entities[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief `current` decoded on top of `baseline`, checking that it decodes at all.
+ */
+WorldSnapshot snapshot_trip(const WorldSnapshot *baseline, const WorldSnapshot &current)
+{
+    std::vector<std::uint8_t> payload;
+    encode_snapshot(baseline, current, payload);
+    CHECK(snapshot_baseline(payload) == (baseline ? baseline->sequence : 0));
+
+    WorldSnapshot back;
+    CHECK(decode_snapshot(baseline, payload, back));
+    return back;
+}
+
+}// namespace
+
+TEST(components_round_trip_through_their_traits)
+{
+    const r::Transform3d transform{.position = {-90.25f, 7.5f, 3.0f}, .rotation = {}, .scale = {1.0f, 1.0f, 1.0f}};
+    const r::Transform3d transform_back = round_trip(transform);
+    CHECK(net::diff(transform, transform_back) == 0);
+    CHECK(transform_back.position.z == 0.0f); /* Z is not replicated */
+
+    const Velocity velocity{.value = {31.0f, -4.75f, 0.0f}};
+    CHECK(net::diff(velocity, round_trip(velocity)) == 0);
+
+    const Health health{.current = 37, .max = 1000};
+    const Health health_back = round_trip(health);
+    CHECK(health_back.current == 37 && health_back.max == 1000);
+
+    const Force force{.state = Force::State::Launched, .is_front_attachment = false, .owner = {}};
+    const Force force_back = round_trip(force);
+    CHECK(force_back.state == Force::State::Launched && !force_back.is_front_attachment);
+
+    const HomingAttackBoss boss{.current_state = HomingAttackBoss::State::Repositioning, .exposed = true};
+    const HomingAttackBoss boss_back = round_trip(boss);
+    CHECK(boss_back.current_state == HomingAttackBoss::State::Repositioning && boss_back.exposed);
+}
+
+TEST(component_deltas_only_carry_what_changed)
+{
+    const Health from{.current = 100, .max = 100};
+    const Health to{.current = 90, .max = 100};
+    /* The mask of the two fields, then `current` */
+    CHECK(delta_trip(from, to, 2 + 10).current == 90);
+    CHECK(delta_trip(from, from, 2).current == 100);
+
+    /* Under a quantization step is not a change */
+    const float centre = snapshot_quantization::VELOCITY.dequantize(snapshot_quantization::VELOCITY.quantize(1.0f));
+    const Velocity slow{.value = {centre, centre, 0.0f}};
+    Velocity drift = slow;
+    drift.value.x += snapshot_quantization::VELOCITY.step() / 8.0f;
+    CHECK(net::diff(slow, drift) == 0);
+
+    /* A few steps away goes as the distance, flagged; further away as the full value */
+    Velocity turned = slow;
+    turned.value.y += snapshot_quantization::VELOCITY.step() * 5.0f;
+    CHECK(net::diff(delta_trip(slow, turned, 2 + 1 + snapshot_quantization::VELOCITY_DELTA_BITS), turned) == 0);
+    turned.value.y -= snapshot_quantization::VELOCITY.step() * 30.0f;
+    CHECK(net::diff(delta_trip(slow, turned, 2 + 1 + snapshot_quantization::VELOCITY_DELTA_BITS), turned) == 0);
+    turned.value.y = -30.0f;
+    CHECK(net::diff(delta_trip(slow, turned, 2 + 1 + snapshot_quantization::VELOCITY.bits), turned) == 0);
+}
+
+TEST(entity_state_delta_nests_component_masks)
+{
+    const EntityState from = make_boss(1);
+    EntityState to = from;
+    to.transform.position.x += 1.0f;
+    to.boss.exposed = false;
+
+    /* Record mask, transform mask and x (flag and full value: a unit is too far for a distance), boss mask and exposed */
+    const EntityState back = delta_trip(from, to, 6 + (2 + 1 + 16) + (2 + 1));
+    CHECK(same(back, to));
+
+    /* A quarter of a unit fits a distance */
+    EntityState nudged = from;
+    nudged.transform.position.x -= 0.25f;
+    CHECK(same(delta_trip(from, nudged, 6 + (2 + 1 + snapshot_quantization::POSITION_DELTA_BITS)), nudged));
+
+    /* A new entity against the defaults: every field is far from its default here, so the delta is the biggest one. The id is sent apart */
+    CHECK(net::diff(delta_trip(EntityState{}, from, net::max_delta_bits<EntityState>), from) == 0);
+}
+
+TEST(snapshot_full_delta_and_removals_round_trip)
+{
+    WorldSnapshot first{.sequence = 1, .entities = {}};
+    for (std::uint16_t index = 1; index <= 6; ++index) {
+        EntityState entity = make_boss(index);
+        entity.kind = index % 2 == 0 ? NetKind::Enemy : NetKind::EnemyBullet;
+        entity.transform.position.x = static_cast<float>(index) * 10.0f;
+        first.entities.push_back(entity);
+    }
+    CHECK(same(snapshot_trip(nullptr, first), first));
+
+    /* Moves one, hurts another, removes two and adds one */
+    WorldSnapshot second = first;
+    second.sequence = 2;
+    second.entities[0].transform.position.y = 4.0f;
+    second.entities[2].health.current = 1;
+    second.entities.erase(second.entities.begin() + 4);
+    second.entities.erase(second.entities.begin() + 1);
+    EntityState added{};
+    added.id = NetId::make(9, 1);
+    added.kind = NetKind::PlayerBullet;
+    added.velocity.value = {10.0f, 0.0f, 0.0f};
+    second.entities.push_back(added);
+    CHECK(same(snapshot_trip(&first, second), second));
+
+    /* Nothing changed: the header alone */
+    WorldSnapshot third = second;
+    third.sequence = 3;
+    std::vector<std::uint8_t> payload;
+    encode_snapshot(&second, third, payload);
+    CHECK(payload.size() == 16);
+    CHECK(same(snapshot_trip(&second, third), third));
+}
+
+TEST(snapshot_extrapolates_baselines_along_their_velocity)
+{
+    /* Bullets on straight lines, one far from the others so its NetId is not sent as a distance, and a still enemy */
+    WorldSnapshot first{.sequence = 1, .time = 1'000'000, .entities = {}};
+    for (const std::uint16_t index : {std::uint16_t{2}, std::uint16_t{3}, std::uint16_t{5}, std::uint16_t{3000}}) {
+        EntityState bullet{};
+        bullet.id = NetId::make(index, 0);
+        bullet.kind = NetKind::PlayerBullet;
+        bullet.transform.position = {static_cast<float>(index % 100) - 40.0f, 2.0f, 0.0f};
+        bullet.velocity.value = {20.0f, index == 5 ? -4.0f : 0.0f, 0.0f};
+        first.entities.push_back(bullet);
+    }
+    EntityState still = make_boss(4);
+    still.id = NetId::make(4, 0);
+    still.velocity = {};
+    first.entities.insert(first.entities.begin() + 2, still);
+    CHECK(same(snapshot_trip(nullptr, first), first));
+
+    /* Three ticks later, moved as the simulation does */
+    WorldSnapshot later = first;
+    later.sequence = 4;
+    later.time = first.time + 50'000;
+    for (EntityState &entity : later.entities) {
+        entity.transform.position.x += entity.velocity.value.x * 0.05f;
+        entity.transform.position.y += entity.velocity.value.y * 0.05f;
+    }
+    std::vector<std::uint8_t> payload;
+    encode_snapshot(&first, later, payload);
+    CHECK(payload.size() == 16);
+    CHECK(same(snapshot_trip(&first, later), later));
+
+    /* A bullet off its line sends its distance to the extrapolated position; one removed far away sends its full NetId */
+    WorldSnapshot hit = later;
+    hit.sequence = 5;
+    hit.entities[1].transform.position.y += 0.1f;
+    hit.entities.pop_back();
+    const WorldSnapshot back = snapshot_trip(&first, hit);
+    CHECK(same(back, hit));
+    payload.clear();
+    encode_snapshot(&first, hit, payload);
+    /* Record: short NetId, record and transform masks, flagged y distance. Removal: flag and NetId */
+    CHECK(payload.size() == 16 + (5 + 6 + 2 + 1 + 8 + 1 + 16 + 7) / 8);
+}
+
+TEST(snapshot_rejects_a_wrong_baseline_and_trailing_bytes)
+{
+    WorldSnapshot first{.sequence = 1, .entities = {make_boss(1)}};
+    WorldSnapshot second = first;
+    second.sequence = 2;
+    second.entities[0].health.current = 5;
+
+    std::vector<std::uint8_t> payload;
+    encode_snapshot(&first, second, payload);
+    WorldSnapshot back;
+    CHECK(!decode_snapshot(nullptr, payload, back));
+    CHECK(!decode_snapshot(&second, payload, back));
+
+    payload.push_back(0);
+    CHECK(!decode_snapshot(&first, payload, back));
+}
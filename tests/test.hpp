@@ -0,0 +1,36 @@
+#pragma once
+
+/**
+ * @brief Minimal harness of the unit_tests target.
+ * @details A test is a function declared with TEST(name) that checks its expectations with CHECK().
+ * A failed CHECK() is reported with its location and the test carries on, so one run shows every
+ * broken expectation. `unit_tests [filter]` runs the tests whose name contains `filter`; the exit
+ * status is non-zero if any check failed.
+ */
+namespace test {
+
+using TestFn = void (*)();
+
+/**
+ * @brief Registers a test, called by TEST() before main.
+ */
+bool add(const char *name, TestFn fn) noexcept;
+
+/**
+ * @brief Records a failed check of the running test.
+ */
+void fail(const char *file, int line, const char *expression) noexcept;
+
+}// namespace test
+
+#define TEST(name)                                                       \
+    static void test_##name();                                           \
+    [[maybe_unused]] static const bool test_##name##_registered = test::add(#name, test_##name); \
+    static void test_##name()
+
+#define CHECK(condition)                                 \
+    do {                                                 \
+        if (!(condition)) {                              \
+            test::fail(__FILE__, __LINE__, #condition);  \
+        }                                                \
+    } while (false)